@@ -34,6 +34,7 @@ from fprime_ac.utils import (
     ConfigManager,
     DictTypeConverter,
     EnumGenerator,
+    IdTableGenerator,
     Logger,
 )
 from fprime_ac.utils.buildroot import get_build_roots, search_for_file, set_build_roots
@@ -277,6 +278,15 @@ def pinit():
         default=False,
     )
 
+    parser.add_option(
+        "-Z",
+        "--zero_copy_ports",
+        dest="zero_copy_ports",
+        help="Pass async port arguments through component queues as fixed layout structs when possible (def: False)",
+        action="store_true",
+        default=False,
+    )
+
     parser.add_option(
         "-r",
         "--gen_report",
@@ -419,6 +429,11 @@ def generate_topology(the_parsed_topology_xml, xml_filename, opt):
             event_list = etree.Element("events")
             telemetry_list = etree.Element("channels")
             parameter_list = etree.Element("parameters")
+            # ids collected for the perfect hash id tables
+            channel_ids = []
+            parameter_ids = []
+            event_ids = []
+            opcodes = []
             for comp in the_parsed_topology_xml.get_instances():
                 comp_type = comp.get_type()
                 comp_name = comp.get_name()
@@ -570,6 +585,7 @@ def generate_topology(the_parsed_topology_xml, xml_filename, opt):
                         command_elem.attrib["opcode"] = "%s" % (
                             hex(int(command.get_opcodes()[0], base=0) + comp_id)
                         )
+                        opcodes.append(int(command.get_opcodes()[0], base=0) + comp_id)
                         if "comment" in list(command_elem.attrib.keys()):
                             command_elem.attrib["description"] = command_elem.attrib[
                                 "comment"
@@ -622,6 +638,7 @@ def generate_topology(the_parsed_topology_xml, xml_filename, opt):
                         channel_elem.attrib["id"] = "%s" % (
                             hex(int(chan.get_ids()[0], base=0) + comp_id)
                         )
+                        channel_ids.append(int(chan.get_ids()[0], base=0) + comp_id)
                         if chan.get_format_string() is not None:
                             channel_elem.attrib[
                                 "format_string"
@@ -692,6 +709,7 @@ def generate_topology(the_parsed_topology_xml, xml_filename, opt):
                         event_elem.attrib["id"] = "%s" % (
                             hex(int(event.get_ids()[0], base=0) + comp_id)
                         )
+                        event_ids.append(int(event.get_ids()[0], base=0) + comp_id)
                         event_elem.attrib["severity"] = event.get_severity()
                         format_string = event.get_format_string()
                         if "comment" in list(event_elem.attrib.keys()):
@@ -756,6 +774,9 @@ def generate_topology(the_parsed_topology_xml, xml_filename, opt):
                         command_elem_set.attrib["opcode"] = "%s" % (
                             hex(int(parameter.get_set_opcodes()[0], base=0) + comp_id)
                         )
+                        opcodes.append(
+                            int(parameter.get_set_opcodes()[0], base=0) + comp_id
+                        )
                         if "comment" in list(command_elem_set.attrib.keys()):
                             command_elem_set.attrib["description"] = (
                                 command_elem_set.attrib["comment"] + " parameter set"
@@ -815,6 +836,9 @@ def generate_topology(the_parsed_topology_xml, xml_filename, opt):
                         command_elem_save.attrib["opcode"] = "%s" % (
                             hex(int(parameter.get_save_opcodes()[0], base=0) + comp_id)
                         )
+                        opcodes.append(
+                            int(parameter.get_save_opcodes()[0], base=0) + comp_id
+                        )
                         if "comment" in list(command_elem_save.attrib.keys()):
                             command_elem_save.attrib["description"] = (
                                 command_elem_save.attrib["comment"] + " parameter set"
@@ -832,6 +856,9 @@ def generate_topology(the_parsed_topology_xml, xml_filename, opt):
                         param_elem.attrib["id"] = "%s" % (
                             hex(int(parameter.get_ids()[0], base=0) + comp_id)
                         )
+                        parameter_ids.append(
+                            int(parameter.get_ids()[0], base=0) + comp_id
+                        )
                         if parameter.get_default() is not None:
                             param_default = parameter.get_default()
                         param_elem.attrib["default"] = param_default
@@ -889,6 +916,20 @@ def generate_topology(the_parsed_topology_xml, xml_filename, opt):
             )  # Note: binary forces the same encoding of the source files
             fd.write(etree.tostring(topology_dict, pretty_print=True))
 
+            # Perfect hash tables over the dictionary ids
+            fileName = the_parsed_topology_xml.get_xml_filename().replace(
+                "Ai.xml", "IdTablesAc.hpp"
+            )
+            PRINT.info("Generating id tables %s" % fileName)
+            IdTableGenerator.generate_id_tables(
+                fileName,
+                the_parsed_topology_xml.get_name() or "Topology",
+                channel_ids,
+                parameter_ids,
+                event_ids,
+                opcodes,
+            )
+
     initFiles = generator.create("initFiles")
     # startSource = generator.create("startSource")
     includes1 = generator.create("includes1")
@@ -1635,6 +1676,8 @@ def main():
     Parser = pinit()
     (opt, args) = Parser.parse_args()
     VERBOSE = opt.verbose_flag
+    if opt.zero_copy_ports:
+        CONFIG.set("component", "ZeroCopyAsyncPorts", "True")
 
     # Check that the specified working directory exists. Remember, the
     # default working directory is the current working directory which
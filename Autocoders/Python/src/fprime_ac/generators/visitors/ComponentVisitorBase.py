@@ -27,7 +27,7 @@ from fprime_ac.models import ModelParser
 #
 # Python extention modules and custom interfaces
 #
-from fprime_ac.utils import ConfigManager
+from fprime_ac.utils import ConfigManager, TypesList
 
 #
 # Global logger init. below.
@@ -745,6 +745,31 @@ class ComponentVisitorBase(AbstractVisitor.AbstractVisitor):
         self.initPortFlags(obj, c)
         self.initPortNames(obj, c)
         self.initPortParams(obj, c)
+        self.initFixedLayoutPorts(c)
+
+    def initFixedLayoutPorts(self, c):
+        """
+        Async input ports whose arguments go through the queue as
+        fixed layout message structs instead of being serialized.
+        Enabled by the component ZeroCopyAsyncPorts configuration.
+        """
+        c.fixed_layout_ports = []
+        if self.__config.get("component", "ZeroCopyAsyncPorts") != "True":
+            return
+        for (
+            instance,
+            type,
+            sync,
+            priority,
+            full,
+            role,
+            max_num,
+        ) in c.message_calls_typed:
+            args = c.port_args[instance]
+            if sync != "async" or len(args) == 0:
+                continue
+            if all(self.isFixedLayoutArg(arg) for arg in args):
+                c.fixed_layout_ports.append(instance)
 
     def initPreamble(self, obj, c):
         d = datetime.datetime.now()
@@ -847,6 +872,20 @@ class ComponentVisitorBase(AbstractVisitor.AbstractVisitor):
             "bool",
         ]
 
+    def isFixedLayoutArg(self, arg):
+        """
+        Whether a port argument can be copied into a message struct as it is:
+        a pointer, an enum, a built in type, or an Fw::Buffer, which is
+        carried as its data pointer, size and context
+        """
+        name, type, comment, modifier, enum = arg
+        return (
+            modifier == "*"
+            or enum == "ENUM"
+            or type in TypesList.types_list + TypesList.port_types_list
+            or type == "Fw::Buffer"
+        )
+
     def mapPartial(self, f, l):
         """
         Map partial function f over list l
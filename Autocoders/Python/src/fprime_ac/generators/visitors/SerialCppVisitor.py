@@ -27,7 +27,7 @@ from fprime_ac.generators.visitors import AbstractVisitor
 #
 # from Cheetah import Template
 # from fprime_ac.utils import version
-from fprime_ac.utils import ConfigManager
+from fprime_ac.utils import ConfigManager, TypesList
 
 #
 # Import precompiled templates here
@@ -268,6 +268,13 @@ class SerialCppVisitor(AbstractVisitor.AbstractVisitor):
         c.args_mstring = self._get_args_string(obj, "src.m_")
         c.args_mstring_ptr = self._get_args_string(obj, "src->m_")
         c.members = self._get_conv_mem_list(obj)
+        c.array_types = TypesList.array_types_list
+        # Built-in and scalar enum members serialize to SERIALIZED_SIZE
+        # bytes, so one capacity check covers them all
+        c.fixed_size = all(
+            typeinfo is None or (typeinfo == "enum" and size is None)
+            for (_, _, size, _, _, typeinfo) in c.members
+        )
         self._writeTmpl(c, "publicVisit")
 
     def protectedVisit(self, obj):
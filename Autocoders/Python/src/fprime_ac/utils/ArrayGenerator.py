@@ -16,6 +16,7 @@ import sys
 import os
 from fprime_ac.parsers import XmlParser
 from fprime_ac.parsers import XmlArrayParser
+from fprime_ac.utils import TypesList
 from fprime_ac.generators.templates.arrays import array_cpp
 from fprime_ac.generators.templates.arrays import array_hpp
 
@@ -67,6 +68,7 @@ def write_template(
     c.namespace = namespace
     c.type = arr_type
     c.typeinfo = arr_typeinfo
+    c.array_serialize = arr_type in TypesList.array_types_list
     c.size = arr_size
     c.format = format_string
     c.default = default_values
@@ -187,6 +187,12 @@ class ConfigManager(parent):
 
         self.__prop["component"]["TestImplCpp"] = "TestImpl.cpp"
         self.__prop["component"]["TestImplH"] = "TestImpl.hpp"
+        #
+        # Pass the arguments of async input ports through the queue as
+        # fixed layout message structs instead of serializing them, when
+        # every argument is a pointer, enum, built in type or Fw::Buffer.
+        #
+        self.__prop["component"]["ZeroCopyAsyncPorts"] = "False"
 
         # This sets the defaults within a section.
         self._setSectionDefaults("component")
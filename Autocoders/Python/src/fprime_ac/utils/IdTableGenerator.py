@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+# ===============================================================================
+# NAME: IdTableGenerator.py
+#
+# DESCRIPTION: A generator to produce perfect hash tables over the channel ids,
+#              parameter ids, event ids and opcodes of a topology. The tables are read at
+#              run time with Fw::IdTableUtils::lookup (Fw/Types/IdTable.hpp).
+#
+# Copyright 2018, California Institute of Technology.
+# ALL RIGHTS RESERVED. U.S. Government Sponsorship acknowledged.
+# ===============================================================================
+
+# id stored in slots that hold no id
+EMPTY_ID = 0xFFFFFFFF
+
+# average number of ids per first-level bucket
+BUCKET_LOAD = 4
+
+# seeds to try per bucket before growing the table
+MAX_SEED = 1 << 16
+
+MASK32 = 0xFFFFFFFF
+
+
+def id_hash(id_value, seed):
+    """
+    Hash an id with a seed. Must match Fw::IdTableUtils::hash.
+    """
+    h = (id_value ^ seed) & MASK32
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & MASK32
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK32
+    h ^= h >> 16
+    return h
+
+
+def build_id_table(ids):
+    """
+    Build a perfect hash table over a list of unique ids using hash and
+    displace. Returns (slots, seeds) where slots[i] is the id stored at slot i
+    (or EMPTY_ID) and seeds[b] is the second-level seed for first-level bucket b.
+    """
+    ids = sorted(set(ids))
+    if EMPTY_ID in ids:
+        raise ValueError("Id 0x%08X is reserved by the id table" % EMPTY_ID)
+    if not ids:
+        return [EMPTY_ID], [1]
+
+    num_slots = len(ids)
+    while True:
+        result = _try_build(ids, num_slots)
+        if result is not None:
+            return result
+        # grow the table a little and try again
+        num_slots += max(1, num_slots // 8)
+
+
+def _try_build(ids, num_slots):
+    num_seeds = max(1, (len(ids) + BUCKET_LOAD - 1) // BUCKET_LOAD)
+    buckets = [[] for _ in range(num_seeds)]
+    for id_value in ids:
+        buckets[id_hash(id_value, 0) % num_seeds].append(id_value)
+
+    slots = [EMPTY_ID] * num_slots
+    seeds = [0] * num_seeds
+    # place the largest buckets first while the table is mostly empty
+    order = sorted(range(num_seeds), key=lambda b: len(buckets[b]), reverse=True)
+    for bucket in order:
+        members = buckets[bucket]
+        if not members:
+            seeds[bucket] = 1
+            continue
+        for seed in range(1, MAX_SEED):
+            candidates = [id_hash(id_value, seed) % num_slots for id_value in members]
+            if len(set(candidates)) == len(candidates) and all(
+                slots[slot] == EMPTY_ID for slot in candidates
+            ):
+                for id_value, slot in zip(members, candidates):
+                    slots[slot] = id_value
+                seeds[bucket] = seed
+                break
+        else:
+            return None
+    return slots, seeds
+
+
+def _format_array(values, per_line=8):
+    lines = []
+    for start in range(0, len(values), per_line):
+        chunk = values[start : start + per_line]
+        lines.append("        " + ",".join("0x%08X" % value for value in chunk))
+    return ",\n".join(lines)
+
+
+def _write_table(fp, name, ids):
+    slots, seeds = build_id_table(ids)
+    fp.write("    static const U32 %s_IDS[] = {\n" % name)
+    fp.write(_format_array(slots) + "\n")
+    fp.write("    };\n\n")
+    fp.write("    static const U32 %s_SEEDS[] = {\n" % name)
+    fp.write(_format_array(seeds) + "\n")
+    fp.write("    };\n\n")
+    fp.write("    static const Fw::IdTable %s = {\n" % name)
+    fp.write("        %s_IDS,\n" % name)
+    fp.write("        %s_SEEDS,\n" % name)
+    fp.write("        %d,\n" % len(slots))
+    fp.write("        %d\n" % len(seeds))
+    fp.write("    };\n\n")
+
+
+def generate_id_tables(
+    filename, topology_name, channel_ids, parameter_ids, event_ids, opcodes
+):
+    """
+    Write a header with perfect hash tables for the channel ids, parameter ids,
+    event ids and opcodes of a topology.
+    """
+    guard = topology_name.upper() + "_IDTABLESAC_HPP"
+    with open(filename, "w") as fp:
+        fp.write("// " + "=" * 70 + "\n")
+        fp.write("// \\title  %s\n" % filename.split("/")[-1])
+        fp.write("// \\brief  Perfect hash id tables for topology %s\n" % topology_name)
+        fp.write("//\n")
+        fp.write("// Automatically generated from the topology dictionary. Do not edit.\n")
+        fp.write("// " + "=" * 70 + "\n\n")
+        fp.write("#ifndef %s\n" % guard)
+        fp.write("#define %s\n\n" % guard)
+        fp.write("#include <Fw/Types/IdTable.hpp>\n\n")
+        fp.write("namespace %sIdTables {\n\n" % topology_name)
+        _write_table(fp, "CHANNELS", channel_ids)
+        _write_table(fp, "PARAMETERS", parameter_ids)
+        _write_table(fp, "EVENTS", event_ids)
+        _write_table(fp, "OPCODES", opcodes)
+        fp.write("}\n\n")
+        fp.write("#endif\n")
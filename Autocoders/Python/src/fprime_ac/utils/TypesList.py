@@ -23,3 +23,14 @@ port_types_list = [
     "NATIVE_INT_TYPE",
     "NATIVE_UINT_TYPE",
 ]
+# types with serializeArray/deserializeArray routines in Fw::SerializeBufferBase
+array_types_list = [
+    "I16",
+    "I32",
+    "I64",
+    "U16",
+    "U32",
+    "U64",
+    "F32",
+    "F64",
+]
@@ -0,0 +1,53 @@
+// ======================================================================
+// \title  BenchComponentImpl.cpp
+// \brief  Component whose async port calls are timed by the benchmark
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Autocoders/Python/test/async_port_benchmark/BenchComponentImpl.hpp>
+
+namespace AsyncPortBench {
+
+#if FW_OBJECT_NAMES == 1
+    BenchComponentImpl::BenchComponentImpl(const char* compName) :
+        BenchComponentBase(compName),
+#else
+    BenchComponentImpl::BenchComponentImpl(void) :
+#endif
+        m_seq(0),
+        m_value(0.0),
+        m_valid(false)
+    {
+    }
+
+    BenchComponentImpl::~BenchComponentImpl(void) {
+    }
+
+    void BenchComponentImpl::init(NATIVE_INT_TYPE queueDepth, NATIVE_INT_TYPE instance) {
+        BenchComponentBase::init(queueDepth, instance);
+    }
+
+    Fw::QueuedComponentBase::MsgDispatchStatus BenchComponentImpl::dispatch(void) {
+        return this->doDispatch();
+    }
+
+    void BenchComponentImpl::sampleIn_handler(NATIVE_INT_TYPE portNum, U32 seq, F64 value, bool valid) {
+        this->m_seq = seq;
+        this->m_value = value;
+        this->m_valid = valid;
+    }
+
+    void BenchComponentImpl::sampleSyncIn_handler(NATIVE_INT_TYPE portNum, U32 seq, F64 value, bool valid) {
+        this->sampleIn_handler(portNum, seq, value, valid);
+    }
+
+    void BenchComponentImpl::bufferIn_handler(NATIVE_INT_TYPE portNum, Fw::Buffer &fwBuffer) {
+        this->m_buffer = fwBuffer;
+    }
+
+}
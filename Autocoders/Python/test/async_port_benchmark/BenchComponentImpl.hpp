@@ -0,0 +1,47 @@
+// ======================================================================
+// \title  BenchComponentImpl.hpp
+// \brief  Component whose async port calls are timed by the benchmark
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef ASYNC_PORT_BENCHMARK_BENCHCOMPONENTIMPL_HPP
+#define ASYNC_PORT_BENCHMARK_BENCHCOMPONENTIMPL_HPP
+
+#include <Autocoders/Python/test/async_port_benchmark/BenchComponentAc.hpp>
+
+namespace AsyncPortBench {
+
+    class BenchComponentImpl : public BenchComponentBase {
+        public:
+#if FW_OBJECT_NAMES == 1
+            BenchComponentImpl(const char* compName);
+#else
+            BenchComponentImpl(void);
+#endif
+            virtual ~BenchComponentImpl(void);
+
+            void init(NATIVE_INT_TYPE queueDepth, NATIVE_INT_TYPE instance = 0);
+
+            //! Dispatch one queued port call
+            //! \return The dispatch status
+            MsgDispatchStatus dispatch(void);
+
+            U32 m_seq; //!< sequence number of the last sample
+            F64 m_value; //!< value of the last sample
+            bool m_valid; //!< valid flag of the last sample
+            Fw::Buffer m_buffer; //!< last buffer received
+
+        PRIVATE:
+            void sampleIn_handler(NATIVE_INT_TYPE portNum, U32 seq, F64 value, bool valid);
+            void sampleSyncIn_handler(NATIVE_INT_TYPE portNum, U32 seq, F64 value, bool valid);
+            void bufferIn_handler(NATIVE_INT_TYPE portNum, Fw::Buffer &fwBuffer);
+    };
+
+}
+
+#endif
@@ -0,0 +1,123 @@
+// ======================================================================
+// \title  AsyncPortBenchmark.cpp
+// \brief  Latency benchmark for autocoded async port calls
+//
+//         Times calls to the async input ports of a queued component
+//         and the dispatch of each call from its queue. The component
+//         has a port with built-in type arguments and a port with an
+//         Fw::Buffer argument, plus a sync port as the baseline. Build
+//         once with FPRIME_AC_ZERO_COPY_PORTS OFF and once ON (see
+//         cmake/Options.cmake) to compare serialized port calls with
+//         fixed layout messages.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Autocoders/Python/test/async_port_benchmark/BenchComponentImpl.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <stdio.h>
+#include <time.h>
+
+enum {
+    QUEUE_DEPTH = 10, // default Linux mq msg_max, so the Posix backend can run
+    ITERATIONS = 1000000 // a multiple of QUEUE_DEPTH
+};
+
+static F64 now(void) {
+    timespec time;
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<F64>(time.tv_sec) + static_cast<F64>(time.tv_nsec) / 1000000000.0;
+}
+
+static void report(const char* port, F64 callTime, F64 dispatchTime) {
+    printf("%s: call %0.3fus, dispatch %0.3fus, total %0.3fus\n",
+           port,
+           1000000.0 * callTime / static_cast<F64>(ITERATIONS),
+           1000000.0 * dispatchTime / static_cast<F64>(ITERATIONS),
+           1000000.0 * (callTime + dispatchTime) / static_cast<F64>(ITERATIONS));
+}
+
+static void dispatchOne(AsyncPortBench::BenchComponentImpl& comp) {
+    Fw::QueuedComponentBase::MsgDispatchStatus stat = comp.dispatch();
+    FW_ASSERT(stat == Fw::QueuedComponentBase::MSG_DISPATCH_OK, stat);
+}
+
+// Call the sync port, which runs the handler directly
+void bench_sync(AsyncPortBench::BenchComponentImpl& comp) {
+    AsyncPortBench::InputSamplePort* port = comp.get_sampleSyncIn_InputPort(0);
+    F64 start = now();
+    for (U32 iter = 0; iter < ITERATIONS; iter++) {
+        port->invoke(iter, 0.5 * iter, (iter & 1) != 0);
+    }
+    F64 elapsed = now() - start;
+    FW_ASSERT(comp.m_seq == ITERATIONS - 1, comp.m_seq);
+    printf("Sync port: call %0.3fus\n", 1000000.0 * elapsed / static_cast<F64>(ITERATIONS));
+}
+
+// Fill the queue with port calls, then dispatch them, timing each half
+void bench_sample(AsyncPortBench::BenchComponentImpl& comp) {
+    AsyncPortBench::InputSamplePort* port = comp.get_sampleIn_InputPort(0);
+    F64 callTime = 0.0;
+    F64 dispatchTime = 0.0;
+    for (U32 iter = 0; iter < ITERATIONS; iter += QUEUE_DEPTH) {
+        F64 start = now();
+        for (U32 msg = 0; msg < QUEUE_DEPTH; msg++) {
+            port->invoke(iter + msg, 0.5 * (iter + msg), (msg & 1) != 0);
+        }
+        F64 middle = now();
+        for (U32 msg = 0; msg < QUEUE_DEPTH; msg++) {
+            dispatchOne(comp);
+        }
+        callTime += middle - start;
+        dispatchTime += now() - middle;
+        FW_ASSERT(comp.m_seq == iter + QUEUE_DEPTH - 1, comp.m_seq, iter);
+        FW_ASSERT(comp.m_value == 0.5 * comp.m_seq);
+        FW_ASSERT(comp.m_valid);
+    }
+    report("Built-in type arguments", callTime, dispatchTime);
+}
+
+void bench_buffer(AsyncPortBench::BenchComponentImpl& comp) {
+    Fw::InputBufferSendPort* port = comp.get_bufferIn_InputPort(0);
+    U8 data[64];
+    F64 callTime = 0.0;
+    F64 dispatchTime = 0.0;
+    for (U32 iter = 0; iter < ITERATIONS; iter += QUEUE_DEPTH) {
+        F64 start = now();
+        for (U32 msg = 0; msg < QUEUE_DEPTH; msg++) {
+            Fw::Buffer buffer(data + msg, sizeof(data) - msg, iter + msg);
+            port->invoke(buffer);
+        }
+        F64 middle = now();
+        for (U32 msg = 0; msg < QUEUE_DEPTH; msg++) {
+            dispatchOne(comp);
+        }
+        callTime += middle - start;
+        dispatchTime += now() - middle;
+        FW_ASSERT(comp.m_buffer.getData() == data + QUEUE_DEPTH - 1);
+        FW_ASSERT(comp.m_buffer.getSize() == sizeof(data) - QUEUE_DEPTH + 1, comp.m_buffer.getSize());
+        FW_ASSERT(comp.m_buffer.getContext() == iter + QUEUE_DEPTH - 1, comp.m_buffer.getContext(), iter);
+    }
+    report("Fw::Buffer argument", callTime, dispatchTime);
+}
+
+int main(int argc, char* argv[]) {
+    printf("-----------------------------\n");
+    printf("---- async port benchmark ---\n");
+    printf("-----------------------------\n");
+#if FW_OBJECT_NAMES == 1
+    AsyncPortBench::BenchComponentImpl comp("Bench");
+#else
+    AsyncPortBench::BenchComponentImpl comp;
+#endif
+    comp.init(QUEUE_DEPTH);
+    bench_sync(comp);
+    bench_sample(comp);
+    bench_buffer(comp);
+    FW_ASSERT(comp.dispatch() == Fw::QueuedComponentBase::MSG_DISPATCH_EMPTY);
+    return 0;
+}
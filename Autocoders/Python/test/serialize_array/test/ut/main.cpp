@@ -0,0 +1,116 @@
+#include <Autocoders/Python/test/serialize_array/LabeledSerializableAc.hpp>
+#include <Autocoders/Python/test/serialize_array/ReadingsArrayAc.hpp>
+#include <Autocoders/Python/test/serialize_array/SamplesSerializableAc.hpp>
+
+#include <Fw/Types/SerialBuffer.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <stdio.h>
+#include <string.h>
+
+// Check that array members and array types serialize to the same bytes as
+// serializing each element in turn, and read back the same values
+
+// Serializable equality compares array members by address, so compare
+// the bytes of a second serialization instead
+void checkSame(const Fw::Serializable& out, const U8* data, NATIVE_UINT_TYPE size) {
+    U8 outData[256];
+    Fw::SerialBuffer outBuffer(outData, sizeof(outData));
+    FW_ASSERT(outBuffer.serialize(out) == Fw::FW_SERIALIZE_OK);
+    FW_ASSERT(outBuffer.getBuffLength() == size, outBuffer.getBuffLength(), size);
+    FW_ASSERT(memcmp(outData, data, size) == 0);
+}
+
+void testSamples(void) {
+    U16 counts[4] = {1, 2, 0xFFFF, 0x1234};
+    F32 readings[8] = {0.0, 1.5, -2.25, 1.0e20, -1.0e-20, 3.0, 4.0, 5.0};
+    U64 times[2] = {0x0102030405060708ULL, 0x8877665544332211ULL};
+    U8 raw[3] = {7, 8, 9};
+    I32 offsets[2] = {-1, 0x7FFFFFFF};
+
+    SerializeArray::Samples in(42, true, counts, 4, readings, 8, times, 2, raw, 3, offsets, 2);
+
+    U8 data[SerializeArray::Samples::SERIALIZED_SIZE + 16];
+    Fw::SerialBuffer buffer(data, sizeof(data));
+    FW_ASSERT(buffer.serialize(in) == Fw::FW_SERIALIZE_OK);
+
+    U8 expectedData[sizeof(data)];
+    Fw::SerialBuffer expected(expectedData, sizeof(expectedData));
+    FW_ASSERT(expected.serialize(static_cast<U32>(42)) == Fw::FW_SERIALIZE_OK);
+    FW_ASSERT(expected.serialize(true) == Fw::FW_SERIALIZE_OK);
+    for (NATIVE_UINT_TYPE entry = 0; entry < 4; entry++) {
+        FW_ASSERT(expected.serialize(counts[entry]) == Fw::FW_SERIALIZE_OK);
+    }
+    for (NATIVE_UINT_TYPE entry = 0; entry < 8; entry++) {
+        FW_ASSERT(expected.serialize(readings[entry]) == Fw::FW_SERIALIZE_OK);
+    }
+    for (NATIVE_UINT_TYPE entry = 0; entry < 2; entry++) {
+        FW_ASSERT(expected.serialize(times[entry]) == Fw::FW_SERIALIZE_OK);
+    }
+    for (NATIVE_UINT_TYPE entry = 0; entry < 3; entry++) {
+        FW_ASSERT(expected.serialize(raw[entry]) == Fw::FW_SERIALIZE_OK);
+    }
+    for (NATIVE_UINT_TYPE entry = 0; entry < 2; entry++) {
+        FW_ASSERT(expected.serialize(offsets[entry]) == Fw::FW_SERIALIZE_OK);
+    }
+
+    // skip the type ID, if any
+    const NATIVE_UINT_TYPE idSize = buffer.getBuffLength() - SerializeArray::Samples::SERIALIZED_SIZE;
+    FW_ASSERT(expected.getBuffLength() == SerializeArray::Samples::SERIALIZED_SIZE, expected.getBuffLength());
+    FW_ASSERT(memcmp(data + idSize, expectedData, expected.getBuffLength()) == 0);
+
+    SerializeArray::Samples out;
+    FW_ASSERT(buffer.deserialize(out) == Fw::FW_SERIALIZE_OK);
+    FW_ASSERT(out.getseq() == 42, out.getseq());
+    checkSame(out, data, buffer.getBuffLength());
+
+    // no room for the members writes none of them
+    Fw::SerialBuffer small(data, idSize + SerializeArray::Samples::SERIALIZED_SIZE - 1);
+    FW_ASSERT(small.serialize(in) == Fw::FW_SERIALIZE_NO_ROOM_LEFT);
+    FW_ASSERT(small.getBuffLength() == idSize, small.getBuffLength());
+}
+
+void testLabeled(void) {
+    F64 values[3] = {1.0, -2.0, 0.125};
+    SerializeArray::Labeled in("label", values, 3);
+
+    U8 data[SerializeArray::Labeled::SERIALIZED_SIZE];
+    Fw::SerialBuffer buffer(data, sizeof(data));
+    FW_ASSERT(buffer.serialize(in) == Fw::FW_SERIALIZE_OK);
+
+    SerializeArray::Labeled out;
+    FW_ASSERT(buffer.deserialize(out) == Fw::FW_SERIALIZE_OK);
+    checkSame(out, data, buffer.getBuffLength());
+}
+
+void testReadings(void) {
+    SerializeArray::Readings in(0.5, -0.5, 1.0, 2.0, 1.0e10, -3.0);
+
+    U8 data[SerializeArray::Readings::SERIALIZED_SIZE];
+    Fw::SerialBuffer buffer(data, sizeof(data));
+    FW_ASSERT(buffer.serialize(in) == Fw::FW_SERIALIZE_OK);
+
+    U8 expectedData[sizeof(data)];
+    Fw::SerialBuffer expected(expectedData, sizeof(expectedData));
+    for (U32 entry = 0; entry < SerializeArray::Readings::SIZE; entry++) {
+        FW_ASSERT(expected.serialize(in[entry]) == Fw::FW_SERIALIZE_OK);
+    }
+    FW_ASSERT(memcmp(data, expectedData, sizeof(data)) == 0);
+
+    SerializeArray::Readings out;
+    FW_ASSERT(buffer.deserialize(out) == Fw::FW_SERIALIZE_OK);
+    FW_ASSERT(in == out);
+
+    // not enough data for the whole array
+    buffer.resetDeser();
+    FW_ASSERT(buffer.deserializeSkip(1) == Fw::FW_SERIALIZE_OK);
+    FW_ASSERT(buffer.deserialize(out) == Fw::FW_DESERIALIZE_SIZE_MISMATCH);
+}
+
+int main(int argc, char* argv[]) {
+    testSamples();
+    testLabeled();
+    testReadings();
+    printf("Array serialization tests passed\n");
+    return 0;
+}
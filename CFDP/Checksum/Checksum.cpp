@@ -13,10 +13,124 @@
 #include "CFDP/Checksum/Checksum.hpp"
 #include "Fw/Types/Assert.hpp"
 
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 static U32 min(const U32 a, const U32 b) {
   return (a < b) ? a : b;
 }
 
+// The checksum adds each byte at position p (relative to the start of the
+// file) shifted left by 8*(3 - p%4). So it is enough to sum the bytes at each
+// position modulo 4 into four lanes and shift the lane sums once at the end.
+// Each lane only matters modulo 2^32, so the sums may wrap.
+
+#if !defined(__AVX2__) && !defined(__SSE2__)
+
+static bool isLittleEndian(void) {
+  const U16 one = 1;
+  U8 first;
+  memcpy(&first, &one, 1);
+  return first == 1;
+}
+
+#endif
+
+//! Add the bytes of whole blocks of data to the lane sums
+//! \return The number of bytes added, a multiple of 4
+static U32 addLanes(
+    const U8 *const data, //!< The data, starting at a position that is 0 modulo 4
+    const U32 length, //!< The length of the data
+    U32 lanes[4] //!< The lane sums
+) {
+  // Each step splits a block into its even and odd bytes, zero extended to
+  // 16 bit fields, and adds them to two accumulators. A field holds the sum of
+  // up to 257 bytes, so the fields are moved into the lanes every 256 steps.
+  U32 index = 0;
+#if defined(__AVX2__)
+  enum { BLOCK = 32 };
+  const __m256i mask = _mm256_set1_epi16(0x00FF);
+  while (index + BLOCK <= length) {
+    const U32 end = index + BLOCK * min((length - index) / BLOCK, 256);
+    __m256i even = _mm256_setzero_si256();
+    __m256i odd = _mm256_setzero_si256();
+    for ( ; index < end; index += BLOCK) {
+      const __m256i bytes =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&data[index]));
+      even = _mm256_add_epi16(even, _mm256_and_si256(bytes, mask));
+      odd = _mm256_add_epi16(odd, _mm256_srli_epi16(bytes, 8));
+    }
+    U16 evenSums[BLOCK / 2];
+    U16 oddSums[BLOCK / 2];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(evenSums), even);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(oddSums), odd);
+    // Field f holds the bytes at 2f and 2f + 1 of each block
+    for (U32 field = 0; field < BLOCK / 2; ++field) {
+      lanes[(2 * field) % 4] += evenSums[field];
+      lanes[(2 * field + 1) % 4] += oddSums[field];
+    }
+  }
+#elif defined(__SSE2__)
+  enum { BLOCK = 16 };
+  const __m128i mask = _mm_set1_epi16(0x00FF);
+  while (index + BLOCK <= length) {
+    const U32 end = index + BLOCK * min((length - index) / BLOCK, 256);
+    __m128i even = _mm_setzero_si128();
+    __m128i odd = _mm_setzero_si128();
+    for ( ; index < end; index += BLOCK) {
+      const __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[index]));
+      even = _mm_add_epi16(even, _mm_and_si128(bytes, mask));
+      odd = _mm_add_epi16(odd, _mm_srli_epi16(bytes, 8));
+    }
+    U16 evenSums[BLOCK / 2];
+    U16 oddSums[BLOCK / 2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(evenSums), even);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(oddSums), odd);
+    // Field f holds the bytes at 2f and 2f + 1 of each block
+    for (U32 field = 0; field < BLOCK / 2; ++field) {
+      lanes[(2 * field) % 4] += evenSums[field];
+      lanes[(2 * field + 1) % 4] += oddSums[field];
+    }
+  }
+#else
+  enum { BLOCK = 8 };
+  const U64 mask = 0x00FF00FF00FF00FFULL;
+  const bool little = isLittleEndian();
+  while (index + BLOCK <= length) {
+    const U32 end = index + BLOCK * min((length - index) / BLOCK, 256);
+    U64 even = 0;
+    U64 odd = 0;
+    for ( ; index < end; index += BLOCK) {
+      U64 word;
+      memcpy(&word, &data[index], sizeof(word));
+      even += word & mask;
+      odd += (word >> 8) & mask;
+    }
+    // Field f of even holds the bytes at 2f (little endian) or 7 - 2f (big
+    // endian) of each word, and field f of odd those at 2f + 1 or 6 - 2f
+    for (U32 field = 0; field < 4; ++field) {
+      const U32 evenSum = static_cast<U32>(even >> (16 * field)) & 0xFFFF;
+      const U32 oddSum = static_cast<U32>(odd >> (16 * field)) & 0xFFFF;
+      if (little) {
+        lanes[(2 * field) % 4] += evenSum;
+        lanes[(2 * field + 1) % 4] += oddSum;
+      }
+      else {
+        lanes[(7 - 2 * field) % 4] += evenSum;
+        lanes[(6 - 2 * field) % 4] += oddSum;
+      }
+    }
+  }
+#endif
+  return index;
+}
+
 namespace CFDP {
 
   Checksum ::
@@ -89,7 +203,12 @@ namespace CFDP {
       index += wordLength;
     }
 
-    // Add the middle words aligned
+    // Add the middle words aligned, as many as possible a block at a time
+    if (index + 4 <= length) {
+      U32 lanes[4] = { 0, 0, 0, 0 };
+      index += addLanes(&data[index], length - index, lanes);
+      this->value += (lanes[0] << 24) + (lanes[1] << 16) + (lanes[2] << 8) + lanes[3];
+    }
     for ( ; index + 4 <= length; index += 4)
       addWordAligned(&data[index]);
 
@@ -61,7 +61,9 @@ namespace CFDP {
       //! Compare checksum and this for inequality
       bool operator!=(const Checksum& checksum) const;
 
-      //! Update the checksum value by accumulating the words in the data
+      //! Update the checksum value by accumulating the words in the data.
+      //! Blocks of data are summed with SSE2 or AVX2 when the compiler
+      //! targets them, and eight bytes at a time otherwise.
       void update(
           const U8 *const data, //! The data
           const U32 offset, //! The offset of the start of the data, relative to the start of the file
@@ -6,8 +6,38 @@
 
 #include "CFDP/Checksum/Checksum.hpp"
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
 using namespace CFDP;
 
+//! The checksum computed a byte at a time, as the CFDP standard defines it
+static U32 referenceChecksum(
+    const U8 *const data,
+    const U32 offset,
+    const U32 length,
+    U32 value
+) {
+  for (U32 i = 0; i < length; ++i) {
+    value += static_cast<U32>(data[i]) << (8 * (3 - (offset + i) % 4));
+  }
+  return value;
+}
+
+static void fillRandom(U8 *const data, const U32 length, const U32 seed) {
+  srand(seed);
+  for (U32 i = 0; i < length; ++i) {
+    data[i] = static_cast<U8>(rand());
+  }
+}
+
+static F64 now(void) {
+  timespec time;
+  (void) clock_gettime(CLOCK_MONOTONIC, &time);
+  return static_cast<F64>(time.tv_sec) + static_cast<F64>(time.tv_nsec) / 1000000000.0;
+}
+
 const U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
 
 const U32 expectedValue = 
@@ -49,6 +79,82 @@ TEST(Checksum, ThreePackets) {
   ASSERT_EQ(expectedValue, checksum.getValue());
 }
 
+TEST(Checksum, AllOffsetsAndLengths) {
+  // Every file offset modulo 4, every start in memory modulo 32, and lengths
+  // that cover the head, block and tail paths
+  U8 data[600];
+  fillRandom(data, sizeof(data), 1);
+  for (U32 offset = 0; offset < 8; ++offset) {
+    for (U32 start = 0; start < 32; ++start) {
+      for (U32 length = 0; length + start <= 560; ++length) {
+        Checksum checksum(0x12345678);
+        checksum.update(&data[start], offset, length);
+        ASSERT_EQ(
+            referenceChecksum(&data[start], offset, length, 0x12345678),
+            checksum.getValue()
+        ) << "offset " << offset << " start " << start << " length " << length;
+      }
+    }
+  }
+}
+
+TEST(Checksum, SaturatedBytes) {
+  // All bytes 0xFF, long enough for the lane sums to wrap
+  const U32 length = 1 << 20;
+  U8 *const data = new U8[length];
+  memset(data, 0xFF, length);
+  Checksum checksum;
+  checksum.update(data, 0, length);
+  ASSERT_EQ(referenceChecksum(data, 0, length, 0), checksum.getValue());
+  delete[] data;
+}
+
+TEST(Checksum, RandomPackets) {
+  // A file split into packets of random sizes gives the checksum of the whole file
+  const U32 length = 1 << 16;
+  U8 *const data = new U8[length];
+  fillRandom(data, length, 2);
+  const U32 expected = referenceChecksum(data, 0, length, 0);
+  for (U32 trial = 0; trial < 20; ++trial) {
+    Checksum checksum;
+    U32 offset = 0;
+    while (offset < length) {
+      U32 size = 1 + static_cast<U32>(rand()) % 1500;
+      if (size > length - offset) {
+        size = length - offset;
+      }
+      checksum.update(&data[offset], offset, size);
+      offset += size;
+    }
+    ASSERT_EQ(expected, checksum.getValue());
+  }
+  delete[] data;
+}
+
+TEST(Checksum, Throughput) {
+  const U32 length = 16 << 20;
+  const U32 passes = 8;
+  U8 *const data = new U8[length];
+  fillRandom(data, length, 3);
+  Checksum checksum;
+  F64 start = now();
+  for (U32 pass = 0; pass < passes; ++pass) {
+    checksum.update(&data[1], 1, length - 1);
+  }
+  const F64 elapsed = now() - start;
+  start = now();
+  U32 reference = 0;
+  for (U32 pass = 0; pass < passes; ++pass) {
+    reference = referenceChecksum(&data[1], 1, length - 1, reference);
+  }
+  const F64 referenceElapsed = now() - start;
+  ASSERT_EQ(reference, checksum.getValue());
+  const F64 megabytes = static_cast<F64>(passes) * static_cast<F64>(length) / (1024.0 * 1024.0);
+  printf("Checksum::update %8.1f MB/s, byte at a time %8.1f MB/s\n",
+      megabytes / elapsed, megabytes / referenceElapsed);
+  delete[] data;
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -31,6 +31,7 @@
     #include <string.h>
 #elif defined TGT_OS_TYPE_LINUX || TGT_OS_TYPE_DARWIN
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include <netdb.h>
     #include <unistd.h>
     #include <errno.h>
@@ -49,6 +50,12 @@ namespace Drv {
 
     struct SocketState {
         struct sockaddr_in m_udpAddr;  //!< UDP server address, maybe unused
+#if defined TGT_OS_TYPE_LINUX || TGT_OS_TYPE_DARWIN
+        struct iovec m_batchIov[SOCKET_BATCH_MAX_MESSAGES]; //!< One entry per accumulated send
+#endif
+#ifdef TGT_OS_TYPE_LINUX
+        struct mmsghdr m_batchMsgs[SOCKET_BATCH_MAX_MESSAGES]; //!< One UDP datagram per accumulated send
+#endif
     };
 
     SocketHelper::SocketHelper() : m_state(new SocketState)
@@ -58,13 +65,38 @@ namespace Drv {
         ,m_timeoutSeconds(0)
         ,m_timeoutMicroseconds(0)
         ,m_port(0)
+        ,m_batchData(NULL)
+        ,m_batchCapacity(0)
+        ,m_batchWindow(0)
+        ,m_batchBytes(0)
+        ,m_batchCount(0)
+        ,m_batchesSent(0)
+        ,m_maxBatchSize(0)
+        ,m_maxLatency(0)
     {
+        this->m_batchStart.upper = 0;
+        this->m_batchStart.lower = 0;
     }
 
     SocketHelper::~SocketHelper() {
+        delete[] this->m_batchData;
         delete this->m_state;
     }
 
+    void SocketHelper::configureBatching(const U32 max_bytes, const U32 window_microseconds) {
+        // Send anything accumulated under the old settings
+        this->flush();
+        delete[] this->m_batchData;
+        this->m_batchData = NULL;
+        this->m_batchCapacity = 0;
+        if (max_bytes > 0) {
+            this->m_batchData = new U8[max_bytes];
+            FW_ASSERT(this->m_batchData != NULL);
+            this->m_batchCapacity = max_bytes;
+        }
+        this->m_batchWindow = window_microseconds;
+    }
+
     SocketIpStatus SocketHelper::configure(
             const char* hostname,
             const U16 port,
@@ -87,6 +119,10 @@ namespace Drv {
         return (-1 != this->m_socketInFd);
     }
 
+    NATIVE_INT_TYPE SocketHelper::getRecvFd(void) {
+        return this->m_socketInFd;
+    }
+
     void SocketHelper::close(void) {
         if (this->m_socketInFd != -1) {
             (void) ::close(this->m_socketInFd);
@@ -198,6 +234,151 @@ namespace Drv {
     }
 
     void SocketHelper::send(U8* data, const U32 size) {
+        // Send immediately when not batching, or when the data could never fit in a batch
+        if (this->m_batchData == NULL || size > this->m_batchCapacity) {
+            this->flush();
+            this->transmit(data, size);
+            return;
+        }
+        if (this->m_batchBytes + size > this->m_batchCapacity || this->m_batchCount == SOCKET_BATCH_MAX_MESSAGES) {
+            this->flush();
+        }
+        if (this->m_batchCount == 0) {
+            Os::IntervalTimer::getRawTime(this->m_batchStart);
+        }
+        memcpy(&this->m_batchData[this->m_batchBytes], data, size);
+        this->m_batchSizes[this->m_batchCount] = size;
+        this->m_batchBytes += size;
+        this->m_batchCount++;
+
+        Os::IntervalTimer::RawTime now;
+        Os::IntervalTimer::getRawTime(now);
+        if (Os::IntervalTimer::getDiffUsec(now, this->m_batchStart) >= this->m_batchWindow) {
+            this->flush();
+        }
+    }
+
+    void SocketHelper::flush(void) {
+        if (this->m_batchCount == 0) {
+            return;
+        }
+        this->transmitBatch();
+
+        Os::IntervalTimer::RawTime now;
+        Os::IntervalTimer::getRawTime(now);
+        const U32 latency = Os::IntervalTimer::getDiffUsec(now, this->m_batchStart);
+        this->m_batchesSent++;
+        this->m_maxBatchSize = FW_MAX(this->m_maxBatchSize, this->m_batchCount);
+        this->m_maxLatency = FW_MAX(this->m_maxLatency, latency);
+        this->m_batchBytes = 0;
+        this->m_batchCount = 0;
+    }
+
+    void SocketHelper::getBatchStats(U32 &batches, U32 &max_batch_size, U32 &max_latency_microseconds) {
+        batches = this->m_batchesSent;
+        max_batch_size = this->m_maxBatchSize;
+        max_latency_microseconds = this->m_maxLatency;
+        this->m_batchesSent = 0;
+        this->m_maxBatchSize = 0;
+        this->m_maxLatency = 0;
+    }
+
+    void SocketHelper::transmitBatch(void) {
+        // Prevent transmission before connection, or after a disconnect
+        if (this->m_socketOutFd == -1) {
+            return;
+        }
+#if defined TGT_OS_TYPE_LINUX || TGT_OS_TYPE_DARWIN
+        struct iovec* iov = this->m_state->m_batchIov;
+        U32 offset = 0;
+        for (U32 i = 0; i < this->m_batchCount; i++) {
+            iov[i].iov_base = &this->m_batchData[offset];
+            iov[i].iov_len = this->m_batchSizes[i];
+            offset += this->m_batchSizes[i];
+        }
+#endif
+#ifdef TGT_OS_TYPE_LINUX
+        // UDP: one datagram per accumulated send, all in one system call
+        if (this->m_sendUdp) {
+            struct mmsghdr* msgs = this->m_state->m_batchMsgs;
+            memset(msgs, 0, sizeof(struct mmsghdr) * this->m_batchCount);
+            for (U32 i = 0; i < this->m_batchCount; i++) {
+                msgs[i].msg_hdr.msg_name = &this->m_state->m_udpAddr;
+                msgs[i].msg_hdr.msg_namelen = sizeof(this->m_state->m_udpAddr);
+                msgs[i].msg_hdr.msg_iov = &iov[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+            }
+            U32 total = 0;
+            for (U32 i = 0; i < MAX_SEND_ITERATIONS && total < this->m_batchCount; i++) {
+                I32 sent = ::sendmmsg(this->m_socketOutFd, &msgs[total], this->m_batchCount - total, SOCKET_SEND_FLAGS);
+                // Error is EINTR, just try again
+                if (sent == -1 && errno == EINTR) {
+                    continue;
+                }
+                // Error bad file descriptor is a close
+                else if (sent == -1 && errno == EBADF) {
+                    Fw::Logger::logMsg("[ERROR] Server disconnected\n");
+                    this->close();
+                    break;
+                }
+                // Error returned, and it wasn't an interrupt
+                else if (sent == -1) {
+                    Fw::Logger::logMsg("[ERROR] IP send failed ERRNO: %d UDP: %d\n", errno, m_sendUdp);
+                    break;
+                }
+                total += sent;
+            }
+            return;
+        }
+#endif
+#if defined TGT_OS_TYPE_LINUX || TGT_OS_TYPE_DARWIN
+        // TCP: gather the accumulated sends into one stream write
+        if (not this->m_sendUdp) {
+            struct msghdr msg;
+            memset(&msg, 0, sizeof(msg));
+            U32 first = 0; // first entry not yet completely sent
+            for (U32 i = 0; i < MAX_SEND_ITERATIONS && first < this->m_batchCount; i++) {
+                msg.msg_iov = &iov[first];
+                msg.msg_iovlen = this->m_batchCount - first;
+                I32 sent = ::sendmsg(this->m_socketOutFd, &msg, SOCKET_SEND_FLAGS);
+                // Error is EINTR, just try again
+                if (sent == -1 && errno == EINTR) {
+                    continue;
+                }
+                // Error bad file descriptor is a close
+                else if (sent == -1 && errno == EBADF) {
+                    Fw::Logger::logMsg("[ERROR] Server disconnected\n");
+                    this->close();
+                    break;
+                }
+                // Error returned, and it wasn't an interrupt
+                else if (sent == -1) {
+                    Fw::Logger::logMsg("[ERROR] IP send failed ERRNO: %d UDP: %d\n", errno, m_sendUdp);
+                    break;
+                }
+                // Skip what was written, which may end part way through an entry
+                U32 remaining = sent;
+                while (first < this->m_batchCount && remaining >= iov[first].iov_len) {
+                    remaining -= iov[first].iov_len;
+                    first++;
+                }
+                if (first < this->m_batchCount) {
+                    iov[first].iov_base = static_cast<U8*>(iov[first].iov_base) + remaining;
+                    iov[first].iov_len -= remaining;
+                }
+            }
+            return;
+        }
+#endif
+        // No gathering send on this OS, so send each buffer in turn
+        U8* data = this->m_batchData;
+        for (U32 i = 0; i < this->m_batchCount; i++) {
+            this->transmit(data, this->m_batchSizes[i]);
+            data += this->m_batchSizes[i];
+        }
+    }
+
+    void SocketHelper::transmit(U8* data, const U32 size) {
 
         U32 total = 0;
         // Prevent transmission before connection, or after a disconnect
@@ -228,7 +409,7 @@ namespace Drv {
                 break;
             }
             // Error returned, and it wasn't an interrupt
-            else if (sent == -1 && errno == EINTR) {
+            else if (sent == -1) {
                 Fw::Logger::logMsg("[ERROR] IP send failed ERRNO: %d UDP: %d\n", errno, m_sendUdp);
                 break;
             }
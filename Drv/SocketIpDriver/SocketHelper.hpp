@@ -11,6 +11,7 @@
 #include <Fw/Types/BasicTypes.hpp>
 #include <Drv/SocketIpDriver/SocketIpDriverTypes.hpp>
 #include <SocketIpDriverCfg.hpp>
+#include <Os/IntervalTimer.hpp>
 
 namespace Drv {
 
@@ -29,15 +30,31 @@ namespace Drv {
                     const U32 timeout_seconds,
                     const U32 timeout_microseconds
                     );
+            //! Accumulate sends and flush them with one system call. A batch is flushed when the next send does not
+            //! fit in max_bytes, when SOCKET_BATCH_MAX_MESSAGES sends are waiting, when a send finds the oldest waiting
+            //! send older than window_microseconds, and on every call to flush. There is no timer: the window is only
+            //! checked on send, so a batch with no send after it waits for the next flush. UDP sends keep their
+            //! datagram boundaries. A max_bytes of 0 turns batching off.
+            void configureBatching(
+                    const U32 max_bytes,
+                    const U32 window_microseconds
+                    );
             bool isOpened(void);
+            NATIVE_INT_TYPE getRecvFd(void); //!< Descriptor that recv reads from, -1 when closed
             SocketIpStatus open(void);
             void send(U8* data, const U32 size); //Forwards to sendto, which on some OSes requires a non-const data pointer
+            void flush(void); //!< Send any accumulated data now
+            //! Get the number of batches flushed, and the largest batch (in sends) and longest wait of a send (in
+            //! microseconds) since the last call
+            void getBatchStats(U32 &batches, U32 &max_batch_size, U32 &max_latency_microseconds);
             SocketIpStatus recv(U8* data, I32 &size);
             void close(void);
 
         PRIVATE:
 
             SocketIpStatus openProtocol(NATIVE_INT_TYPE protocol, bool isInput = true);
+            void transmit(U8* data, const U32 size); //!< Send one buffer now
+            void transmitBatch(void); //!< Send the accumulated buffers now
 
             SocketState* m_state;
             NATIVE_INT_TYPE m_socketInFd;  //!< Input file descriptor, always TCP
@@ -48,6 +65,17 @@ namespace Drv {
             char m_hostname[MAX_HOSTNAME_SIZE]; //!< Hostname to supply
             U16 m_port;                    //!< IP address port used
 
+            U8* m_batchData;               //!< Accumulated send data, NULL if not batching
+            U32 m_batchCapacity;           //!< Size of m_batchData
+            U32 m_batchWindow;             //!< Longest wait of an accumulated send, in microseconds
+            U32 m_batchBytes;              //!< Bytes accumulated
+            U32 m_batchCount;              //!< Sends accumulated
+            U32 m_batchSizes[SOCKET_BATCH_MAX_MESSAGES]; //!< Size of each accumulated send
+            Os::IntervalTimer::RawTime m_batchStart; //!< When the oldest accumulated send arrived
+            U32 m_batchesSent;             //!< Batches flushed since the last getBatchStats
+            U32 m_maxBatchSize;            //!< Largest batch since the last getBatchStats
+            U32 m_maxLatency;              //!< Longest wait since the last getBatchStats, in microseconds
+
     };
 
 }
@@ -17,6 +17,7 @@
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Types/EightyCharString.hpp>
 #include <Os/Log.hpp>
+#include <string.h>
 
 namespace Drv {
 
@@ -30,6 +31,8 @@ namespace Drv {
     SocketIpDriverComponentImpl(
         const char *const compName
     ) : SocketIpDriverComponentBase(compName),
+        m_reactor(NULL),
+        m_disconnected(false),
         m_buffer(m_backing_data, sizeof(m_buffer)),
         m_stop(false)
   { }
@@ -51,9 +54,12 @@ namespace Drv {
           U16 port,
           const bool send_udp,
           const U32 timeout_seconds,
-          const U32 timeout_microseconds
+          const U32 timeout_microseconds,
+          const U32 batch_bytes,
+          const U32 batch_window_microseconds
           ) {
 
+      this->m_helper.configureBatching(batch_bytes,batch_window_microseconds);
       return this->m_helper.configure(hostname,port,send_udp,timeout_seconds,timeout_microseconds);
   }
 
@@ -79,12 +85,7 @@ namespace Drv {
                   status != SOCK_INTERRUPTED_TRY_AGAIN) {
                   self->m_helper.close();
               } else {
-                  // Ignore KEEPALIVE data and send out any other data.
-                  if (memcmp(data, KEEPALIVE_CONST,
-                         (size > static_cast<I32>(sizeof(KEEPALIVE_CONST)) - 1) ? sizeof(KEEPALIVE_CONST) -1 : size) != 0) {
-                      self->m_buffer.setSize(size);
-                      self->recv_out(0, self->m_buffer);
-                  }
+                  self->forwardRecv(data, size);
               }
           }
       }
@@ -118,6 +119,64 @@ namespace Drv {
       }
   }
 
+  void SocketIpDriverComponentImpl::forwardRecv(U8* data, I32 size) {
+      // Ignore KEEPALIVE data and send out any other data.
+      if (memcmp(data, KEEPALIVE_CONST,
+             (size > static_cast<I32>(sizeof(KEEPALIVE_CONST)) - 1) ? sizeof(KEEPALIVE_CONST) -1 : size) != 0) {
+          this->m_buffer.setSize(size);
+          this->recv_out(0, this->m_buffer);
+      }
+  }
+
+#ifdef TGT_OS_TYPE_LINUX
+  SocketIpStatus SocketIpDriverComponentImpl::startReactor(
+        Os::Reactor& reactor,
+        const char* host,
+        U16 port
+  )
+  {
+      FW_ASSERT(not m_recvTask.isStarted());
+      this->configure(host,port);
+      this->m_reactor = &reactor;
+      SocketIpStatus stat = this->openForReactor();
+      if (stat != SOCK_SUCCESS) {
+          Fw::Logger::logMsg("Unable to open socket: %d\n",stat);
+      }
+      return stat;
+  }
+
+  SocketIpStatus SocketIpDriverComponentImpl::openForReactor(void) {
+      SocketIpStatus stat = this->m_helper.open();
+      if (stat == SOCK_SUCCESS and
+          this->m_reactor->add(this->m_helper.getRecvFd(), this) != Os::Reactor::REACTOR_OK) {
+          this->m_helper.close();
+          stat = SOCK_FAILED_TO_GET_SOCKET;
+      }
+      return stat;
+  }
+
+  void SocketIpDriverComponentImpl::readable(void) {
+      U8* data = this->m_buffer.getData();
+      FW_ASSERT(data);
+      I32 size = 0;
+      SocketIpStatus status = this->m_helper.recv(data,size);
+      if (status == SOCK_SUCCESS) {
+          this->forwardRecv(data, size);
+      } else if (status != SOCK_INTERRUPTED_TRY_AGAIN) {
+          // Stop watching the socket, but leave closing and reopening it to schedIn, which holds the component
+          // lock that send also takes. The socket stays open until then, so this is the last call for it.
+          (void) this->m_reactor->remove(this->m_helper.getRecvFd());
+          this->m_disconnected = true;
+      }
+  }
+#else
+  SocketIpStatus SocketIpDriverComponentImpl::openForReactor(void) {
+      // Reactors are only available on Linux
+      FW_ASSERT(0);
+      return SOCK_FAILED_TO_GET_SOCKET;
+  }
+#endif
+
   Os::Task::TaskStatus SocketIpDriverComponentImpl :: joinSocketTask(void** value_ptr) {
       // provide return value of thread if value_ptr is not NULL
       return m_recvTask.join(value_ptr);
@@ -142,4 +201,30 @@ namespace Drv {
       FW_ASSERT(data);
       this->m_helper.send(data,size);
   }
+
+  void SocketIpDriverComponentImpl ::
+    schedIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+      U32 batches = 0;
+      U32 maxBatchSize = 0;
+      U32 maxLatency = 0;
+      // Reconnect a socket served by a reactor. The socket task reconnects on its own.
+      if (this->m_reactor != NULL) {
+          if (this->m_disconnected) {
+              this->m_helper.close();
+              this->m_disconnected = false;
+          }
+          if (not this->m_helper.isOpened()) {
+              (void) this->openForReactor();
+          }
+      }
+      this->m_helper.flush();
+      this->m_helper.getBatchStats(batches,maxBatchSize,maxLatency);
+      this->tlmWrite_SocketIpDriver_BatchesSent(batches);
+      this->tlmWrite_SocketIpDriver_MaxBatchSize(maxBatchSize);
+      this->tlmWrite_SocketIpDriver_MaxFlushLatency(maxLatency);
+  }
 } // end namespace Svc
@@ -20,6 +20,7 @@
 #include <Drv/SocketIpDriver/SocketHelper.hpp>
 #include <Drv/SocketIpDriver/SocketIpDriverTypes.hpp>
 #include <Os/Task.hpp>
+#include <Os/Reactor.hpp>
 
 // Includes for the IP layer
 #ifdef TGT_OS_TYPE_VXWORKS
@@ -34,6 +35,9 @@ namespace Drv {
 
   class SocketIpDriverComponentImpl :
     public SocketIpDriverComponentBase
+#ifdef TGT_OS_TYPE_LINUX
+    ,public Os::Reactor::Handler
+#endif
   {
     public:
 
@@ -64,7 +68,9 @@ namespace Drv {
               U16 port,
               const bool send_udp = SOCKET_SEND_UDP, /*!< Send down using UDP. Default: read from configuration HPP*/
               const U32 timeout_seconds = SOCKET_TIMEOUT_SECONDS, /*!< Timeout(S). Default: from configuration HPP*/
-              const U32 timeout_microseconds = SOCKET_TIMEOUT_MICROSECONDS /*!< Timeout(uS). Default: from configuration HPP*/
+              const U32 timeout_microseconds = SOCKET_TIMEOUT_MICROSECONDS, /*!< Timeout(uS). Default: from configuration HPP*/
+              const U32 batch_bytes = SOCKET_BATCH_BYTES, /*!< Bytes of sends to batch, 0 for none. Default: from configuration HPP*/
+              const U32 batch_window_microseconds = SOCKET_BATCH_WINDOW_MICROSECONDS /*!< Batch window(uS), checked on send. schedIn always flushes. Default: from configuration HPP*/
               );
 
       //! The task required to read from the socket
@@ -89,6 +95,22 @@ namespace Drv {
       //!
       void exitSocketTask();
 
+#ifdef TGT_OS_TYPE_LINUX
+      //! Receive from a shared reactor task instead of starting a socket task. If the socket cannot be opened, or
+      //! closes later, it is reopened on the next call to schedIn. The socket is only opened and closed on the
+      //! schedIn thread, under the component lock.
+      //!
+      SocketIpStatus startReactor(
+              Os::Reactor& reactor,     //!< Reactor to receive from
+              const char* host,         //!< Hostname to connect to
+              U16 port                  //!< Port to connect to
+      );
+
+      //! Called by the reactor when the socket has data
+      //!
+      void readable(void);
+#endif
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -102,9 +124,30 @@ namespace Drv {
           Fw::Buffer &fwBuffer 
       );
 
+      //! Handler implementation for schedIn
+      //!
+      void schedIn_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          NATIVE_UINT_TYPE context /*!< The call order*/
+      );
+
+      //! Send received data out, unless it is keep-alive data
+      //!
+      void forwardRecv(
+          U8* data, //!< The received data
+          I32 size  //!< The size of the received data
+      );
+
+      //! Open the socket and register it with the reactor
+      //!
+      SocketIpStatus openForReactor(void);
+
       // socket helper instance
       SocketHelper m_helper;
 
+      Os::Reactor* m_reactor;        //!< Reactor receiving for us, NULL when using the socket task
+      volatile bool m_disconnected;  //!< Set by the reactor when the socket closes, for schedIn to reopen it
+
       Os::Task m_recvTask;           //!< Os::Task to start for reciving data
       Fw::Buffer m_buffer;           //!< Fw::Buffer used to pass data
       U8 m_backing_data[MAX_RECV_BUFFER_SIZE]; //!< Buffer used to store data
@@ -0,0 +1,293 @@
+// ======================================================================
+// \title  SocketHelperTest.cpp
+// \brief  Tests batched sends of Drv::SocketHelper, and the reactor mode of
+//         Drv::SocketIpDriver, against loopback listeners
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Drv/SocketIpDriver/SocketHelper.hpp>
+#include <Drv/SocketIpDriver/SocketIpDriverComponentImpl.hpp>
+#include <Fw/Comp/PassiveComponentBase.hpp>
+#include <Os/Reactor.hpp>
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+enum {
+    NUM_MESSAGES = 10,
+    MAX_MESSAGE = 64
+};
+
+// A TCP listener, and a UDP socket bound to the same port number
+class Listener {
+  public:
+    Listener() : m_tcpFd(-1), m_connFd(-1), m_udpFd(-1), m_port(0) {
+        struct sockaddr_in address;
+        socklen_t length = sizeof(address);
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        m_tcpFd = ::socket(AF_INET, SOCK_STREAM, 0);
+        EXPECT_NE(-1, m_tcpFd);
+        EXPECT_EQ(0, ::bind(m_tcpFd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)));
+        EXPECT_EQ(0, ::listen(m_tcpFd, 1));
+        EXPECT_EQ(0, ::getsockname(m_tcpFd, reinterpret_cast<struct sockaddr*>(&address), &length));
+        m_port = ntohs(address.sin_port);
+        m_udpFd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        EXPECT_NE(-1, m_udpFd);
+        EXPECT_EQ(0, ::bind(m_udpFd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)));
+    }
+
+    ~Listener() {
+        (void) ::close(m_connFd);
+        (void) ::close(m_tcpFd);
+        (void) ::close(m_udpFd);
+    }
+
+    void accept() {
+        m_connFd = ::accept(m_tcpFd, NULL, NULL);
+        ASSERT_NE(-1, m_connFd);
+    }
+
+    // Receive one datagram without blocking. Returns -1 if there is none.
+    I32 recvDatagram(U8* data) {
+        return ::recv(m_udpFd, data, MAX_MESSAGE, MSG_DONTWAIT);
+    }
+
+    // Receive exactly size bytes of the stream, or fewer if none are waiting
+    I32 recvStream(U8* data, const U32 size) {
+        U32 total = 0;
+        while (total < size) {
+            I32 got = ::recv(m_connFd, data + total, size - total, MSG_DONTWAIT);
+            if (got <= 0) {
+                break;
+            }
+            total += got;
+        }
+        return total;
+    }
+
+    NATIVE_INT_TYPE m_tcpFd;
+    NATIVE_INT_TYPE m_connFd;
+    NATIVE_INT_TYPE m_udpFd;
+    U16 m_port;
+};
+
+// Fill message n with a pattern of its own length
+static U32 fillMessage(U8* data, const U32 n) {
+    const U32 size = 8 + n;
+    for (U32 i = 0; i < size; i++) {
+        data[i] = static_cast<U8>(n * 16 + i);
+    }
+    return size;
+}
+
+static void openHelper(Drv::SocketHelper& helper, Listener& listener, const bool udp) {
+    ASSERT_EQ(Drv::SOCK_SUCCESS, helper.configure("127.0.0.1", listener.m_port, udp, 1, 0));
+    ASSERT_EQ(Drv::SOCK_SUCCESS, helper.open());
+    listener.accept();
+}
+
+TEST(SocketHelper, UdpBatchKeepsDatagrams) {
+    Listener listener;
+    Drv::SocketHelper helper;
+    helper.configureBatching(1024, 1000000);
+    openHelper(helper, listener, true);
+
+    U8 message[MAX_MESSAGE];
+    for (U32 n = 0; n < NUM_MESSAGES; n++) {
+        helper.send(message, fillMessage(message, n));
+    }
+    // Nothing goes out until the flush
+    U8 received[MAX_MESSAGE];
+    ASSERT_EQ(-1, listener.recvDatagram(received));
+    helper.flush();
+    for (U32 n = 0; n < NUM_MESSAGES; n++) {
+        const U32 size = fillMessage(message, n);
+        ASSERT_EQ(static_cast<I32>(size), listener.recvDatagram(received));
+        ASSERT_EQ(0, memcmp(message, received, size));
+    }
+    ASSERT_EQ(-1, listener.recvDatagram(received));
+
+    U32 batches = 0;
+    U32 maxBatchSize = 0;
+    U32 maxLatency = 0;
+    helper.getBatchStats(batches, maxBatchSize, maxLatency);
+    ASSERT_EQ(1U, batches);
+    ASSERT_EQ(static_cast<U32>(NUM_MESSAGES), maxBatchSize);
+    helper.getBatchStats(batches, maxBatchSize, maxLatency);
+    ASSERT_EQ(0U, batches);
+    helper.close();
+}
+
+TEST(SocketHelper, TcpBatchFlushesWhenFull) {
+    Listener listener;
+    Drv::SocketHelper helper;
+    // Room for the first two messages only
+    helper.configureBatching(20, 1000000);
+    openHelper(helper, listener, false);
+
+    U8 message[MAX_MESSAGE];
+    U8 expected[3 * MAX_MESSAGE];
+    U32 expectedSize = 0;
+    for (U32 n = 0; n < 3; n++) {
+        const U32 size = fillMessage(message, n);
+        memcpy(&expected[expectedSize], message, size);
+        expectedSize += size;
+        helper.send(message, size);
+    }
+    // The third message did not fit, so the first two went out together
+    U8 received[3 * MAX_MESSAGE];
+    ASSERT_EQ(8 + 9, listener.recvStream(received, sizeof(received)));
+    helper.flush();
+    ASSERT_EQ(10, listener.recvStream(&received[17], sizeof(received) - 17));
+    ASSERT_EQ(0, memcmp(expected, received, expectedSize));
+
+    U32 batches = 0;
+    U32 maxBatchSize = 0;
+    U32 maxLatency = 0;
+    helper.getBatchStats(batches, maxBatchSize, maxLatency);
+    ASSERT_EQ(2U, batches);
+    ASSERT_EQ(2U, maxBatchSize);
+    helper.close();
+}
+
+TEST(SocketHelper, ZeroWindowSendsImmediately) {
+    Listener listener;
+    Drv::SocketHelper helper;
+    helper.configureBatching(1024, 0);
+    openHelper(helper, listener, true);
+
+    U8 message[MAX_MESSAGE];
+    U8 received[MAX_MESSAGE];
+    for (U32 n = 0; n < NUM_MESSAGES; n++) {
+        const U32 size = fillMessage(message, n);
+        helper.send(message, size);
+        ASSERT_EQ(static_cast<I32>(size), listener.recvDatagram(received));
+    }
+    U32 batches = 0;
+    U32 maxBatchSize = 0;
+    U32 maxLatency = 0;
+    helper.getBatchStats(batches, maxBatchSize, maxLatency);
+    ASSERT_EQ(static_cast<U32>(NUM_MESSAGES), batches);
+    ASSERT_EQ(1U, maxBatchSize);
+    helper.close();
+}
+
+TEST(SocketHelper, UnbatchedSendsImmediately) {
+    Listener listener;
+    Drv::SocketHelper helper;
+    openHelper(helper, listener, true);
+
+    U8 message[MAX_MESSAGE];
+    U8 received[MAX_MESSAGE];
+    const U32 size = fillMessage(message, 3);
+    helper.send(message, size);
+    ASSERT_EQ(static_cast<I32>(size), listener.recvDatagram(received));
+    ASSERT_EQ(0, memcmp(message, received, size));
+    U32 batches = 0;
+    U32 maxBatchSize = 0;
+    U32 maxLatency = 0;
+    helper.getBatchStats(batches, maxBatchSize, maxLatency);
+    ASSERT_EQ(0U, batches);
+    helper.close();
+}
+
+#ifdef TGT_OS_TYPE_LINUX
+// Records the buffers the driver receives
+class RecvSink : public Fw::PassiveComponentBase {
+  public:
+    RecvSink() :
+#if FW_OBJECT_NAMES == 1
+        Fw::PassiveComponentBase("RecvSink"),
+#endif
+        m_calls(0), m_size(0) {
+        Fw::PassiveComponentBase::init(0);
+        m_port.init();
+        m_port.addCallComp(this, RecvSink::recvIn);
+    }
+
+    static void recvIn(Fw::PassiveComponentBase* callComp, NATIVE_INT_TYPE portNum, Fw::Buffer &fwBuffer) {
+        RecvSink* sink = static_cast<RecvSink*>(callComp);
+        sink->m_calls++;
+        sink->m_size = fwBuffer.getSize();
+        ASSERT_LE(sink->m_size, static_cast<U32>(MAX_MESSAGE));
+        memcpy(sink->m_data, fwBuffer.getData(), sink->m_size);
+    }
+
+    Fw::InputBufferSendPort m_port;
+    U32 m_calls;
+    U32 m_size;
+    U8 m_data[MAX_MESSAGE];
+};
+
+// Send one message over the accepted connection, and wait for the reactor to hand it to the driver
+static void sendToDriver(Listener& listener, Os::Reactor& reactor, RecvSink& sink, const U32 n) {
+    U8 message[MAX_MESSAGE];
+    const U32 size = fillMessage(message, n);
+    const U32 calls = sink.m_calls;
+    ASSERT_EQ(static_cast<ssize_t>(size), ::send(listener.m_connFd, message, size, 0));
+    ASSERT_EQ(Os::Reactor::REACTOR_OK, reactor.poll(1000));
+    ASSERT_EQ(calls + 1, sink.m_calls);
+    ASSERT_EQ(size, sink.m_size);
+    ASSERT_EQ(0, memcmp(message, sink.m_data, size));
+}
+
+TEST(SocketIpDriver, ReactorReceivesAndReconnects) {
+    Listener listener;
+    Os::Reactor reactor;
+    ASSERT_EQ(Os::Reactor::REACTOR_OK, reactor.create());
+    RecvSink sink;
+    Drv::SocketIpDriverComponentImpl driver("SocketIpDriver");
+    driver.init(0);
+    driver.set_recv_OutputPort(0, &sink.m_port);
+
+    ASSERT_EQ(Drv::SOCK_SUCCESS, driver.startReactor(reactor, "127.0.0.1", listener.m_port));
+    listener.accept();
+    sendToDriver(listener, reactor, sink, 1);
+
+    // Sends still go out, as configured in SocketIpDriverCfg.hpp
+    U8 message[MAX_MESSAGE];
+    U8 received[MAX_MESSAGE];
+    U32 size = fillMessage(message, 2);
+    Fw::Buffer buffer(message, size);
+    driver.get_send_InputPort(0)->invoke(buffer);
+    ASSERT_EQ(static_cast<I32>(size),
+              SOCKET_SEND_UDP ? listener.recvDatagram(received) : listener.recvStream(received, size));
+    ASSERT_EQ(0, memcmp(message, received, size));
+
+    // The peer closes. The reactor stops watching the socket, but only schedIn closes it
+    (void) ::close(listener.m_connFd);
+    listener.m_connFd = -1;
+    ASSERT_EQ(Os::Reactor::REACTOR_OK, reactor.poll(1000));
+    ASSERT_TRUE(driver.m_disconnected);
+    ASSERT_TRUE(driver.m_helper.isOpened());
+    ASSERT_EQ(Os::Reactor::REACTOR_OK, reactor.poll(0));
+    ASSERT_EQ(1U, sink.m_calls);
+
+    // schedIn reopens the connection and registers it again
+    driver.get_schedIn_InputPort(0)->invoke(0);
+    ASSERT_FALSE(driver.m_disconnected);
+    ASSERT_TRUE(driver.m_helper.isOpened());
+    listener.accept();
+    sendToDriver(listener, reactor, sink, 3);
+
+    (void) reactor.remove(driver.m_helper.getRecvFd());
+    driver.m_helper.close();
+}
+#endif
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -25,6 +25,7 @@ namespace Fw {
                 FW_PACKET_FILE, // !< File type - incoming and outgoing
                 FW_PACKET_PACKETIZED_TLM, // !< Packetized telemetry packet type
                 FW_PACKET_IDLE, // !< Idle packet
+                FW_PACKET_LOG_BATCH, // !< Batch of log entries, each after its size
                 FW_PACKET_UNKNOWN = 0xFF // !< Unknown packet
             } ComPacketType;
 
@@ -0,0 +1,38 @@
+// ======================================================================
+// \title  IdTable.cpp
+// \brief  Hash and lookup for perfect hash id tables
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "IdTable.hpp"
+#include "Fw/Types/Assert.hpp"
+
+U32 Fw::IdTableUtils::hash(U32 id, U32 seed) {
+    // 32-bit finalizer from MurmurHash3
+    U32 h = id ^ seed;
+    h ^= h >> 16;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35U;
+    h ^= h >> 16;
+    return h;
+}
+
+bool Fw::IdTableUtils::lookup(const IdTable& table, U32 id, NATIVE_UINT_TYPE& slot) {
+    FW_ASSERT(table.ids);
+    FW_ASSERT(table.seeds);
+    FW_ASSERT(table.numSlots > 0);
+    FW_ASSERT(table.numSeeds > 0);
+    const U32 seed = table.seeds[hash(id, 0) % table.numSeeds];
+    const NATIVE_UINT_TYPE candidate = hash(id, seed) % table.numSlots;
+    if (table.ids[candidate] != id) {
+        return false;
+    }
+    slot = candidate;
+    return true;
+}
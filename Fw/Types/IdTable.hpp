@@ -0,0 +1,64 @@
+// ======================================================================
+// \title  IdTable.hpp
+// \brief  Perfect hash tables mapping a fixed set of ids to table slots
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef FW_IDTABLE_HPP
+#define FW_IDTABLE_HPP
+#include "Fw/Types/BasicTypes.hpp"
+
+namespace Fw {
+
+/**
+ * \brief perfect hash table over a fixed set of ids
+ *
+ * Tables are generated by the autocoder from the topology (see
+ * `<Topology>IdTablesAc.hpp`) for channel ids, parameter ids, event ids and
+ * opcodes.
+ * Each id in the set maps to a distinct slot in [0, numSlots) with two hash
+ * computations and no collision chains. The lookup is:
+ *
+ *     seed = seeds[hash(id, 0) % numSeeds]
+ *     slot = hash(id, seed) % numSlots
+ *
+ * and the id is in the set only if ids[slot] == id.
+ */
+struct IdTable {
+    const U32* ids;              //!< id stored at each slot
+    const U32* seeds;            //!< second-level seed for each first-level bucket
+    NATIVE_UINT_TYPE numSlots;   //!< number of slots; at least the number of ids
+    NATIVE_UINT_TYPE numSeeds;   //!< number of first-level buckets
+};
+
+namespace IdTableUtils {
+
+/**
+ * \brief hash an id with a seed
+ *
+ * Must match the hash used by the autocoder to build the tables.
+ *
+ * \param id: id to hash
+ * \param seed: seed value
+ * \return hash value
+ */
+U32 hash(U32 id, U32 seed);
+
+/**
+ * \brief look up the slot for an id
+ *
+ * \param table: generated id table
+ * \param id: id to look up
+ * \param slot: set to the slot of the id when found
+ * \return true if the id is in the table
+ */
+bool lookup(const IdTable& table, U32 id, NATIVE_UINT_TYPE& slot);
+
+}  // namespace IdTableUtils
+}  // namespace Fw
+#endif  // FW_IDTABLE_HPP
@@ -11,6 +11,89 @@
 
 // Some macros/functions to optimize for architectures
 
+namespace {
+
+    // Big-endian encoding for the array and unchecked routines. Written as
+    // shifts on whole words so compilers can use byte swap instructions and
+    // vectorize the array loops.
+
+#if FW_HAS_16_BIT==1
+    void encode(U8* dest, U16 val) {
+        dest[0] = static_cast<U8>(val >> 8);
+        dest[1] = static_cast<U8>(val);
+    }
+
+    void decode(const U8* src, U16& val) {
+        val = static_cast<U16>((static_cast<U16>(src[0]) << 8) | static_cast<U16>(src[1]));
+    }
+#endif
+
+#if FW_HAS_32_BIT==1
+    void encode(U8* dest, U32 val) {
+        dest[0] = static_cast<U8>(val >> 24);
+        dest[1] = static_cast<U8>(val >> 16);
+        dest[2] = static_cast<U8>(val >> 8);
+        dest[3] = static_cast<U8>(val);
+    }
+
+    void decode(const U8* src, U32& val) {
+        val = (static_cast<U32>(src[0]) << 24)
+                | (static_cast<U32>(src[1]) << 16)
+                | (static_cast<U32>(src[2]) << 8)
+                | (static_cast<U32>(src[3]) << 0);
+    }
+#endif
+
+#if FW_HAS_64_BIT==1
+    void encode(U8* dest, U64 val) {
+        dest[0] = static_cast<U8>(val >> 56);
+        dest[1] = static_cast<U8>(val >> 48);
+        dest[2] = static_cast<U8>(val >> 40);
+        dest[3] = static_cast<U8>(val >> 32);
+        dest[4] = static_cast<U8>(val >> 24);
+        dest[5] = static_cast<U8>(val >> 16);
+        dest[6] = static_cast<U8>(val >> 8);
+        dest[7] = static_cast<U8>(val);
+    }
+
+    void decode(const U8* src, U64& val) {
+        val = (static_cast<U64>(src[0]) << 56)
+                | (static_cast<U64>(src[1]) << 48)
+                | (static_cast<U64>(src[2]) << 40)
+                | (static_cast<U64>(src[3]) << 32)
+                | (static_cast<U64>(src[4]) << 24)
+                | (static_cast<U64>(src[5]) << 16)
+                | (static_cast<U64>(src[6]) << 8)
+                | (static_cast<U64>(src[7]) << 0);
+    }
+#endif
+
+    // Encode an array of values as the unsigned type Wire of the same size.
+    // Signed and floating point values are copied bit for bit into Wire.
+    template <typename Wire, typename T>
+    void encodeArray(U8* dest, const T* vals, NATIVE_UINT_TYPE count) {
+        FW_ASSERT(sizeof(Wire) == sizeof(T), sizeof(Wire), sizeof(T));
+        FW_ASSERT(vals or (count == 0));
+        for (NATIVE_UINT_TYPE entry = 0; entry < count; entry++) {
+            Wire val;
+            (void) memcpy(&val, &vals[entry], sizeof(val));
+            encode(&dest[entry * sizeof(Wire)], val);
+        }
+    }
+
+    template <typename Wire, typename T>
+    void decodeArray(const U8* src, T* vals, NATIVE_UINT_TYPE count) {
+        FW_ASSERT(sizeof(Wire) == sizeof(T), sizeof(Wire), sizeof(T));
+        FW_ASSERT(vals or (count == 0));
+        for (NATIVE_UINT_TYPE entry = 0; entry < count; entry++) {
+            Wire val;
+            decode(&src[entry * sizeof(Wire)], val);
+            (void) memcpy(&vals[entry], &val, sizeof(val));
+        }
+    }
+
+}
+
 namespace Fw {
 
     Serializable::Serializable() {
@@ -285,6 +368,100 @@ namespace Fw {
         return FW_SERIALIZE_OK;
     }
 
+    // array serialization routines
+
+    SerializeStatus SerializeBufferBase::claimSer(NATIVE_UINT_TYPE count, NATIVE_UINT_TYPE width, U8*& dest) {
+        // divide rather than multiply so a large count can't overflow
+        if (count > (this->getBuffCapacity() - this->m_serLoc) / width) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        FW_ASSERT(this->getBuffAddr());
+        dest = &this->getBuffAddr()[this->m_serLoc];
+        this->m_serLoc += count * width;
+        this->m_deserLoc = 0;
+        return FW_SERIALIZE_OK;
+    }
+
+#if FW_HAS_16_BIT==1
+    SerializeStatus SerializeBufferBase::serializeArray(const U16* vals, NATIVE_UINT_TYPE count) {
+        U8* dest = 0;
+        SerializeStatus stat = this->claimSer(count, sizeof(U16), dest);
+        if (stat == FW_SERIALIZE_OK) {
+            encodeArray<U16>(dest, vals, count);
+        }
+        return stat;
+    }
+
+    SerializeStatus SerializeBufferBase::serializeArray(const I16* vals, NATIVE_UINT_TYPE count) {
+        U8* dest = 0;
+        SerializeStatus stat = this->claimSer(count, sizeof(U16), dest);
+        if (stat == FW_SERIALIZE_OK) {
+            encodeArray<U16>(dest, vals, count);
+        }
+        return stat;
+    }
+#endif
+
+#if FW_HAS_32_BIT==1
+    SerializeStatus SerializeBufferBase::serializeArray(const U32* vals, NATIVE_UINT_TYPE count) {
+        U8* dest = 0;
+        SerializeStatus stat = this->claimSer(count, sizeof(U32), dest);
+        if (stat == FW_SERIALIZE_OK) {
+            encodeArray<U32>(dest, vals, count);
+        }
+        return stat;
+    }
+
+    SerializeStatus SerializeBufferBase::serializeArray(const I32* vals, NATIVE_UINT_TYPE count) {
+        U8* dest = 0;
+        SerializeStatus stat = this->claimSer(count, sizeof(U32), dest);
+        if (stat == FW_SERIALIZE_OK) {
+            encodeArray<U32>(dest, vals, count);
+        }
+        return stat;
+    }
+#endif
+
+#if FW_HAS_64_BIT==1
+    SerializeStatus SerializeBufferBase::serializeArray(const U64* vals, NATIVE_UINT_TYPE count) {
+        U8* dest = 0;
+        SerializeStatus stat = this->claimSer(count, sizeof(U64), dest);
+        if (stat == FW_SERIALIZE_OK) {
+            encodeArray<U64>(dest, vals, count);
+        }
+        return stat;
+    }
+
+    SerializeStatus SerializeBufferBase::serializeArray(const I64* vals, NATIVE_UINT_TYPE count) {
+        U8* dest = 0;
+        SerializeStatus stat = this->claimSer(count, sizeof(U64), dest);
+        if (stat == FW_SERIALIZE_OK) {
+            encodeArray<U64>(dest, vals, count);
+        }
+        return stat;
+    }
+#endif
+
+    SerializeStatus SerializeBufferBase::serializeArray(const F32* vals, NATIVE_UINT_TYPE count) {
+        U8* dest = 0;
+        SerializeStatus stat = this->claimSer(count, sizeof(U32), dest);
+        if (stat == FW_SERIALIZE_OK) {
+            encodeArray<U32>(dest, vals, count);
+        }
+        return stat;
+    }
+
+#if FW_HAS_F64
+    SerializeStatus SerializeBufferBase::serializeArray(const F64* vals, NATIVE_UINT_TYPE count) {
+        U8* dest = 0;
+        SerializeStatus stat = this->claimSer(count, sizeof(U64), dest);
+        if (stat == FW_SERIALIZE_OK) {
+            encodeArray<U64>(dest, vals, count);
+        }
+        return stat;
+    }
+#endif
+
     // deserialization routines
 
     SerializeStatus SerializeBufferBase::deserialize(U8 &val) {
@@ -562,6 +739,105 @@ namespace Fw {
         return FW_SERIALIZE_OK;
     }
 
+    // array deserialization routines
+
+    SerializeStatus SerializeBufferBase::claimDeser(NATIVE_UINT_TYPE count, NATIVE_UINT_TYPE width, const U8*& src) {
+        if (count == 0) {
+            src = this->getBuffAddrLeft();
+            return FW_SERIALIZE_OK;
+        }
+        // check for room
+        if (this->getBuffLength() == this->m_deserLoc) {
+            return FW_DESERIALIZE_BUFFER_EMPTY;
+        } else if (count > this->getBuffLeft() / width) {
+            return FW_DESERIALIZE_SIZE_MISMATCH;
+        }
+        FW_ASSERT(this->getBuffAddr());
+        src = &this->getBuffAddr()[this->m_deserLoc];
+        this->m_deserLoc += count * width;
+        return FW_SERIALIZE_OK;
+    }
+
+#if FW_HAS_16_BIT==1
+    SerializeStatus SerializeBufferBase::deserializeArray(U16* vals, NATIVE_UINT_TYPE count) {
+        const U8* src = 0;
+        SerializeStatus stat = this->claimDeser(count, sizeof(U16), src);
+        if (stat == FW_SERIALIZE_OK) {
+            decodeArray<U16>(src, vals, count);
+        }
+        return stat;
+    }
+
+    SerializeStatus SerializeBufferBase::deserializeArray(I16* vals, NATIVE_UINT_TYPE count) {
+        const U8* src = 0;
+        SerializeStatus stat = this->claimDeser(count, sizeof(U16), src);
+        if (stat == FW_SERIALIZE_OK) {
+            decodeArray<U16>(src, vals, count);
+        }
+        return stat;
+    }
+#endif
+
+#if FW_HAS_32_BIT==1
+    SerializeStatus SerializeBufferBase::deserializeArray(U32* vals, NATIVE_UINT_TYPE count) {
+        const U8* src = 0;
+        SerializeStatus stat = this->claimDeser(count, sizeof(U32), src);
+        if (stat == FW_SERIALIZE_OK) {
+            decodeArray<U32>(src, vals, count);
+        }
+        return stat;
+    }
+
+    SerializeStatus SerializeBufferBase::deserializeArray(I32* vals, NATIVE_UINT_TYPE count) {
+        const U8* src = 0;
+        SerializeStatus stat = this->claimDeser(count, sizeof(U32), src);
+        if (stat == FW_SERIALIZE_OK) {
+            decodeArray<U32>(src, vals, count);
+        }
+        return stat;
+    }
+#endif
+
+#if FW_HAS_64_BIT==1
+    SerializeStatus SerializeBufferBase::deserializeArray(U64* vals, NATIVE_UINT_TYPE count) {
+        const U8* src = 0;
+        SerializeStatus stat = this->claimDeser(count, sizeof(U64), src);
+        if (stat == FW_SERIALIZE_OK) {
+            decodeArray<U64>(src, vals, count);
+        }
+        return stat;
+    }
+
+    SerializeStatus SerializeBufferBase::deserializeArray(I64* vals, NATIVE_UINT_TYPE count) {
+        const U8* src = 0;
+        SerializeStatus stat = this->claimDeser(count, sizeof(U64), src);
+        if (stat == FW_SERIALIZE_OK) {
+            decodeArray<U64>(src, vals, count);
+        }
+        return stat;
+    }
+#endif
+
+    SerializeStatus SerializeBufferBase::deserializeArray(F32* vals, NATIVE_UINT_TYPE count) {
+        const U8* src = 0;
+        SerializeStatus stat = this->claimDeser(count, sizeof(U32), src);
+        if (stat == FW_SERIALIZE_OK) {
+            decodeArray<U32>(src, vals, count);
+        }
+        return stat;
+    }
+
+#if FW_HAS_F64
+    SerializeStatus SerializeBufferBase::deserializeArray(F64* vals, NATIVE_UINT_TYPE count) {
+        const U8* src = 0;
+        SerializeStatus stat = this->claimDeser(count, sizeof(U64), src);
+        if (stat == FW_SERIALIZE_OK) {
+            decodeArray<U64>(src, vals, count);
+        }
+        return stat;
+    }
+#endif
+
     void SerializeBufferBase::resetSer(void) {
         this->m_deserLoc = 0;
         this->m_serLoc = 0;
@@ -694,6 +970,138 @@ namespace Fw {
     }
 #endif
 
+    UncheckedSerializeScope::UncheckedSerializeScope(SerializeBufferBase& buffer, NATIVE_UINT_TYPE size) :
+            m_buffer(buffer), m_start(0), m_next(0), m_size(size), m_stat(FW_SERIALIZE_OK) {
+        if (size > buffer.getBuffCapacity() - buffer.m_serLoc) {
+            this->m_stat = FW_SERIALIZE_NO_ROOM_LEFT;
+        } else {
+            FW_ASSERT(buffer.getBuffAddr());
+            this->m_start = buffer.getBuffAddrSer();
+            this->m_next = this->m_start;
+        }
+    }
+
+    UncheckedSerializeScope::~UncheckedSerializeScope() {
+        const NATIVE_UINT_TYPE written = static_cast<NATIVE_UINT_TYPE>(this->m_next - this->m_start);
+        // catch writes past the size that was checked
+        FW_ASSERT(written <= this->m_size, written, this->m_size);
+        this->m_buffer.m_serLoc += written;
+        if (written > 0) {
+            this->m_buffer.m_deserLoc = 0;
+        }
+    }
+
+    SerializeStatus UncheckedSerializeScope::getStatus(void) const {
+        return this->m_stat;
+    }
+
+    void UncheckedSerializeScope::serialize(U8 val) {
+        *this->m_next++ = val;
+    }
+
+    void UncheckedSerializeScope::serialize(I8 val) {
+        *this->m_next++ = static_cast<U8>(val);
+    }
+
+#if FW_HAS_16_BIT==1
+    void UncheckedSerializeScope::serialize(U16 val) {
+        encode(this->m_next, val);
+        this->m_next += sizeof(val);
+    }
+
+    void UncheckedSerializeScope::serialize(I16 val) {
+        this->serialize(static_cast<U16>(val));
+    }
+#endif
+
+#if FW_HAS_32_BIT==1
+    void UncheckedSerializeScope::serialize(U32 val) {
+        encode(this->m_next, val);
+        this->m_next += sizeof(val);
+    }
+
+    void UncheckedSerializeScope::serialize(I32 val) {
+        this->serialize(static_cast<U32>(val));
+    }
+#endif
+
+#if FW_HAS_64_BIT==1
+    void UncheckedSerializeScope::serialize(U64 val) {
+        encode(this->m_next, val);
+        this->m_next += sizeof(val);
+    }
+
+    void UncheckedSerializeScope::serialize(I64 val) {
+        this->serialize(static_cast<U64>(val));
+    }
+#endif
+
+    void UncheckedSerializeScope::serialize(F32 val) {
+        U32 u32Val;
+        (void) memcpy(&u32Val, &val, sizeof(val));
+        this->serialize(u32Val);
+    }
+
+#if FW_HAS_F64
+    void UncheckedSerializeScope::serialize(F64 val) {
+        U64 u64Val;
+        (void) memcpy(&u64Val, &val, sizeof(val));
+        this->serialize(u64Val);
+    }
+#endif
+
+    void UncheckedSerializeScope::serialize(bool val) {
+        *this->m_next++ = val ? FW_SERIALIZE_TRUE_VALUE : FW_SERIALIZE_FALSE_VALUE;
+    }
+
+#if FW_HAS_16_BIT==1
+    void UncheckedSerializeScope::serializeArray(const U16* vals, NATIVE_UINT_TYPE count) {
+        encodeArray<U16>(this->m_next, vals, count);
+        this->m_next += count * sizeof(U16);
+    }
+
+    void UncheckedSerializeScope::serializeArray(const I16* vals, NATIVE_UINT_TYPE count) {
+        encodeArray<U16>(this->m_next, vals, count);
+        this->m_next += count * sizeof(U16);
+    }
+#endif
+
+#if FW_HAS_32_BIT==1
+    void UncheckedSerializeScope::serializeArray(const U32* vals, NATIVE_UINT_TYPE count) {
+        encodeArray<U32>(this->m_next, vals, count);
+        this->m_next += count * sizeof(U32);
+    }
+
+    void UncheckedSerializeScope::serializeArray(const I32* vals, NATIVE_UINT_TYPE count) {
+        encodeArray<U32>(this->m_next, vals, count);
+        this->m_next += count * sizeof(U32);
+    }
+#endif
+
+#if FW_HAS_64_BIT==1
+    void UncheckedSerializeScope::serializeArray(const U64* vals, NATIVE_UINT_TYPE count) {
+        encodeArray<U64>(this->m_next, vals, count);
+        this->m_next += count * sizeof(U64);
+    }
+
+    void UncheckedSerializeScope::serializeArray(const I64* vals, NATIVE_UINT_TYPE count) {
+        encodeArray<U64>(this->m_next, vals, count);
+        this->m_next += count * sizeof(U64);
+    }
+#endif
+
+    void UncheckedSerializeScope::serializeArray(const F32* vals, NATIVE_UINT_TYPE count) {
+        encodeArray<U32>(this->m_next, vals, count);
+        this->m_next += count * sizeof(U32);
+    }
+
+#if FW_HAS_F64
+    void UncheckedSerializeScope::serializeArray(const F64* vals, NATIVE_UINT_TYPE count) {
+        encodeArray<U64>(this->m_next, vals, count);
+        this->m_next += count * sizeof(U64);
+    }
+#endif
+
     ExternalSerializeBuffer::ExternalSerializeBuffer(U8* buffPtr, NATIVE_UINT_TYPE size) {
         this->setExtBuffer(buffPtr,size);
     }
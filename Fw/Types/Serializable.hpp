@@ -78,6 +78,26 @@ namespace Fw {
 
             SerializeStatus serialize(const Serializable &val); //!< serialize an object derived from serializable base class
 
+            // Serialization for arrays of built-in types. These check for room once for the whole
+            // array and write the same bytes as serializing each element in turn.
+
+#if FW_HAS_16_BIT==1
+            SerializeStatus serializeArray(const U16* vals, NATIVE_UINT_TYPE count); //!< serialize array of 16-bit unsigned ints
+            SerializeStatus serializeArray(const I16* vals, NATIVE_UINT_TYPE count); //!< serialize array of 16-bit signed ints
+#endif
+#if FW_HAS_32_BIT==1
+            SerializeStatus serializeArray(const U32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit unsigned ints
+            SerializeStatus serializeArray(const I32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit signed ints
+#endif
+#if FW_HAS_64_BIT==1
+            SerializeStatus serializeArray(const U64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit unsigned ints
+            SerializeStatus serializeArray(const I64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit signed ints
+#endif
+            SerializeStatus serializeArray(const F32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit floating point
+#if FW_HAS_F64
+            SerializeStatus serializeArray(const F64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit floating point
+#endif
+
             // Deserialization for built-in types
 
             SerializeStatus deserialize(U8 &val); //!< deserialize 8-bit unsigned int
@@ -114,6 +134,25 @@ namespace Fw {
 
             SerializeStatus deserialize(SerializeBufferBase& val);  //!< serialize a serialized buffer
 
+            // Deserialization for arrays of built-in types. These check for data once for the whole array.
+
+#if FW_HAS_16_BIT==1
+            SerializeStatus deserializeArray(U16* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 16-bit unsigned ints
+            SerializeStatus deserializeArray(I16* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 16-bit signed ints
+#endif
+#if FW_HAS_32_BIT==1
+            SerializeStatus deserializeArray(U32* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 32-bit unsigned ints
+            SerializeStatus deserializeArray(I32* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 32-bit signed ints
+#endif
+#if FW_HAS_64_BIT==1
+            SerializeStatus deserializeArray(U64* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 64-bit unsigned ints
+            SerializeStatus deserializeArray(I64* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 64-bit signed ints
+#endif
+            SerializeStatus deserializeArray(F32* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 32-bit floating point
+#if FW_HAS_F64
+            SerializeStatus deserializeArray(F64* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 64-bit floating point
+#endif
+
             void resetSer(void); //!< reset to beginning of buffer to reuse for serialization
             void resetDeser(void); //!< reset deserialization to beginning
 
@@ -141,16 +180,85 @@ namespace Fw {
 
             SerializeBufferBase(); //!< default constructor
 
+            friend class UncheckedSerializeScope;
+
         PRIVATE:
             // A no-implementation copy constructor here will prevent the default copy constructor from being called
             // accidentally, and without an implementation it will create an error for the developer instead.
             SerializeBufferBase(const SerializeBufferBase &src); //!< constructor with buffer as source
 
             void copyFrom(const SerializeBufferBase& src); //!< copy data from source buffer
+            SerializeStatus claimSer(NATIVE_UINT_TYPE count, NATIVE_UINT_TYPE width, U8*& dest); //!< claim room for count values of width bytes
+            SerializeStatus claimDeser(NATIVE_UINT_TYPE count, NATIVE_UINT_TYPE width, const U8*& src); //!< claim count values of width bytes to read
             NATIVE_UINT_TYPE m_serLoc; //!< current offset in buffer of serialized data
             NATIVE_UINT_TYPE m_deserLoc; //!< current offset for deserialization
     };
 
+    //! Serializes values into a buffer with one capacity check up front.
+    //!
+    //! The constructor checks that the given number of bytes fits in the
+    //! buffer. Values are then written with no further checks, and the
+    //! destructor adds the bytes written to the buffer length. Write only
+    //! when getStatus() returns FW_SERIALIZE_OK, never write more than the
+    //! size given, and do not use the buffer itself while the scope is open.
+
+    class UncheckedSerializeScope {
+        public:
+            UncheckedSerializeScope(SerializeBufferBase& buffer, NATIVE_UINT_TYPE size); //!< check for room for size bytes
+            ~UncheckedSerializeScope(); //!< add the bytes written to the buffer
+
+            SerializeStatus getStatus(void) const; //!< whether the room was there
+
+            void serialize(U8 val); //!< serialize 8-bit unsigned int
+            void serialize(I8 val); //!< serialize 8-bit signed int
+#if FW_HAS_16_BIT==1
+            void serialize(U16 val); //!< serialize 16-bit unsigned int
+            void serialize(I16 val); //!< serialize 16-bit signed int
+#endif
+#if FW_HAS_32_BIT==1
+            void serialize(U32 val); //!< serialize 32-bit unsigned int
+            void serialize(I32 val); //!< serialize 32-bit signed int
+#endif
+#if FW_HAS_64_BIT==1
+            void serialize(U64 val); //!< serialize 64-bit unsigned int
+            void serialize(I64 val); //!< serialize 64-bit signed int
+#endif
+            void serialize(F32 val); //!< serialize 32-bit floating point
+#if FW_HAS_F64
+            void serialize(F64 val); //!< serialize 64-bit floating point
+#endif
+            void serialize(bool val); //!< serialize boolean
+
+#if FW_HAS_16_BIT==1
+            void serializeArray(const U16* vals, NATIVE_UINT_TYPE count); //!< serialize array of 16-bit unsigned ints
+            void serializeArray(const I16* vals, NATIVE_UINT_TYPE count); //!< serialize array of 16-bit signed ints
+#endif
+#if FW_HAS_32_BIT==1
+            void serializeArray(const U32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit unsigned ints
+            void serializeArray(const I32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit signed ints
+#endif
+#if FW_HAS_64_BIT==1
+            void serializeArray(const U64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit unsigned ints
+            void serializeArray(const I64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit signed ints
+#endif
+            void serializeArray(const F32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit floating point
+#if FW_HAS_F64
+            void serializeArray(const F64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit floating point
+#endif
+
+        PRIVATE:
+
+            // no copying
+            UncheckedSerializeScope(const UncheckedSerializeScope& other);
+            UncheckedSerializeScope& operator=(const UncheckedSerializeScope& other);
+
+            SerializeBufferBase& m_buffer; //!< buffer being serialized into
+            U8* m_start; //!< start of the bytes claimed
+            U8* m_next; //!< next byte to write
+            NATIVE_UINT_TYPE m_size; //!< number of bytes claimed
+            SerializeStatus m_stat; //!< result of the capacity check
+    };
+
     // Helper class for building buffers with external storage
 
     class ExternalSerializeBuffer : public SerializeBufferBase {
@@ -7,6 +7,7 @@
 #include <Fw/Types/InternalInterfaceString.hpp>
 #include <Fw/Types/PolyType.hpp>
 #include <Fw/Types/MallocAllocator.hpp>
+#include <Fw/Types/IdTable.hpp>
 
 #include <stdio.h>
 #include <string.h>
@@ -1115,6 +1116,185 @@ TEST(PerformanceTest, F64SerPerfTest) {
 
 }
 
+TEST(SerializationTest,ArraySerialization) {
+
+    SerializeTestBuffer bulk;
+    SerializeTestBuffer single;
+
+    U16 u16In[3] = {0x0102,0xFFFE,0};
+    I32 i32In[4] = {-1,0x7FFFFFFF,-0x7FFFFFFF,12345};
+    U64 u64In[2] = {0x0102030405060708ULL,0xF0E0D0C0B0A09080ULL};
+    F32 f32In[3] = {1.5,-0.25,3.0e10};
+    F64 f64In[2] = {-1.0e100,0.1};
+
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.serializeArray(u16In,3));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.serializeArray(i32In,4));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.serializeArray(u64In,2));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.serializeArray(f32In,3));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.serializeArray(f64In,2));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.serializeArray(u16In,0));
+
+    // arrays serialize to the same bytes as their elements
+    for (NATIVE_UINT_TYPE entry = 0; entry < 3; entry++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,single.serialize(u16In[entry]));
+    }
+    for (NATIVE_UINT_TYPE entry = 0; entry < 4; entry++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,single.serialize(i32In[entry]));
+    }
+    for (NATIVE_UINT_TYPE entry = 0; entry < 2; entry++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,single.serialize(u64In[entry]));
+    }
+    for (NATIVE_UINT_TYPE entry = 0; entry < 3; entry++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,single.serialize(f32In[entry]));
+    }
+    for (NATIVE_UINT_TYPE entry = 0; entry < 2; entry++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,single.serialize(f64In[entry]));
+    }
+    ASSERT_EQ(6+16+16+12+16,bulk.getBuffLength());
+    ASSERT_TRUE(bulk == single);
+
+    U16 u16Out[3];
+    I32 i32Out[4];
+    U64 u64Out[2];
+    F32 f32Out[3];
+    F64 f64Out[2];
+
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.deserializeArray(u16Out,3));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.deserializeArray(i32Out,4));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.deserializeArray(u64Out,2));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.deserializeArray(f32Out,3));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.deserializeArray(f64Out,2));
+    ASSERT_EQ(0,memcmp(u16In,u16Out,sizeof(u16In)));
+    ASSERT_EQ(0,memcmp(i32In,i32Out,sizeof(i32In)));
+    ASSERT_EQ(0,memcmp(u64In,u64Out,sizeof(u64In)));
+    ASSERT_EQ(0,memcmp(f32In,f32Out,sizeof(f32In)));
+    ASSERT_EQ(0,memcmp(f64In,f64Out,sizeof(f64In)));
+
+    // nothing left
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.deserializeArray(u16Out,0));
+    ASSERT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY,bulk.deserializeArray(u16Out,1));
+
+    // not enough left
+    bulk.resetSer();
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.serializeArray(u16In,3));
+    ASSERT_EQ(Fw::FW_DESERIALIZE_SIZE_MISMATCH,bulk.deserializeArray(u64Out,1));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.deserializeArray(u16Out,2));
+    ASSERT_EQ(Fw::FW_DESERIALIZE_SIZE_MISMATCH,bulk.deserializeArray(u16Out,2));
+
+    // no room, including counts that would overflow the size
+    bulk.resetSer();
+    U32 big[64];
+    memset(big,0,sizeof(big));
+    ASSERT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT,bulk.serializeArray(big,64));
+    ASSERT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT,bulk.serializeArray(big,0x40000001));
+    ASSERT_EQ(0,bulk.getBuffLength());
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,bulk.serializeArray(big,63));
+    ASSERT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT,bulk.serializeArray(big,1));
+    ASSERT_EQ(252,bulk.getBuffLength());
+}
+
+TEST(SerializationTest,UncheckedSerialization) {
+
+    SerializeTestBuffer unchecked;
+    SerializeTestBuffer checked;
+
+    U32 u32s[2] = {0xDEADBEEF,7};
+
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,checked.serialize(static_cast<U8>(0xAB)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,checked.serialize(static_cast<I16>(-2)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,checked.serialize(static_cast<U32>(0x01020304)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,checked.serialize(static_cast<I64>(-3)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,checked.serialize(static_cast<F32>(2.5)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,checked.serialize(static_cast<F64>(-0.5)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,checked.serialize(true));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,checked.serialize(u32s[0]));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,checked.serialize(u32s[1]));
+
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,unchecked.serialize(static_cast<U8>(0xAB)));
+    {
+        // more room than is used is fine
+        Fw::UncheckedSerializeScope scope(unchecked,2+4+8+4+8+1+8+10);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,scope.getStatus());
+        scope.serialize(static_cast<I16>(-2));
+        scope.serialize(static_cast<U32>(0x01020304));
+        scope.serialize(static_cast<I64>(-3));
+        scope.serialize(static_cast<F32>(2.5));
+        scope.serialize(static_cast<F64>(-0.5));
+        scope.serialize(true);
+        scope.serializeArray(u32s,2);
+        // the buffer length is updated when the scope closes
+        ASSERT_EQ(1,unchecked.getBuffLength());
+    }
+    ASSERT_TRUE(unchecked == checked);
+
+    // values read back with the checked routines
+    U8 u8;
+    I16 i16;
+    U32 u32;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,unchecked.deserialize(u8));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,unchecked.deserialize(i16));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,unchecked.deserialize(u32));
+    ASSERT_EQ(0xAB,u8);
+    ASSERT_EQ(-2,i16);
+    ASSERT_EQ(0x01020304,u32);
+
+    // no room
+    NATIVE_UINT_TYPE length = unchecked.getBuffLength();
+    {
+        Fw::UncheckedSerializeScope scope(unchecked,unchecked.getBuffCapacity() - length + 1);
+        ASSERT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT,scope.getStatus());
+    }
+    ASSERT_EQ(length,unchecked.getBuffLength());
+}
+
+TEST(PerformanceTest, ArraySerPerfTest) {
+
+    SerializeTestBuffer buff;
+
+    F32 in[50];
+    F32 out[50];
+    for (NATIVE_UINT_TYPE entry = 0; entry < 50; entry++) {
+        in[entry] = static_cast<F32>(entry);
+    }
+
+    NATIVE_INT_TYPE iters = 1000000;
+
+    Os::IntervalTimer timer;
+    timer.start();
+
+    for (NATIVE_INT_TYPE iter = 0; iter < iters; iter++) {
+        buff.resetSer();
+        for (NATIVE_UINT_TYPE entry = 0; entry < 50; entry++) {
+            buff.serialize(in[entry]);
+        }
+        for (NATIVE_UINT_TYPE entry = 0; entry < 50; entry++) {
+            buff.deserialize(out[entry]);
+        }
+    }
+
+    timer.stop();
+
+    printf("Elements: %d iterations took %d us (%f us each).\n", iters,
+            timer.getDiffUsec(),
+            (F32) (timer.getDiffUsec()) / (F32) iters);
+
+    timer.start();
+
+    for (NATIVE_INT_TYPE iter = 0; iter < iters; iter++) {
+        buff.resetSer();
+        buff.serializeArray(in,50);
+        buff.deserializeArray(out,50);
+    }
+
+    timer.stop();
+
+    printf("Array: %d iterations took %d us (%f us each).\n", iters,
+            timer.getDiffUsec(),
+            (F32) (timer.getDiffUsec()) / (F32) iters);
+
+    ASSERT_EQ(0,memcmp(in,out,sizeof(in)));
+}
+
 TEST(AllocatorTest,MallocAllocatorTest) {
     // Since it is a wrapper around malloc, the test consists of requesting
     // memory and verifying a non-zero pointer, unchanged size, and not recoverable.
@@ -1129,6 +1309,27 @@ TEST(AllocatorTest,MallocAllocatorTest) {
     allocator.deallocate(100,ptr);
 }
 
+TEST(IdTableTest,Lookup) {
+    // Table generated by the autocoder for ids 0x100,0x101,0x102,0x1000,0x2000
+    static const U32 ids[] = {0x101,0x2000,0x100,0x1000,0x102};
+    static const U32 seeds[] = {1,8};
+    static const Fw::IdTable table = {ids,seeds,FW_NUM_ARRAY_ELEMENTS(ids),FW_NUM_ARRAY_ELEMENTS(seeds)};
+
+    // every id is found at its own slot
+    for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(ids); entry++) {
+        NATIVE_UINT_TYPE slot = 0xFFFF;
+        ASSERT_TRUE(Fw::IdTableUtils::lookup(table,ids[entry],slot));
+        ASSERT_EQ(entry,slot);
+    }
+
+    // ids not in the table are not found
+    for (U32 id = 0; id < 0x3000; id++) {
+        NATIVE_UINT_TYPE slot;
+        bool expected = (id == 0x100) or (id == 0x101) or (id == 0x102) or (id == 0x1000) or (id == 0x2000);
+        ASSERT_EQ(expected,Fw::IdTableUtils::lookup(table,id,slot));
+    }
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -121,3 +121,51 @@ class EventDecoder(decoder.Decoder):
             offset = offset + arg_obj.getSize()
 
         return tuple(arg_results)
+
+
+class EventBatchDecoder(EventDecoder):
+    """
+    Decoder class for batches of events
+
+    A batch holds several events, each after its size:
+        +-------------------+-------------------+---------------------- - - -
+        | Size (2 bytes)    | Event 1 (Size bytes, as for EventDecoder)     |
+        +-------------------+-------------------+---------------------- - - -
+        | Size (2 bytes)    | Event 2 ...
+    """
+
+    def data_callback(self, data, sender=None):
+        """
+        Decodes each event in the batch and passes it to all registered
+        consumers.
+
+        :param data: data bytes to be decoded
+        :param sender: (optional) sender id, otherwise None
+        """
+        for event in self.decode_batch_api(data):
+            self.send_to_all(event)
+
+    def decode_batch_api(self, data):
+        """
+        Decodes the events in a batch
+
+        Args:
+            data: Binary data to decode
+
+        Returns:
+            A list of the events that could be decoded
+        """
+        events = []
+        size_obj = fprime.common.models.serialize.numerical_types.U16Type()
+        ptr = 0
+        while ptr + size_obj.getSize() <= len(data):
+            size_obj.deserialize(data, ptr)
+            ptr += size_obj.getSize()
+            if ptr + size_obj.val > len(data):
+                print("Event batch decode error: entry overruns the batch")
+                break
+            event = self.decode_api(data[ptr : ptr + size_obj.val])
+            if event is not None:
+                events.append(event)
+            ptr += size_obj.val
+        return events
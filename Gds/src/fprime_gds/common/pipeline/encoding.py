@@ -57,6 +57,9 @@ class EncodingDecoding:
         self.event_decoder = fprime_gds.common.decoders.event_decoder.EventDecoder(
             dictionaries.event_id
         )
+        self.event_batch_decoder = fprime_gds.common.decoders.event_decoder.EventBatchDecoder(
+            dictionaries.event_id
+        )
         self.channel_decoder = fprime_gds.common.decoders.ch_decoder.ChDecoder(
             dictionaries.channel_id
         )
@@ -72,6 +75,7 @@ class EncodingDecoding:
         # Register the event and channel decoders to the distributor for their
         # respective data types
         distributor.register("FW_PACKET_LOG", self.event_decoder)
+        distributor.register("FW_PACKET_LOG_BATCH", self.event_batch_decoder)
         distributor.register("FW_PACKET_TELEM", self.channel_decoder)
         distributor.register("FW_PACKET_FILE", self.file_decoder)
         if self.packet_decoder is not None:
@@ -95,6 +99,7 @@ class EncodingDecoding:
         :param consumer: consumer of events
         """
         self.event_decoder.register(consumer)
+        self.event_batch_decoder.register(consumer)
 
     def remove_event_consumer(self, consumer):
         """
@@ -104,7 +109,8 @@ class EncodingDecoding:
         :param consumer: consumer of events
         :return: a boolean indicating if the consumer was removed.
         """
-        return self.event_decoder.deregister(consumer)
+        removed = self.event_decoder.deregister(consumer)
+        return self.event_batch_decoder.deregister(consumer) and removed
 
     def register_channel_consumer(self, consumer):
         """
@@ -0,0 +1,148 @@
+/**
+ * AsyncFile.hpp:
+ *
+ * Asynchronous writes to an Os::File. The caller fills one of a fixed set of registered buffers, submits it and goes
+ * back to its work; the write completes in the background and the buffer is reused once it has. The caller only
+ * waits when every buffer is in flight, so a logger keeps dispatching messages while the disk is busy.
+ *
+ * On Linux the writes go through io_uring, with the buffers registered with the kernel. Where io_uring is not
+ * available, or when BACKEND_WORKERS is requested, a pool of worker threads performs the writes instead.
+ *
+ * Each submission is written at the offset following the previous one, so the file holds the buffers in submission
+ * order no matter in which order the writes complete. An AsyncFile is used by one task; only the backend runs on
+ * other threads.
+ */
+#ifndef _ASYNC_FILE_HPP_
+#define _ASYNC_FILE_HPP_
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Os/File.hpp>
+
+namespace Os {
+
+    class AsyncFile {
+        public:
+
+            typedef enum {
+                ASYNC_OK, //!< Operation succeeded
+                ASYNC_UNINITIALIZED, //!< create has not been called, or failed
+                ASYNC_NOT_OPENED, //!< No file is open
+                ASYNC_NO_BUFFER, //!< Every buffer is in flight
+                ASYNC_BAD_SIZE, //!< Invalid buffer index or size
+                ASYNC_ERROR //!< The backend could not be started or the submission failed
+            } AsyncStatus;
+
+            typedef enum {
+                BACKEND_AUTO, //!< io_uring when the kernel provides it, otherwise worker threads
+                BACKEND_WORKERS //!< Worker threads
+            } Backend;
+
+            enum {
+                DEFAULT_WORKERS = 1, //!< worker threads started for BACKEND_WORKERS
+                MAX_WORKERS = 8 //!< largest worker pool
+            };
+
+            AsyncFile();
+            ~AsyncFile(); //!< Waits for writes in flight and closes the file
+
+            //! Allocate and register the buffers and start the backend. Must be called before any other method.
+            //! For OPEN_SYNC_DIRECT_WRITE, bufferSize must be a multiple of the device block size.
+            AsyncStatus create(
+                    NATIVE_UINT_TYPE depth, //!< number of buffers, and so the most writes in flight
+                    NATIVE_UINT_TYPE bufferSize, //!< size of each buffer
+                    Backend backend = BACKEND_AUTO, //!< backend to use
+                    NATIVE_UINT_TYPE numWorkers = DEFAULT_WORKERS //!< size of the worker pool, if one is used
+                    );
+
+            //! Open a file for writing. Modes have the meaning given by Os::File; OPEN_READ is not supported.
+            File::Status open(const char* fileName, File::Mode mode);
+
+            bool isOpen(void) const; //!< check if a file is open
+
+            //! Take a free buffer to fill. With block set, waits for a write to complete if every buffer is in
+            //! flight; otherwise returns ASYNC_NO_BUFFER.
+            AsyncStatus getBuffer(U8*& buffer, NATIVE_UINT_TYPE& index, bool block);
+
+            //! Write the first size bytes of a buffer taken with getBuffer. The buffer returns to the free set
+            //! once the write completes. With waitForDone set the data is on disk before the write completes,
+            //! as for File::write.
+            AsyncStatus submitWrite(NATIVE_UINT_TYPE index, NATIVE_UINT_TYPE size, bool waitForDone = true);
+
+            //! Copy data into as many buffers as needed and submit them. Waits only while every buffer is in flight.
+            AsyncStatus write(const void* data, NATIVE_UINT_TYPE size, bool waitForDone = true);
+
+            //! Retire completed writes, returning their buffers. With block set, waits for at least one
+            //! if any are in flight.
+            //! \return number of writes retired
+            NATIVE_UINT_TYPE complete(bool block);
+
+            //! Wait until every submitted write has completed
+            void flush(void);
+
+            //! Report the first write that failed since the last call: the File::Status of the failure, with the
+            //! bytes written and requested. Returns OP_OK, and leaves the sizes alone, if none failed.
+            File::Status getWriteStatus(NATIVE_UINT_TYPE& written, NATIVE_UINT_TYPE& requested);
+
+            //! The File::Status closest to an AsyncStatus, for reporting both kinds of failure the same way
+            static File::Status toFileStatus(AsyncStatus status);
+
+            //! Wait for the writes in flight and close the file
+            void close(void);
+
+            NATIVE_UINT_TYPE getInFlight(void) const; //!< number of writes submitted and not yet retired
+            NATIVE_UINT_TYPE getBufferSize(void) const; //!< size of each buffer
+            bool usingUring(void) const; //!< true if the io_uring backend was started
+            U32 getWriteCalls(void) const; //!< writes submitted since construction
+            U64 getBytesWritten(void) const; //!< bytes submitted since construction
+
+        private:
+
+            //! State of one buffer
+            struct Slot {
+                U64 offset; //!< file offset of the submitted write
+                NATIVE_UINT_TYPE size; //!< bytes submitted
+                NATIVE_INT_TYPE result; //!< bytes written, or -errno
+                NATIVE_UINT_TYPE pending; //!< backend completions still to come
+                bool sync; //!< wait for the data to reach the disk
+            };
+
+            bool startUring(void);
+            void stopUring(void);
+            bool submitUring(NATIVE_UINT_TYPE index);
+            NATIVE_UINT_TYPE reapUring(bool block);
+
+            bool startWorkers(NATIVE_UINT_TYPE numWorkers);
+            void stopWorkers(void);
+            void submitWorkers(NATIVE_UINT_TYPE index);
+            NATIVE_UINT_TYPE reapWorkers(bool block);
+            static void* workerTask(void* ptr); //!< Worker thread entry point
+
+            void retire(NATIVE_UINT_TYPE index); //!< record the result of a completed write and free its buffer
+            void release(NATIVE_UINT_TYPE index); //!< return a buffer to the free set
+            void destroy(void);
+
+            File m_file; //!< The file being written
+            U64 m_offset; //!< offset of the next submission
+            U8* m_memory; //!< memory of all buffers
+            NATIVE_UINT_TYPE m_depth; //!< number of buffers
+            NATIVE_UINT_TYPE m_bufferSize; //!< size of each buffer
+            NATIVE_UINT_TYPE m_stride; //!< distance between buffers in m_memory
+            Slot* m_slots; //!< state of each buffer
+            NATIVE_UINT_TYPE* m_free; //!< stack of free buffer indices
+            NATIVE_UINT_TYPE m_numFree; //!< entries in m_free
+            NATIVE_UINT_TYPE m_inFlight; //!< writes submitted and not yet retired
+            File::Status m_writeStatus; //!< first failure since getWriteStatus
+            NATIVE_UINT_TYPE m_failedWritten; //!< bytes written by that failure
+            NATIVE_UINT_TYPE m_failedRequested; //!< bytes requested by that failure
+            U32 m_writeCalls; //!< writes submitted
+            U64 m_bytesWritten; //!< bytes submitted
+            bool m_uring; //!< io_uring backend in use
+            POINTER_CAST m_handle; //!< backend state
+
+            AsyncFile(const AsyncFile&); //!< Disabled copy constructor
+            AsyncFile& operator=(const AsyncFile&); //!< Disabled assignment
+    };
+
+}
+
+#endif
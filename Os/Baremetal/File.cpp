@@ -34,6 +34,14 @@ namespace Os {
         return NOT_OPENED;
     }
 
+    File::Status File::writeAt(const void * buffer, NATIVE_INT_TYPE &size, NATIVE_UINT_TYPE offset) {
+        return NOT_OPENED;
+    }
+
+    File::Status File::flushData() {
+        return NOT_OPENED;
+    }
+
     void File::close(void) {}
 
     NATIVE_INT_TYPE File::getLastError(void) {
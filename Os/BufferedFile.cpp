@@ -0,0 +1,182 @@
+#include <Os/BufferedFile.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <string.h>
+
+namespace Os {
+
+    BufferedFile::BufferedFile() :
+        m_buffer(NULL),
+        m_blockSize(0),
+        m_fill(0),
+        m_policy(SYNC_ON_FLUSH),
+        m_unsynced(false),
+        m_writeCalls(0),
+        m_bytesWritten(0) {
+    }
+
+    BufferedFile::~BufferedFile() {
+        if (this->isOpen()) {
+            (void) this->close();
+        }
+        delete[] this->m_buffer;
+    }
+
+    bool BufferedFile::create(NATIVE_UINT_TYPE blockSize, SyncPolicy policy) {
+        FW_ASSERT(not this->isOpen());
+        delete[] this->m_buffer;
+        this->m_buffer = NULL;
+        this->m_blockSize = 0;
+        this->m_fill = 0;
+        if (blockSize == 0) {
+            return false;
+        }
+        this->m_buffer = new U8[blockSize];
+        if (NULL == this->m_buffer) {
+            return false;
+        }
+        this->m_blockSize = blockSize;
+        this->m_policy = policy;
+        return true;
+    }
+
+    File::Status BufferedFile::open(const char* fileName, File::Mode mode) {
+        this->m_fill = 0;
+        this->m_unsynced = false;
+        return this->m_file.open(fileName, mode);
+    }
+
+    bool BufferedFile::isOpen(void) {
+        return this->m_file.isOpen();
+    }
+
+    File::Status BufferedFile::writeThrough(const U8* data, NATIVE_UINT_TYPE size, bool waitForDone) {
+        // File::write makes one call, which may write less than asked for
+        while (size > 0) {
+            NATIVE_INT_TYPE written = size;
+            File::Status stat = this->m_file.write(data, written, waitForDone);
+            this->m_writeCalls++;
+            if (stat != File::OP_OK) {
+                return stat;
+            }
+            if (written <= 0) {
+                return File::NO_SPACE;
+            }
+            this->m_bytesWritten += written;
+            data += written;
+            size -= written;
+        }
+        this->m_unsynced = true;
+        if (SYNC_ON_WRITE == this->m_policy) {
+            this->m_unsynced = false;
+            return this->m_file.flushData();
+        }
+        return File::OP_OK;
+    }
+
+    File::Status BufferedFile::writeBlock(void) {
+        const NATIVE_UINT_TYPE fill = this->m_fill;
+        this->m_fill = 0;
+        return this->writeThrough(this->m_buffer, fill, false);
+    }
+
+    File::Status BufferedFile::write(const void* buffer, NATIVE_INT_TYPE& size) {
+        FW_ASSERT(buffer != NULL);
+        if (not this->isOpen()) {
+            size = 0;
+            return File::NOT_OPENED;
+        }
+        if (size <= 0) {
+            size = 0;
+            return File::BAD_SIZE;
+        }
+
+        // Not buffered: a single File::write, as if this were an Os::File
+        if (NULL == this->m_buffer) {
+            File::Status stat = this->m_file.write(buffer, size, true);
+            this->m_writeCalls++;
+            if (File::OP_OK == stat) {
+                this->m_bytesWritten += size;
+            }
+            return stat;
+        }
+
+        const U8* data = static_cast<const U8*>(buffer);
+        NATIVE_UINT_TYPE remaining = size;
+        File::Status stat = File::OP_OK;
+
+        // Top up the block, and write it if that fills it
+        if (this->m_fill > 0 || remaining < this->m_blockSize) {
+            NATIVE_UINT_TYPE copy = this->m_blockSize - this->m_fill;
+            if (copy > remaining) {
+                copy = remaining;
+            }
+            memcpy(&this->m_buffer[this->m_fill], data, copy);
+            this->m_fill += copy;
+            data += copy;
+            remaining -= copy;
+            if (this->m_fill == this->m_blockSize) {
+                stat = this->writeBlock();
+            }
+        }
+        // Write whole blocks without copying them, then buffer the rest
+        if (File::OP_OK == stat && remaining >= this->m_blockSize) {
+            const NATIVE_UINT_TYPE whole = remaining - (remaining % this->m_blockSize);
+            stat = this->writeThrough(data, whole, false);
+            data += whole;
+            remaining -= whole;
+        }
+        if (File::OP_OK == stat && remaining > 0) {
+            memcpy(this->m_buffer, data, remaining);
+            this->m_fill = remaining;
+        }
+
+        if (stat != File::OP_OK) {
+            this->m_fill = 0;
+            size = 0;
+        }
+        return stat;
+    }
+
+    File::Status BufferedFile::flush(void) {
+        if (not this->isOpen()) {
+            return File::NOT_OPENED;
+        }
+        File::Status stat = File::OP_OK;
+        if (this->m_fill > 0) {
+            stat = this->writeBlock();
+        }
+        if (File::OP_OK == stat && SYNC_ON_FLUSH == this->m_policy && this->m_unsynced) {
+            this->m_unsynced = false;
+            stat = this->m_file.flushData();
+        }
+        return stat;
+    }
+
+    File::Status BufferedFile::close(void) {
+        File::Status stat = File::OP_OK;
+        if (this->isOpen()) {
+            stat = this->flush();
+        }
+        this->m_file.close();
+        this->m_fill = 0;
+        return stat;
+    }
+
+    NATIVE_UINT_TYPE BufferedFile::getBlockSize(void) const {
+        return this->m_blockSize;
+    }
+
+    NATIVE_UINT_TYPE BufferedFile::getBuffered(void) const {
+        return this->m_fill;
+    }
+
+    U32 BufferedFile::getWriteCalls(void) const {
+        return this->m_writeCalls;
+    }
+
+    U64 BufferedFile::getBytesWritten(void) const {
+        return this->m_bytesWritten;
+    }
+
+}
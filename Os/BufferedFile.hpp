@@ -0,0 +1,83 @@
+/**
+ * BufferedFile.hpp:
+ *
+ * Coalesces small writes to an Os::File into blocks. Writes are copied into a block buffer and handed to the
+ * operating system one full block at a time, or when flush or close is called, so a logger that writes a length
+ * and then a record makes one write call per block instead of two per record. Writes of at least a block skip the
+ * buffer.
+ *
+ * Until create is called no buffer exists and every write goes straight to File::write, waiting for the data to
+ * reach the disk as File::write does. Either way the file counts its write calls and bytes, for telemetry.
+ */
+#ifndef _BUFFERED_FILE_HPP_
+#define _BUFFERED_FILE_HPP_
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Os/File.hpp>
+
+namespace Os {
+
+    class BufferedFile {
+        public:
+
+            typedef enum {
+                SYNC_NONE, //!< Leave writing back to the operating system
+                SYNC_ON_FLUSH, //!< Sync the file data to disk on flush and close
+                SYNC_ON_WRITE //!< Sync the file data to disk after every block
+            } SyncPolicy;
+
+            BufferedFile();
+            ~BufferedFile(); //!< Flushes and closes the file if still open
+
+            //! Allocate the block buffer. Must not be called while a file is open.
+            //! \return true if the buffer was allocated
+            bool create(
+                    NATIVE_UINT_TYPE blockSize, //!< size of the blocks handed to the operating system
+                    SyncPolicy policy = SYNC_ON_FLUSH //!< when to sync the file data to disk
+                    );
+
+            //! Open a file, as File::open
+            File::Status open(const char* fileName, File::Mode mode);
+
+            bool isOpen(void); //!< check if a file is open
+
+            //! Write size bytes. On success all of them are accepted and size is unchanged. On failure size is
+            //! set to 0 and any data still buffered is dropped, as it can no longer be written in order.
+            File::Status write(const void* buffer, NATIVE_INT_TYPE& size);
+
+            //! Hand buffered data to the operating system and apply the sync policy
+            File::Status flush(void);
+
+            //! Flush and close the file
+            //! \return the status of the flush
+            File::Status close(void);
+
+            NATIVE_UINT_TYPE getBlockSize(void) const; //!< block size, or 0 if writes are not buffered
+            NATIVE_UINT_TYPE getBuffered(void) const; //!< bytes waiting in the buffer
+            U32 getWriteCalls(void) const; //!< write calls made to the operating system since construction
+            U64 getBytesWritten(void) const; //!< bytes written by those calls
+
+        private:
+
+            //! Write data straight to the file, repeating until all of it is written
+            File::Status writeThrough(const U8* data, NATIVE_UINT_TYPE size, bool waitForDone);
+
+            //! Write the buffered data
+            File::Status writeBlock(void);
+
+            File m_file; //!< The file being written
+            U8* m_buffer; //!< block buffer, or NULL if writes are not buffered
+            NATIVE_UINT_TYPE m_blockSize; //!< size of m_buffer
+            NATIVE_UINT_TYPE m_fill; //!< bytes in m_buffer
+            SyncPolicy m_policy; //!< when to sync
+            bool m_unsynced; //!< data written since the last sync
+            U32 m_writeCalls; //!< write calls made
+            U64 m_bytesWritten; //!< bytes written
+
+            BufferedFile(const BufferedFile&); //!< Disabled copy constructor
+            BufferedFile& operator=(const BufferedFile&); //!< Disabled assignment
+    };
+
+}
+
+#endif
@@ -39,10 +39,13 @@ namespace Os {
             bool isOpen(void); //!< check if file descriptor is open or not.
             Status seek(NATIVE_INT_TYPE offset, bool absolute = true); //!<  seek to location. If absolute = true, absolute from beginning of file
             Status flush(); //!< flush data to disk. No-op on systems that do not support.
+            Status flushData(); //!< flush data to disk, skipping metadata not needed to read it back. Same as flush on systems that do not distinguish.
             Status read(void * buffer, NATIVE_INT_TYPE &size, bool waitForFull = true); //!<  read data from file; returns amount read or errno.
                                                                             //!<  waitForFull = true to wait for all bytes to be read
                                                                             // size is modified to actual read size
             Status write(const void * buffer, NATIVE_INT_TYPE &size, bool waitForDone = true); //!<  write size; will return amount written or errno
+            Status writeAt(const void * buffer, NATIVE_INT_TYPE &size, NATIVE_UINT_TYPE offset); //!< write size bytes at offset, leaving the file position alone
+                                                                            // size is modified to actual write size
             Status bulkWrite(const void * buffer, NATIVE_UINT_TYPE &totalSize, NATIVE_INT_TYPE chunkSize); //!<  write size; will return amount written or errno
 
             void close(void); //!<  close file
@@ -55,6 +58,8 @@ namespace Os {
 
         private:
 
+            friend class AsyncFile; //!< AsyncFile writes to the descriptor from its backend
+
             NATIVE_INT_TYPE m_fd; //!<  Stored file descriptor
             Mode m_mode; //!<  Stores mode for error checking
             NATIVE_INT_TYPE m_lastError; //!<  stores last error
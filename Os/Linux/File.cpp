@@ -306,6 +306,46 @@ namespace Os {
         return stat;
     }
 
+    File::Status File::writeAt(const void * buffer, NATIVE_INT_TYPE &size, NATIVE_UINT_TYPE offset) {
+
+        // make sure it has been opened
+        if (OPEN_NO_MODE == this->m_mode) {
+            size = 0;
+            return NOT_OPENED;
+        }
+        if (size <= 0) {
+            size = 0;
+            return BAD_SIZE;
+        }
+
+        Status stat = OP_OK;
+        NATIVE_INT_TYPE maxIters = size*2; // loop limit; couldn't block more times than number of bytes
+        while (maxIters > 0) {
+            const ssize_t writeSize = ::pwrite(this->m_fd, buffer, size, offset);
+
+            if (-1 == writeSize) {
+                switch (errno) {
+                    case EINTR: // write was interrupted
+                        maxIters--; // decrement loop count
+                        continue;
+                    case ENOSPC:
+                        stat = NO_SPACE;
+                        break;
+                    default:
+                        stat = OTHER_ERROR;
+                        break;
+                }
+                this->m_lastError = errno;
+                size = 0;
+            } else {
+                size = writeSize;
+            }
+            break; // break out of while loop
+        }
+
+        return stat;
+    }
+
     // NOTE(mereweth) - see http://lkml.iu.edu/hypermail/linux/kernel/1005.2/01845.html
     // recommendation from Linus Torvalds, but doesn't seem to be that fast
     File::Status File::bulkWrite(const void * buffer, NATIVE_UINT_TYPE &totalSize,
@@ -396,6 +436,34 @@ namespace Os {
         return stat;
     }
 
+    File::Status File::flushData() {
+        // make sure it has been opened
+        if (OPEN_NO_MODE == this->m_mode) {
+            return NOT_OPENED;
+        }
+
+        File::Status stat = OP_OK;
+
+#ifdef __linux__
+        NATIVE_INT_TYPE ret = fdatasync(this->m_fd);
+#else
+        NATIVE_INT_TYPE ret = fsync(this->m_fd);
+#endif
+        if (-1 == ret) {
+            this->m_lastError = errno;
+            switch (errno) {
+                case ENOSPC:
+                    stat = NO_SPACE;
+                    break;
+                default:
+                    stat = OTHER_ERROR;
+                    break;
+            }
+        }
+
+        return stat;
+    }
+
     void File::close(void) {
         if ((this->m_fd != -1) and (this->m_mode != OPEN_NO_MODE)) {
             (void)::close(this->m_fd);
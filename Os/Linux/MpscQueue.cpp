@@ -0,0 +1,264 @@
+#include <Os/MpscQueue.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <errno.h>
+#include <linux/futex.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#define CAS(a_ptr, a_oldVal, a_newVal) __sync_bool_compare_and_swap(a_ptr, a_oldVal, a_newVal)
+
+namespace Os {
+
+    // Block while *word == value. Callers recheck their condition after every return.
+    static void futexWait(volatile U32* word, U32 value) {
+        (void) syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+    }
+
+    static void futexWake(volatile U32* word) {
+        long ret = syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        FW_ASSERT(ret >= 0, errno);
+    }
+
+    MpscQueue::MpscQueue() :
+        m_lanes(NULL),
+        m_numLanes(0),
+        m_laneMask(0),
+        m_depth(0),
+        m_msgSize(0),
+        m_count(0),
+        m_maxCount(0),
+        m_notEmpty(0),
+        m_consumerWaiting(0),
+        m_notFull(0),
+        m_producersWaiting(0),
+        m_producerWakes(0),
+        m_receiving(0) {
+    }
+
+    MpscQueue::~MpscQueue() {
+        this->destroy();
+    }
+
+    void MpscQueue::destroy() {
+        if (this->m_lanes != NULL) {
+            for (NATIVE_UINT_TYPE lane = 0; lane < this->m_numLanes; lane++) {
+                delete[] this->m_lanes[lane].cells;
+                delete[] this->m_lanes[lane].data;
+            }
+            delete[] this->m_lanes;
+            this->m_lanes = NULL;
+        }
+    }
+
+    Queue::QueueStatus MpscQueue::create(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize, NATIVE_INT_TYPE numLanes) {
+        this->destroy();
+        if (depth <= 0 || msgSize < 0 || numLanes <= 0) {
+            return Queue::QUEUE_UNINITIALIZED;
+        }
+
+        // Each lane can hold the whole depth, so a send that has reserved room
+        // always finds a free cell in its lane
+        NATIVE_UINT_TYPE ringSize = 1;
+        while (ringSize < static_cast<NATIVE_UINT_TYPE>(depth)) {
+            ringSize <<= 1;
+        }
+
+        this->m_depth = depth;
+        this->m_msgSize = msgSize;
+        this->m_numLanes = numLanes;
+        this->m_laneMask = ringSize - 1;
+        this->m_count = 0;
+        this->m_maxCount = 0;
+
+        this->m_lanes = new Lane[numLanes];
+        if (NULL == this->m_lanes) {
+            return Queue::QUEUE_UNINITIALIZED;
+        }
+        for (NATIVE_UINT_TYPE lane = 0; lane < this->m_numLanes; lane++) {
+            Lane& entry = this->m_lanes[lane];
+            entry.enqueuePos = 0;
+            entry.dequeuePos = 0;
+            entry.cells = new Cell[ringSize];
+            entry.data = new U8[ringSize * msgSize];
+            if (NULL == entry.cells || NULL == entry.data) {
+                return Queue::QUEUE_UNINITIALIZED;
+            }
+            for (NATIVE_UINT_TYPE cell = 0; cell < ringSize; cell++) {
+                entry.cells[cell].sequence = cell;
+            }
+        }
+        return Queue::QUEUE_OK;
+    }
+
+    Queue::QueueStatus MpscQueue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority,
+                                       Queue::QueueBlocking block) {
+        if (NULL == this->m_lanes) {
+            return Queue::QUEUE_UNINITIALIZED;
+        }
+        if (NULL == buffer) {
+            return Queue::QUEUE_EMPTY_BUFFER;
+        }
+        if (size < 0 || static_cast<NATIVE_UINT_TYPE>(size) > this->m_msgSize) {
+            return Queue::QUEUE_SIZE_MISMATCH;
+        }
+
+        // Reserve room for the message, waiting for the consumer if full
+        U32 count;
+        while (true) {
+            count = this->m_count;
+            if (count < this->m_depth) {
+                if (CAS(&this->m_count, count, count + 1)) {
+                    break;
+                }
+                continue;
+            }
+            if (Queue::QUEUE_NONBLOCKING == block) {
+                return Queue::QUEUE_FULL;
+            }
+            U32 seen = this->m_notFull;
+            (void) __sync_fetch_and_add(&this->m_producersWaiting, 1);
+            if (this->m_count >= this->m_depth) {
+                futexWait(&this->m_notFull, seen);
+            }
+            (void) __sync_fetch_and_sub(&this->m_producersWaiting, 1);
+            // consume a wake meant for a waiting producer, if one is pending
+            U32 wakes = this->m_producerWakes;
+            while (wakes > 0 && not CAS(&this->m_producerWakes, wakes, wakes - 1)) {
+                wakes = this->m_producerWakes;
+            }
+        }
+
+        // Update the high watermark
+        U32 maxCount = this->m_maxCount;
+        while ((count + 1 > maxCount) && not CAS(&this->m_maxCount, maxCount, count + 1)) {
+            maxCount = this->m_maxCount;
+        }
+
+        // Claim a cell in the lane
+        NATIVE_UINT_TYPE laneIndex = (priority < 0) ? 0 : static_cast<NATIVE_UINT_TYPE>(priority);
+        if (laneIndex >= this->m_numLanes) {
+            laneIndex = this->m_numLanes - 1;
+        }
+        Lane& lane = this->m_lanes[laneIndex];
+        U32 pos = lane.enqueuePos;
+        Cell* cell;
+        while (true) {
+            cell = &lane.cells[pos & this->m_laneMask];
+            I32 diff = static_cast<I32>(cell->sequence - pos);
+            // the reservation above guarantees the consumer has released the cell
+            FW_ASSERT(diff >= 0, diff);
+            if (diff == 0 && CAS(&lane.enqueuePos, pos, pos + 1)) {
+                break;
+            }
+            pos = lane.enqueuePos;
+        }
+
+        // Fill and publish the cell
+        memcpy(&lane.data[(pos & this->m_laneMask) * this->m_msgSize], buffer, size);
+        cell->size = size;
+        cell->priority = priority;
+        __sync_synchronize();
+        cell->sequence = pos + 1;
+
+        // Wake the consumer if it may be blocked. Only one producer makes the call.
+        __sync_synchronize();
+        if (this->m_consumerWaiting && CAS(&this->m_consumerWaiting, 1, 0)) {
+            (void) __sync_fetch_and_add(&this->m_notEmpty, 1);
+            futexWake(&this->m_notEmpty);
+        }
+        return Queue::QUEUE_OK;
+    }
+
+    bool MpscQueue::tryReceive(U8* buffer, NATIVE_UINT_TYPE capacity, NATIVE_INT_TYPE &actualSize,
+                               NATIVE_INT_TYPE &priority, Queue::QueueStatus &status) {
+        for (NATIVE_UINT_TYPE laneIndex = this->m_numLanes; laneIndex > 0; laneIndex--) {
+            Lane& lane = this->m_lanes[laneIndex - 1];
+            Cell* cell = &lane.cells[lane.dequeuePos & this->m_laneMask];
+            if (static_cast<I32>(cell->sequence - (lane.dequeuePos + 1)) < 0) {
+                // empty, or the next message is still being written
+                continue;
+            }
+            __sync_synchronize();
+            if (cell->size > capacity) {
+                // leave the message queued
+                status = Queue::QUEUE_SIZE_MISMATCH;
+                return true;
+            }
+            memcpy(buffer, &lane.data[(lane.dequeuePos & this->m_laneMask) * this->m_msgSize], cell->size);
+            actualSize = cell->size;
+            priority = cell->priority;
+
+            // Release the cell for the next lap, then the reservation
+            __sync_synchronize();
+            cell->sequence = lane.dequeuePos + this->m_laneMask + 1;
+            lane.dequeuePos++;
+            (void) __sync_fetch_and_sub(&this->m_count, 1);
+            // Wake a producer unless every waiting producer already has a wake
+            // pending. Otherwise the consumer would make a wake call for every
+            // message until the producers run.
+            if (this->m_producersWaiting > this->m_producerWakes) {
+                (void) __sync_fetch_and_add(&this->m_producerWakes, 1);
+                (void) __sync_fetch_and_add(&this->m_notFull, 1);
+                futexWake(&this->m_notFull);
+            }
+            status = Queue::QUEUE_OK;
+            return true;
+        }
+        return false;
+    }
+
+    Queue::QueueStatus MpscQueue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize,
+                                          NATIVE_INT_TYPE &priority, Queue::QueueBlocking block) {
+        if (NULL == this->m_lanes) {
+            return Queue::QUEUE_UNINITIALIZED;
+        }
+        if (capacity < 0) {
+            return Queue::QUEUE_SIZE_MISMATCH;
+        }
+        // ONLY ONE RECEIVER AT A TIME
+        const bool claimed = CAS(&this->m_receiving, 0, 1);
+        FW_ASSERT(claimed);
+
+        Queue::QueueStatus status = Queue::QUEUE_NO_MORE_MSGS;
+        actualSize = 0;
+        while (not this->tryReceive(buffer, capacity, actualSize, priority, status)) {
+            if (Queue::QUEUE_NONBLOCKING == block) {
+                break;
+            }
+            // Announce the wait, then check again so a message published in
+            // between is either seen here or wakes the futex
+            U32 seen = this->m_notEmpty;
+            this->m_consumerWaiting = 1;
+            __sync_synchronize();
+            if (this->tryReceive(buffer, capacity, actualSize, priority, status)) {
+                this->m_consumerWaiting = 0;
+                break;
+            }
+            futexWait(&this->m_notEmpty, seen);
+            this->m_consumerWaiting = 0;
+        }
+
+        __sync_synchronize();
+        this->m_receiving = 0;
+        return status;
+    }
+
+    NATIVE_INT_TYPE MpscQueue::getNumMsgs(void) const {
+        return this->m_count;
+    }
+
+    NATIVE_INT_TYPE MpscQueue::getMaxMsgs(void) const {
+        return this->m_maxCount;
+    }
+
+    NATIVE_INT_TYPE MpscQueue::getQueueSize(void) const {
+        return this->m_depth;
+    }
+
+    NATIVE_INT_TYPE MpscQueue::getMsgSize(void) const {
+        return this->m_msgSize;
+    }
+
+}
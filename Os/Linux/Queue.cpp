@@ -0,0 +1,391 @@
+// ======================================================================
+// \title  Queue.cpp
+// \brief  Queue implementation for Linux using futexes. This is NOT
+//         an IPC queue. It is meant to be used between threads within
+//         the same address space.
+//
+//         Messages are copied into fixed-size slots allocated when the
+//         queue is created. The queue state is guarded by a futex-based
+//         lock, and blocked senders and receivers wait on futex words,
+//         so a send or receive that does not contend and does not need
+//         to wake another thread makes no system calls.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Types/Assert.hpp>
+#include <Os/Queue.hpp>
+
+#include <errno.h>
+#include <linux/futex.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace Os {
+
+  // Block while *word == value. Spurious returns are handled by the callers,
+  // which always recheck the queue state.
+  static void futexWait(volatile U32* word, U32 value) {
+    (void) syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+  }
+
+  static void futexWake(volatile U32* word, NATIVE_INT_TYPE count) {
+    long ret = syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+    FW_ASSERT(ret >= 0, errno); // If this fails, something horrible happened.
+  }
+
+  // A helper class which stores variables for the queue handle.
+  // The message slots, the receive order and the futex words
+  // are contained within this container class.
+  class QueueHandle {
+    public:
+
+    // A queued message. The ring of entries is kept in receive order.
+    struct Entry {
+      NATIVE_UINT_TYPE slot; // slot holding the message data
+      NATIVE_INT_TYPE priority; // message priority
+    };
+
+    QueueHandle() :
+      data(NULL),
+      sizes(NULL),
+      ring(NULL),
+      freeSlots(NULL),
+      numFree(0),
+      head(0),
+      count(0),
+      maxCount(0),
+      depth(0),
+      msgSize(0),
+      lockWord(0),
+      notEmpty(0),
+      notFull(0),
+      emptyWaiters(0),
+      fullWaiters(0),
+      emptyWakes(0),
+      fullWakes(0) {
+    }
+    ~QueueHandle() {
+      delete [] this->data;
+      delete [] this->sizes;
+      delete [] this->ring;
+      delete [] this->freeSlots;
+    }
+    bool create(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+      if (depth <= 0 || msgSize < 0) {
+        return false;
+      }
+      this->depth = depth;
+      this->msgSize = msgSize;
+      this->data = new U8[depth*msgSize];
+      this->sizes = new NATIVE_UINT_TYPE[depth];
+      this->ring = new Entry[depth];
+      this->freeSlots = new NATIVE_UINT_TYPE[depth];
+      if (NULL == this->data || NULL == this->sizes || NULL == this->ring || NULL == this->freeSlots) {
+        return false;
+      }
+      for (NATIVE_UINT_TYPE slot = 0; slot < this->depth; slot++) {
+        this->freeSlots[slot] = slot;
+      }
+      this->numFree = this->depth;
+      return true;
+    }
+
+    // Lock from "Futexes Are Tricky" (Drepper). lockWord is 0 when unlocked,
+    // 1 when locked and 2 when locked with possible waiters.
+    void lock() {
+      U32 state = __sync_val_compare_and_swap(&this->lockWord, 0, 1);
+      if (state != 0) {
+        if (state != 2) {
+          state = __sync_lock_test_and_set(&this->lockWord, 2);
+        }
+        while (state != 0) {
+          futexWait(&this->lockWord, 2);
+          state = __sync_lock_test_and_set(&this->lockWord, 2);
+        }
+      }
+    }
+    void unlock() {
+      if (__sync_fetch_and_sub(&this->lockWord, 1) != 1) {
+        this->lockWord = 0;
+        futexWake(&this->lockWord, 1);
+      }
+    }
+
+    // Copy a message into a free slot and insert it behind all messages
+    // of the same or higher priority. Must hold the lock and have room.
+    void push(const U8* buffer, NATIVE_UINT_TYPE size, NATIVE_INT_TYPE priority) {
+      FW_ASSERT(this->numFree > 0, this->numFree);
+      NATIVE_UINT_TYPE slot = this->freeSlots[--this->numFree];
+      memcpy(&this->data[slot*this->msgSize], buffer, size);
+      this->sizes[slot] = size;
+
+      // Equal priorities stay in FIFO order, so the common case of a single
+      // priority never moves an entry
+      NATIVE_UINT_TYPE position = this->count;
+      while (position > 0) {
+        Entry& prev = this->ring[(this->head + position - 1) % this->depth];
+        if (prev.priority >= priority) {
+          break;
+        }
+        this->ring[(this->head + position) % this->depth] = prev;
+        position--;
+      }
+      Entry& entry = this->ring[(this->head + position) % this->depth];
+      entry.slot = slot;
+      entry.priority = priority;
+
+      this->count++;
+      if (this->count > this->maxCount) {
+        this->maxCount = this->count;
+      }
+      // let blocked receivers see the change
+      this->notEmpty++;
+    }
+
+    // Copy out the message at the front of the queue. Must hold the lock and
+    // have a message. Returns false and leaves the message queued when the
+    // buffer is too small.
+    bool pop(U8* buffer, NATIVE_UINT_TYPE capacity, NATIVE_UINT_TYPE& size, NATIVE_INT_TYPE& priority) {
+      FW_ASSERT(this->count > 0, this->count);
+      const Entry& entry = this->ring[this->head];
+      size = this->sizes[entry.slot];
+      if (size > capacity) {
+        return false;
+      }
+      memcpy(buffer, &this->data[entry.slot*this->msgSize], size);
+      priority = entry.priority;
+      this->freeSlots[this->numFree++] = entry.slot;
+      this->head = (this->head + 1) % this->depth;
+      this->count--;
+      // let blocked senders see the change
+      this->notFull++;
+      return true;
+    }
+
+    U8* data; // message slots, msgSize bytes each
+    NATIVE_UINT_TYPE* sizes; // size of the message held in each slot
+    Entry* ring; // queued messages in receive order, starting at head
+    NATIVE_UINT_TYPE* freeSlots; // stack of unused slots
+    NATIVE_UINT_TYPE numFree; // number of unused slots
+    NATIVE_UINT_TYPE head; // ring index of the next message to receive
+    NATIVE_UINT_TYPE count; // current number of messages on the queue
+    NATIVE_UINT_TYPE maxCount; // maximum number of messages ever seen on the queue
+    NATIVE_UINT_TYPE depth; // max number of messages on the queue
+    NATIVE_UINT_TYPE msgSize; // max size of message on the queue
+    volatile U32 lockWord; // futex word for the queue lock
+    volatile U32 notEmpty; // futex word bumped on every send
+    volatile U32 notFull; // futex word bumped on every receive
+    NATIVE_UINT_TYPE emptyWaiters; // receivers blocked on notEmpty
+    NATIVE_UINT_TYPE fullWaiters; // senders blocked on notFull
+    NATIVE_UINT_TYPE emptyWakes; // wakes sent to receivers that have not run yet
+    NATIVE_UINT_TYPE fullWakes; // wakes sent to senders that have not run yet
+  };
+
+  Queue::Queue() :
+    m_handle((POINTER_CAST) NULL) {
+  }
+
+  Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+    QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+
+    // Queue has already been created... remove it and try again:
+    if (NULL != queueHandle) {
+        delete queueHandle;
+        queueHandle = NULL;
+        this->m_handle = (POINTER_CAST) NULL;
+    }
+
+    // Create queue handle:
+    queueHandle = new QueueHandle;
+    if (NULL == queueHandle) {
+      return QUEUE_UNINITIALIZED;
+    }
+    if( !queueHandle->create(depth, msgSize) ) {
+      delete queueHandle;
+      return QUEUE_UNINITIALIZED;
+    }
+    this->m_handle = (POINTER_CAST) queueHandle;
+
+#if FW_QUEUE_REGISTRATION
+    if (this->s_queueRegistry) {
+        this->s_queueRegistry->regQueue(this);
+    }
+#endif
+
+    return QUEUE_OK;
+  }
+
+  Queue::~Queue() {
+    // Clean up the queue handle:
+    QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+    if (NULL != queueHandle) {
+      delete queueHandle;
+    }
+    this->m_handle = (POINTER_CAST) NULL;
+  }
+
+  Queue::QueueStatus Queue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority, QueueBlocking block) {
+    QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+
+    if (NULL == queueHandle) {
+        return QUEUE_UNINITIALIZED;
+    }
+
+    if (NULL == buffer) {
+        return QUEUE_EMPTY_BUFFER;
+    }
+
+    if (size < 0 || (NATIVE_UINT_TYPE) size > queueHandle->msgSize) {
+        return QUEUE_SIZE_MISMATCH;
+    }
+
+    ////////////////////////////////
+    // Locked Section
+    ///////////////////////////////
+    queueHandle->lock();
+    ///////////////////////////////
+
+    // If the queue is full, fail or wait until a message is taken off the queue:
+    while (queueHandle->count == queueHandle->depth) {
+      if (QUEUE_NONBLOCKING == block) {
+        queueHandle->unlock();
+        return QUEUE_FULL;
+      }
+      U32 seen = queueHandle->notFull;
+      queueHandle->fullWaiters++;
+      queueHandle->unlock();
+      futexWait(&queueHandle->notFull, seen);
+      queueHandle->lock();
+      queueHandle->fullWaiters--;
+      if (queueHandle->fullWakes > 0) {
+        queueHandle->fullWakes--;
+      }
+    }
+
+    queueHandle->push(buffer, size, priority);
+    // Only wake receivers that have not already been woken. Otherwise a fast
+    // sender makes a wake system call for every message until the receiver runs.
+    bool wake = (queueHandle->emptyWaiters > queueHandle->emptyWakes);
+    if (wake) {
+      queueHandle->emptyWakes++;
+    }
+
+    ///////////////////////////////
+    queueHandle->unlock();
+    ////////////////////////////////
+    ///////////////////////////////
+
+    // Wake up a thread that might be waiting on the other end of the queue:
+    if (wake) {
+      futexWake(&queueHandle->notEmpty, 1);
+    }
+
+    return QUEUE_OK;
+  }
+
+  Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block) {
+    QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+
+    if (NULL == queueHandle) {
+      return QUEUE_UNINITIALIZED;
+    }
+
+    // Do not need to check the upper bound of capacity, We don't care
+    // how big the user's buffer is.. as long as it's big enough.
+    if (capacity < 0) {
+        return QUEUE_SIZE_MISMATCH;
+    }
+
+    NATIVE_UINT_TYPE size = 0;
+    NATIVE_INT_TYPE pri = 0;
+
+    ////////////////////////////////
+    // Locked Section
+    ///////////////////////////////
+    queueHandle->lock();
+    ///////////////////////////////
+
+    // If the queue is empty, fail or wait until a message is put on the queue:
+    while (queueHandle->count == 0) {
+      if (QUEUE_NONBLOCKING == block) {
+        queueHandle->unlock();
+        actualSize = 0;
+        return QUEUE_NO_MORE_MSGS;
+      }
+      U32 seen = queueHandle->notEmpty;
+      queueHandle->emptyWaiters++;
+      queueHandle->unlock();
+      futexWait(&queueHandle->notEmpty, seen);
+      queueHandle->lock();
+      queueHandle->emptyWaiters--;
+      if (queueHandle->emptyWakes > 0) {
+        queueHandle->emptyWakes--;
+      }
+    }
+
+    if (not queueHandle->pop(buffer, capacity, size, pri)) {
+      // The buffer capacity was too small!
+      queueHandle->unlock();
+      actualSize = 0;
+      return QUEUE_SIZE_MISMATCH;
+    }
+    bool wake = (queueHandle->fullWaiters > queueHandle->fullWakes);
+    if (wake) {
+      queueHandle->fullWakes++;
+    }
+
+    ///////////////////////////////
+    queueHandle->unlock();
+    ////////////////////////////////
+    ///////////////////////////////
+
+    actualSize = (NATIVE_INT_TYPE) size;
+    priority = pri;
+
+    // Wake up a thread that might be waiting on the send end of the queue:
+    if (wake) {
+      futexWake(&queueHandle->notFull, 1);
+    }
+
+    return QUEUE_OK;
+  }
+
+  NATIVE_INT_TYPE Queue::getNumMsgs(void) const {
+      QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return queueHandle->count;
+  }
+
+  NATIVE_INT_TYPE Queue::getMaxMsgs(void) const {
+      QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return queueHandle->maxCount;
+  }
+
+  NATIVE_INT_TYPE Queue::getQueueSize(void) const {
+      QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return queueHandle->depth;
+  }
+
+  NATIVE_INT_TYPE Queue::getMsgSize(void) const {
+      QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return queueHandle->msgSize;
+  }
+
+}
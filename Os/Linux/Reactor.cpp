@@ -0,0 +1,128 @@
+// ======================================================================
+// \title  Reactor.cpp
+// \brief  Reactor implementation for Linux using epoll. The reactor
+//         task blocks in epoll_wait, and an eventfd in the wait set
+//         lets stop wake it.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Os/Reactor.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace Os {
+
+    Reactor::Reactor() :
+        m_pollFd(-1),
+        m_wakeFd(-1),
+        m_stop(false) {
+    }
+
+    Reactor::~Reactor() {
+        if (this->m_wakeFd != -1) {
+            (void) ::close(this->m_wakeFd);
+        }
+        if (this->m_pollFd != -1) {
+            (void) ::close(this->m_pollFd);
+        }
+    }
+
+    Reactor::ReactorStatus Reactor::create(void) {
+        FW_ASSERT(this->m_pollFd == -1);
+        this->m_pollFd = ::epoll_create1(EPOLL_CLOEXEC);
+        if (this->m_pollFd == -1) {
+            return REACTOR_ERROR;
+        }
+        this->m_wakeFd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (this->m_wakeFd == -1) {
+            return REACTOR_ERROR;
+        }
+        // The wake descriptor is the only one registered without a handler
+        struct epoll_event event;
+        event.events = EPOLLIN;
+        event.data.ptr = NULL;
+        if (::epoll_ctl(this->m_pollFd, EPOLL_CTL_ADD, this->m_wakeFd, &event) == -1) {
+            return REACTOR_ERROR;
+        }
+        return REACTOR_OK;
+    }
+
+    Reactor::ReactorStatus Reactor::add(NATIVE_INT_TYPE fd, Handler* handler) {
+        FW_ASSERT(handler != NULL);
+        if (this->m_pollFd == -1) {
+            return REACTOR_UNINITIALIZED;
+        }
+        struct epoll_event event;
+        event.events = EPOLLIN;
+        event.data.ptr = handler;
+        if (::epoll_ctl(this->m_pollFd, EPOLL_CTL_ADD, fd, &event) == -1) {
+            return REACTOR_ERROR;
+        }
+        return REACTOR_OK;
+    }
+
+    Reactor::ReactorStatus Reactor::remove(NATIVE_INT_TYPE fd) {
+        if (this->m_pollFd == -1) {
+            return REACTOR_UNINITIALIZED;
+        }
+        if (::epoll_ctl(this->m_pollFd, EPOLL_CTL_DEL, fd, NULL) == -1) {
+            return REACTOR_ERROR;
+        }
+        return REACTOR_OK;
+    }
+
+    Reactor::ReactorStatus Reactor::poll(NATIVE_INT_TYPE timeoutMs) {
+        if (this->m_pollFd == -1) {
+            return REACTOR_UNINITIALIZED;
+        }
+        struct epoll_event events[MAX_EVENTS];
+        NATIVE_INT_TYPE count = ::epoll_wait(this->m_pollFd, events, MAX_EVENTS, timeoutMs);
+        if (count == -1) {
+            return (errno == EINTR) ? REACTOR_OK : REACTOR_ERROR;
+        }
+        for (NATIVE_INT_TYPE i = 0; i < count && not this->m_stop; i++) {
+            Handler* handler = static_cast<Handler*>(events[i].data.ptr);
+            // NULL is the wake descriptor, which only stop writes
+            if (handler != NULL) {
+                handler->readable();
+            }
+        }
+        return this->m_stop ? REACTOR_STOPPED : REACTOR_OK;
+    }
+
+    Task::TaskStatus Reactor::start(const Fw::StringBase &name, NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize,
+                                    NATIVE_INT_TYPE cpuAffinity) {
+        this->m_stop = false;
+        return this->m_task.start(name, 0, priority, stackSize, Reactor::reactorTask, this, cpuAffinity);
+    }
+
+    void Reactor::stop(void) {
+        this->m_stop = true;
+        const U64 one = 1;
+        ssize_t written = ::write(this->m_wakeFd, &one, sizeof(one));
+        FW_ASSERT(written == sizeof(one), errno);
+    }
+
+    Task::TaskStatus Reactor::join(void) {
+        return this->m_task.join(NULL);
+    }
+
+    void Reactor::reactorTask(void* ptr) {
+        Reactor* reactor = static_cast<Reactor*>(ptr);
+        ReactorStatus status = REACTOR_OK;
+        while (status == REACTOR_OK) {
+            status = reactor->poll(-1);
+        }
+        FW_ASSERT(status == REACTOR_STOPPED, status);
+    }
+
+}
@@ -0,0 +1,64 @@
+/**
+ * MappedFile.hpp:
+ *
+ * A file mapped into memory. A file mapped for writing is created at a fixed size, with its blocks allocated up
+ * front where the file system supports it, so that storing to the mapping cannot run out of space; the caller
+ * fills the mapping with plain memory writes and no system call per write. sync hands a dirty range to the disk,
+ * and close can shrink the file to the part that was used.
+ *
+ * A file mapped for reading is mapped whole, read only.
+ */
+#ifndef _MAPPED_FILE_HPP_
+#define _MAPPED_FILE_HPP_
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Os/File.hpp>
+
+namespace Os {
+
+    class MappedFile {
+        public:
+
+            typedef enum {
+                OPEN_READ, //!< Map an existing file read only
+                OPEN_WRITE //!< Create or truncate a file of a given size and map it for writing
+            } Mode;
+
+            MappedFile();
+            ~MappedFile(); //!< Unmaps and closes the file if still open, at its mapped size
+
+            //! Map a file. For OPEN_WRITE the file is created with size bytes, all zero; for OPEN_READ size is
+            //! ignored and the whole file is mapped.
+            File::Status open(const char* fileName, Mode mode, NATIVE_UINT_TYPE size = 0);
+
+            bool isOpen(void) const; //!< check if a file is mapped
+
+            U8* getData(void) const; //!< start of the mapping, or NULL if no file is mapped
+            NATIVE_UINT_TYPE getSize(void) const; //!< size of the mapping
+
+            //! Write the pages holding length bytes from offset back to the file. With wait set, returns once
+            //! they are on disk; otherwise only schedules the write back.
+            File::Status sync(NATIVE_UINT_TYPE offset, NATIVE_UINT_TYPE length, bool wait = true);
+
+            //! Unmap and close the file. A file mapped for writing is cut to finalSize bytes if that is smaller
+            //! than the mapping.
+            File::Status close(NATIVE_UINT_TYPE finalSize);
+            File::Status close(void); //!< Unmap and close the file, leaving its size
+
+            U32 getSyncCalls(void) const; //!< sync calls made to the operating system since construction
+
+        private:
+
+            NATIVE_INT_TYPE m_fd; //!< file descriptor, or -1
+            U8* m_data; //!< the mapping
+            NATIVE_UINT_TYPE m_size; //!< size of the mapping
+            Mode m_mode; //!< mode the file was mapped with
+            U32 m_syncCalls; //!< sync calls made
+
+            MappedFile(const MappedFile&); //!< Disabled copy constructor
+            MappedFile& operator=(const MappedFile&); //!< Disabled assignment
+    };
+
+}
+
+#endif
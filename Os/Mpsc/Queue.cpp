@@ -0,0 +1,114 @@
+// ======================================================================
+// \title  Queue.cpp
+// \brief  Queue implementation using Os::MpscQueue. This is NOT an IPC
+//         queue. Any number of threads may send without taking a lock,
+//         but only one thread may receive at a time, as is the case for
+//         the queue of an active component. Priorities are mapped onto
+//         the lanes of the MpscQueue.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Os/MpscQueue.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Os/Queue.hpp>
+
+namespace Os {
+
+  Queue::Queue() :
+    m_handle((POINTER_CAST) NULL) {
+  }
+
+  Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+    MpscQueue* queueHandle = (MpscQueue*) this->m_handle;
+
+    // Queue has already been created... remove it and try again:
+    if (NULL != queueHandle) {
+        delete queueHandle;
+        queueHandle = NULL;
+        this->m_handle = (POINTER_CAST) NULL;
+    }
+
+    // Create queue handle:
+    queueHandle = new MpscQueue;
+    if (NULL == queueHandle) {
+      return QUEUE_UNINITIALIZED;
+    }
+    QueueStatus status = queueHandle->create(depth, msgSize);
+    if (QUEUE_OK != status) {
+      delete queueHandle;
+      return status;
+    }
+    this->m_handle = (POINTER_CAST) queueHandle;
+
+#if FW_QUEUE_REGISTRATION
+    if (this->s_queueRegistry) {
+        this->s_queueRegistry->regQueue(this);
+    }
+#endif
+
+    return QUEUE_OK;
+  }
+
+  Queue::~Queue() {
+    // Clean up the queue handle:
+    MpscQueue* queueHandle = (MpscQueue*) this->m_handle;
+    if (NULL != queueHandle) {
+      delete queueHandle;
+    }
+    this->m_handle = (POINTER_CAST) NULL;
+  }
+
+  Queue::QueueStatus Queue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority, QueueBlocking block) {
+    MpscQueue* queueHandle = (MpscQueue*) this->m_handle;
+    if (NULL == queueHandle) {
+        return QUEUE_UNINITIALIZED;
+    }
+    return queueHandle->send(buffer, size, priority, block);
+  }
+
+  Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block) {
+    MpscQueue* queueHandle = (MpscQueue*) this->m_handle;
+    if (NULL == queueHandle) {
+        return QUEUE_UNINITIALIZED;
+    }
+    return queueHandle->receive(buffer, capacity, actualSize, priority, block);
+  }
+
+  NATIVE_INT_TYPE Queue::getNumMsgs(void) const {
+      MpscQueue* queueHandle = (MpscQueue*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return queueHandle->getNumMsgs();
+  }
+
+  NATIVE_INT_TYPE Queue::getMaxMsgs(void) const {
+      MpscQueue* queueHandle = (MpscQueue*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return queueHandle->getMaxMsgs();
+  }
+
+  NATIVE_INT_TYPE Queue::getQueueSize(void) const {
+      MpscQueue* queueHandle = (MpscQueue*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return queueHandle->getQueueSize();
+  }
+
+  NATIVE_INT_TYPE Queue::getMsgSize(void) const {
+      MpscQueue* queueHandle = (MpscQueue*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return queueHandle->getMsgSize();
+  }
+
+}
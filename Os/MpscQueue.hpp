@@ -0,0 +1,95 @@
+/**
+ * MpscQueue.hpp:
+ *
+ * Bounded multi-producer, single-consumer message queue. Any number of threads may send without taking a lock,
+ * while exactly one thread at a time receives. Send and receive follow the Os::Queue semantics and status codes,
+ * so the queue can back the message queue of an active component (see FPRIME_OS_QUEUE=Mpsc).
+ *
+ * Messages are copied into fixed-size slots in one ring per priority lane. Priorities are mapped onto lanes by
+ * clamping to [0, numLanes - 1]; higher lanes are received first and each lane is FIFO. A send claims a slot
+ * with a single compare-and-swap. Blocking receives and sends sleep on futexes and are only woken when needed.
+ */
+#ifndef _MPSC_QUEUE_HPP_
+#define _MPSC_QUEUE_HPP_
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Os/Queue.hpp>
+
+namespace Os {
+
+    class MpscQueue {
+        public:
+
+            enum {
+                DEFAULT_NUM_LANES = 4, //!< lanes used when none are given to create
+                CACHE_LINE = 64 //!< padding between variables written by producers and by the consumer
+            };
+
+            MpscQueue();
+            ~MpscQueue();
+
+            //! Allocate the queue. Must be called before any other method.
+            //! \return QUEUE_OK, or QUEUE_UNINITIALIZED if the arguments are invalid
+            Queue::QueueStatus create(
+                    NATIVE_INT_TYPE depth, //!< maximum number of messages across all lanes
+                    NATIVE_INT_TYPE msgSize, //!< maximum message size
+                    NATIVE_INT_TYPE numLanes = DEFAULT_NUM_LANES //!< number of priority lanes
+                    );
+
+            //! Send a message. Safe to call from any number of threads.
+            Queue::QueueStatus send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority,
+                                    Queue::QueueBlocking block);
+
+            //! Receive the oldest message of the highest non-empty lane. Only one thread may receive at a time.
+            Queue::QueueStatus receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize,
+                                       NATIVE_INT_TYPE &priority, Queue::QueueBlocking block);
+
+            NATIVE_INT_TYPE getNumMsgs(void) const; //!< get the number of messages in the queue
+            NATIVE_INT_TYPE getMaxMsgs(void) const; //!< get the maximum number of messages (high watermark)
+            NATIVE_INT_TYPE getQueueSize(void) const; //!< get the queue depth
+            NATIVE_INT_TYPE getMsgSize(void) const; //!< get the maximum message size
+
+        private:
+
+            //! Slot header. sequence tells producers and the consumer whose turn it is to use the slot.
+            struct Cell {
+                volatile U32 sequence; //!< equals the enqueue position when free, position + 1 when full
+                NATIVE_UINT_TYPE size; //!< size of the stored message
+                NATIVE_INT_TYPE priority; //!< priority given by the sender
+            };
+
+            //! One priority lane: a ring of cells and their message data
+            struct Lane {
+                volatile U32 enqueuePos; //!< next position producers claim
+                U8 pad0[CACHE_LINE - sizeof(U32)];
+                U32 dequeuePos; //!< next position the consumer reads. Consumer only.
+                U8 pad1[CACHE_LINE - sizeof(U32)];
+                Cell* cells; //!< ring of cell headers
+                U8* data; //!< message data, msgSize bytes per cell
+            };
+
+            bool tryReceive(U8* buffer, NATIVE_UINT_TYPE capacity, NATIVE_INT_TYPE &actualSize,
+                            NATIVE_INT_TYPE &priority, Queue::QueueStatus &status);
+            void destroy();
+
+            Lane* m_lanes; //!< priority lanes, lowest priority first
+            NATIVE_UINT_TYPE m_numLanes; //!< number of lanes
+            NATIVE_UINT_TYPE m_laneMask; //!< lane ring size - 1. Ring sizes are a power of two >= depth.
+            NATIVE_UINT_TYPE m_depth; //!< maximum number of messages
+            NATIVE_UINT_TYPE m_msgSize; //!< maximum message size
+            volatile U32 m_count; //!< messages reserved or queued, bounded by m_depth
+            volatile U32 m_maxCount; //!< high watermark of m_count
+            volatile U32 m_notEmpty; //!< futex word bumped to wake a blocked consumer
+            volatile U32 m_consumerWaiting; //!< set while the consumer may be blocked
+            volatile U32 m_notFull; //!< futex word bumped to wake blocked producers
+            volatile U32 m_producersWaiting; //!< number of producers that may be blocked
+            volatile U32 m_producerWakes; //!< wakes sent to producers that have not run yet
+            volatile U32 m_receiving; //!< set while a thread is receiving, to catch a second consumer
+
+            MpscQueue(const MpscQueue&); //!< Disabled copy constructor
+            MpscQueue& operator=(const MpscQueue&); //!< Disabled assignment
+    };
+
+}
+
+#endif
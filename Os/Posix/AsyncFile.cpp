@@ -0,0 +1,710 @@
+#include <Os/AsyncFile.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+// io_uring is used directly through its system calls, so no library is needed
+#ifdef __NR_io_uring_setup
+#include <linux/io_uring.h>
+#define ASYNC_FILE_URING 1
+#endif
+#endif
+
+namespace Os {
+
+    enum {
+        BUFFER_ALIGNMENT = 4096 //!< buffer memory alignment, enough for OPEN_SYNC_DIRECT_WRITE
+    };
+
+    // Translate an errno value as File::write does
+    static File::Status errnoToStatus(NATIVE_INT_TYPE error) {
+        switch (error) {
+            case ENOSPC:
+            case EFBIG:
+                return File::NO_SPACE;
+            case EACCES:
+            case EPERM:
+                return File::NO_PERMISSION;
+            case EBADF:
+                return File::NOT_OPENED;
+            default:
+                return File::OTHER_ERROR;
+        }
+    }
+
+#ifdef ASYNC_FILE_URING
+
+    //! The mapped io_uring queues
+    struct UringState {
+        NATIVE_INT_TYPE fd; //!< ring descriptor
+        void* sqRing; //!< mapped submission ring
+        size_t sqRingSize;
+        void* cqRing; //!< mapped completion ring. Same as sqRing if the kernel maps both at once
+        size_t cqRingSize;
+        struct io_uring_sqe* sqes; //!< mapped submission entries
+        size_t sqesSize;
+        volatile U32* sqHead;
+        volatile U32* sqTail;
+        U32 sqMask;
+        U32* sqArray;
+        volatile U32* cqHead;
+        volatile U32* cqTail;
+        U32 cqMask;
+        struct io_uring_cqe* cqes;
+        U32 unsubmitted; //!< entries queued but not yet taken by the kernel
+        bool registered; //!< buffers are registered, so writes use IORING_OP_WRITE_FIXED
+        struct iovec* iovecs; //!< one per buffer
+    };
+
+    // user_data of a write is index << 1, of the sync linked to it (index << 1) | 1
+    static const U64 SYNC_FLAG = 1;
+
+    static NATIVE_INT_TYPE uringEnter(UringState* ring, U32 minComplete, U32 flags) {
+        NATIVE_INT_TYPE ret;
+        do {
+            ret = syscall(__NR_io_uring_enter, ring->fd, ring->unsubmitted, minComplete, flags, NULL, 0);
+        } while (ret == -1 && errno == EINTR);
+        if (ret > 0) {
+            ring->unsubmitted -= ret;
+        }
+        return ret;
+    }
+
+    bool AsyncFile::startUring(void) {
+        UringState* ring = new UringState;
+        if (NULL == ring) {
+            return false;
+        }
+        memset(ring, 0, sizeof(UringState));
+        ring->sqRing = MAP_FAILED;
+        ring->cqRing = MAP_FAILED;
+        ring->sqes = static_cast<struct io_uring_sqe*>(MAP_FAILED);
+        this->m_handle = reinterpret_cast<POINTER_CAST>(ring);
+
+        // Two entries per buffer: the write and the sync linked to it
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        ring->fd = syscall(__NR_io_uring_setup, 2 * this->m_depth, &params);
+        if (ring->fd == -1) {
+            return false;
+        }
+
+        ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(U32);
+        ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            if (ring->cqRingSize > ring->sqRingSize) {
+                ring->sqRingSize = ring->cqRingSize;
+            }
+            ring->cqRingSize = ring->sqRingSize;
+        }
+        ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                            ring->fd, IORING_OFF_SQ_RING);
+        if (ring->sqRing == MAP_FAILED) {
+            return false;
+        }
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            ring->cqRing = ring->sqRing;
+        } else {
+            ring->cqRing = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                ring->fd, IORING_OFF_CQ_RING);
+            if (ring->cqRing == MAP_FAILED) {
+                return false;
+            }
+        }
+        ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+        ring->sqes = static_cast<struct io_uring_sqe*>(mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE,
+                                                            MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES));
+        if (ring->sqes == MAP_FAILED) {
+            return false;
+        }
+
+        U8* sq = static_cast<U8*>(ring->sqRing);
+        U8* cq = static_cast<U8*>(ring->cqRing);
+        ring->sqHead = reinterpret_cast<volatile U32*>(sq + params.sq_off.head);
+        ring->sqTail = reinterpret_cast<volatile U32*>(sq + params.sq_off.tail);
+        ring->sqMask = *reinterpret_cast<U32*>(sq + params.sq_off.ring_mask);
+        ring->sqArray = reinterpret_cast<U32*>(sq + params.sq_off.array);
+        ring->cqHead = reinterpret_cast<volatile U32*>(cq + params.cq_off.head);
+        ring->cqTail = reinterpret_cast<volatile U32*>(cq + params.cq_off.tail);
+        ring->cqMask = *reinterpret_cast<U32*>(cq + params.cq_off.ring_mask);
+        ring->cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        ring->iovecs = new struct iovec[this->m_depth];
+        if (NULL == ring->iovecs) {
+            return false;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < this->m_depth; index++) {
+            ring->iovecs[index].iov_base = &this->m_memory[index * this->m_stride];
+            ring->iovecs[index].iov_len = this->m_bufferSize;
+        }
+        // Registering pins the buffers so the kernel does not map them on every write. It fails when the
+        // buffers exceed RLIMIT_MEMLOCK, in which case the writes pass the buffers each time instead.
+        ring->registered = (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS,
+                                    ring->iovecs, this->m_depth) == 0);
+        return true;
+    }
+
+    void AsyncFile::stopUring(void) {
+        UringState* ring = reinterpret_cast<UringState*>(this->m_handle);
+        if (NULL == ring) {
+            return;
+        }
+        if (ring->sqes != MAP_FAILED) {
+            (void) munmap(ring->sqes, ring->sqesSize);
+        }
+        if (ring->cqRing != MAP_FAILED && ring->cqRing != ring->sqRing) {
+            (void) munmap(ring->cqRing, ring->cqRingSize);
+        }
+        if (ring->sqRing != MAP_FAILED) {
+            (void) munmap(ring->sqRing, ring->sqRingSize);
+        }
+        if (ring->fd > 0) {
+            (void) ::close(ring->fd);
+        }
+        delete[] ring->iovecs;
+        delete ring;
+        this->m_handle = static_cast<POINTER_CAST>(NULL);
+    }
+
+    bool AsyncFile::submitUring(NATIVE_UINT_TYPE index) {
+        UringState* ring = reinterpret_cast<UringState*>(this->m_handle);
+        Slot& slot = this->m_slots[index];
+        // The ring has two entries per buffer, so there is always room
+        U32 tail = *ring->sqTail;
+        U32 entry = tail & ring->sqMask;
+        struct io_uring_sqe* sqe = &ring->sqes[entry];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->fd = this->m_file.m_fd;
+        sqe->off = slot.offset;
+        sqe->user_data = static_cast<U64>(index) << 1;
+        if (ring->registered) {
+            sqe->opcode = IORING_OP_WRITE_FIXED;
+            sqe->addr = reinterpret_cast<U64>(&this->m_memory[index * this->m_stride]);
+            sqe->len = slot.size;
+            sqe->buf_index = index;
+        } else {
+            ring->iovecs[index].iov_len = slot.size;
+            sqe->opcode = IORING_OP_WRITEV;
+            sqe->addr = reinterpret_cast<U64>(&ring->iovecs[index]);
+            sqe->len = 1;
+        }
+        ring->sqArray[entry] = entry;
+        tail++;
+        slot.pending = 1;
+
+        if (slot.sync) {
+            // Same wait as File::write. The link makes the sync start after the write, and
+            // cancels it if the write fails.
+            sqe->flags |= IOSQE_IO_LINK;
+            entry = tail & ring->sqMask;
+            sqe = &ring->sqes[entry];
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = IORING_OP_SYNC_FILE_RANGE;
+            sqe->fd = this->m_file.m_fd;
+            sqe->off = slot.offset;
+            sqe->len = slot.size;
+            sqe->sync_range_flags = SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER;
+            sqe->user_data = (static_cast<U64>(index) << 1) | SYNC_FLAG;
+            ring->sqArray[entry] = entry;
+            tail++;
+            slot.pending = 2;
+        }
+
+        // Publish the entries, then hand them to the kernel
+        ring->unsubmitted += slot.pending;
+        __sync_synchronize();
+        *ring->sqTail = tail;
+        __sync_synchronize();
+        return (uringEnter(ring, 0, 0) >= 0);
+    }
+
+    NATIVE_UINT_TYPE AsyncFile::reapUring(bool block) {
+        UringState* ring = reinterpret_cast<UringState*>(this->m_handle);
+        NATIVE_UINT_TYPE retired = 0;
+        while (true) {
+            U32 head = *ring->cqHead;
+            U32 tail = *ring->cqTail;
+            __sync_synchronize();
+            while (head != tail) {
+                struct io_uring_cqe* cqe = &ring->cqes[head & ring->cqMask];
+                NATIVE_UINT_TYPE index = static_cast<NATIVE_UINT_TYPE>(cqe->user_data >> 1);
+                FW_ASSERT(index < this->m_depth, index);
+                Slot& slot = this->m_slots[index];
+                if (0 == (cqe->user_data & SYNC_FLAG)) {
+                    slot.result = cqe->res;
+                } else if (cqe->res < 0 && cqe->res != -ECANCELED && slot.result >= 0) {
+                    // a cancelled sync follows a failed or short write, which is reported instead
+                    slot.result = cqe->res;
+                }
+                FW_ASSERT(slot.pending > 0, index);
+                if (--slot.pending == 0) {
+                    this->retire(index);
+                    retired++;
+                }
+                head++;
+            }
+            __sync_synchronize();
+            *ring->cqHead = head;
+
+            if (retired > 0 || not block || this->getInFlight() == 0) {
+                return retired;
+            }
+            NATIVE_INT_TYPE ret = uringEnter(ring, 1, IORING_ENTER_GETEVENTS);
+            FW_ASSERT(ret >= 0, errno);
+        }
+    }
+
+#else
+
+    bool AsyncFile::startUring(void) {
+        return false;
+    }
+
+    void AsyncFile::stopUring(void) {
+    }
+
+    bool AsyncFile::submitUring(NATIVE_UINT_TYPE index) {
+        return false;
+    }
+
+    NATIVE_UINT_TYPE AsyncFile::reapUring(bool block) {
+        return 0;
+    }
+
+#endif
+
+    //! Worker pool shared state. Buffer indices pass to the workers and back through two rings.
+    struct WorkerState {
+        pthread_mutex_t lock;
+        pthread_cond_t submitted; //!< signalled when a write is queued for the workers
+        pthread_cond_t completed; //!< signalled when a worker finishes a write
+        NATIVE_UINT_TYPE* queued; //!< ring of buffers waiting for a worker
+        NATIVE_UINT_TYPE queuedHead;
+        NATIVE_UINT_TYPE queuedCount;
+        NATIVE_UINT_TYPE* done; //!< ring of buffers written and not yet retired
+        NATIVE_UINT_TYPE doneHead;
+        NATIVE_UINT_TYPE doneCount;
+        bool stop; //!< tells the workers to exit
+        pthread_t threads[AsyncFile::MAX_WORKERS];
+        NATIVE_UINT_TYPE numThreads;
+        AsyncFile* file;
+    };
+
+    bool AsyncFile::startWorkers(NATIVE_UINT_TYPE numWorkers) {
+        WorkerState* state = new WorkerState;
+        if (NULL == state) {
+            return false;
+        }
+        state->queued = new NATIVE_UINT_TYPE[this->m_depth];
+        state->done = new NATIVE_UINT_TYPE[this->m_depth];
+        state->queuedHead = 0;
+        state->queuedCount = 0;
+        state->doneHead = 0;
+        state->doneCount = 0;
+        state->stop = false;
+        state->numThreads = 0;
+        state->file = this;
+        (void) pthread_mutex_init(&state->lock, NULL);
+        (void) pthread_cond_init(&state->submitted, NULL);
+        (void) pthread_cond_init(&state->completed, NULL);
+        this->m_handle = reinterpret_cast<POINTER_CAST>(state);
+        if (NULL == state->queued || NULL == state->done) {
+            return false;
+        }
+
+        for (NATIVE_UINT_TYPE worker = 0; worker < numWorkers; worker++) {
+            if (pthread_create(&state->threads[worker], NULL, workerTask, state) != 0) {
+                return false;
+            }
+            state->numThreads++;
+        }
+        return true;
+    }
+
+    void AsyncFile::stopWorkers(void) {
+        WorkerState* state = reinterpret_cast<WorkerState*>(this->m_handle);
+        if (NULL == state) {
+            return;
+        }
+        (void) pthread_mutex_lock(&state->lock);
+        state->stop = true;
+        (void) pthread_cond_broadcast(&state->submitted);
+        (void) pthread_mutex_unlock(&state->lock);
+        for (NATIVE_UINT_TYPE worker = 0; worker < state->numThreads; worker++) {
+            (void) pthread_join(state->threads[worker], NULL);
+        }
+        (void) pthread_cond_destroy(&state->completed);
+        (void) pthread_cond_destroy(&state->submitted);
+        (void) pthread_mutex_destroy(&state->lock);
+        delete[] state->done;
+        delete[] state->queued;
+        delete state;
+        this->m_handle = static_cast<POINTER_CAST>(NULL);
+    }
+
+    void* AsyncFile::workerTask(void* ptr) {
+        WorkerState* state = static_cast<WorkerState*>(ptr);
+        AsyncFile* file = state->file;
+        (void) pthread_mutex_lock(&state->lock);
+        while (true) {
+            while (state->queuedCount == 0 && not state->stop) {
+                (void) pthread_cond_wait(&state->submitted, &state->lock);
+            }
+            // Writes already queued are finished before exiting
+            if (state->queuedCount == 0) {
+                break;
+            }
+            NATIVE_UINT_TYPE index = state->queued[state->queuedHead];
+            state->queuedHead = (state->queuedHead + 1) % file->m_depth;
+            state->queuedCount--;
+            (void) pthread_mutex_unlock(&state->lock);
+
+            Slot& slot = file->m_slots[index];
+            const U8* data = &file->m_memory[index * file->m_stride];
+            NATIVE_UINT_TYPE written = 0;
+            NATIVE_INT_TYPE result = 0;
+            while (written < slot.size) {
+                ssize_t ret = ::pwrite(file->m_file.m_fd, data + written, slot.size - written,
+                                       static_cast<off_t>(slot.offset + written));
+                if (ret == -1) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    result = -errno;
+                    break;
+                }
+                if (ret == 0) {
+                    break;
+                }
+                written += ret;
+            }
+            if (result == 0) {
+                result = written;
+            }
+#ifdef __linux__
+            if (slot.sync && result == static_cast<NATIVE_INT_TYPE>(slot.size)) {
+                if (sync_file_range(file->m_file.m_fd, slot.offset, slot.size,
+                                    SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+                                    SYNC_FILE_RANGE_WAIT_AFTER) == -1) {
+                    result = -errno;
+                }
+            }
+#endif
+            slot.result = result;
+
+            (void) pthread_mutex_lock(&state->lock);
+            state->done[(state->doneHead + state->doneCount) % file->m_depth] = index;
+            state->doneCount++;
+            (void) pthread_cond_signal(&state->completed);
+        }
+        (void) pthread_mutex_unlock(&state->lock);
+        return NULL;
+    }
+
+    void AsyncFile::submitWorkers(NATIVE_UINT_TYPE index) {
+        WorkerState* state = reinterpret_cast<WorkerState*>(this->m_handle);
+        this->m_slots[index].pending = 1;
+        (void) pthread_mutex_lock(&state->lock);
+        state->queued[(state->queuedHead + state->queuedCount) % this->m_depth] = index;
+        state->queuedCount++;
+        (void) pthread_cond_signal(&state->submitted);
+        (void) pthread_mutex_unlock(&state->lock);
+    }
+
+    NATIVE_UINT_TYPE AsyncFile::reapWorkers(bool block) {
+        WorkerState* state = reinterpret_cast<WorkerState*>(this->m_handle);
+        NATIVE_UINT_TYPE retired = 0;
+        (void) pthread_mutex_lock(&state->lock);
+        if (block && this->getInFlight() > 0) {
+            while (state->doneCount == 0) {
+                (void) pthread_cond_wait(&state->completed, &state->lock);
+            }
+        }
+        while (state->doneCount > 0) {
+            NATIVE_UINT_TYPE index = state->done[state->doneHead];
+            state->doneHead = (state->doneHead + 1) % this->m_depth;
+            state->doneCount--;
+            this->m_slots[index].pending = 0;
+            this->retire(index);
+            retired++;
+        }
+        (void) pthread_mutex_unlock(&state->lock);
+        return retired;
+    }
+
+    AsyncFile::AsyncFile() :
+        m_offset(0),
+        m_memory(NULL),
+        m_depth(0),
+        m_bufferSize(0),
+        m_stride(0),
+        m_slots(NULL),
+        m_free(NULL),
+        m_numFree(0),
+        m_inFlight(0),
+        m_writeStatus(File::OP_OK),
+        m_failedWritten(0),
+        m_failedRequested(0),
+        m_writeCalls(0),
+        m_bytesWritten(0),
+        m_uring(false),
+        m_handle(static_cast<POINTER_CAST>(NULL)) {
+    }
+
+    AsyncFile::~AsyncFile() {
+        this->destroy();
+    }
+
+    void AsyncFile::destroy(void) {
+        if (NULL == this->m_slots) {
+            return;
+        }
+        this->close();
+        if (this->m_uring) {
+            this->stopUring();
+        } else {
+            this->stopWorkers();
+        }
+        free(this->m_memory);
+        delete[] this->m_slots;
+        delete[] this->m_free;
+        this->m_memory = NULL;
+        this->m_slots = NULL;
+        this->m_free = NULL;
+        this->m_numFree = 0;
+        this->m_depth = 0;
+        this->m_uring = false;
+    }
+
+    AsyncFile::AsyncStatus AsyncFile::create(NATIVE_UINT_TYPE depth, NATIVE_UINT_TYPE bufferSize, Backend backend,
+                                             NATIVE_UINT_TYPE numWorkers) {
+        this->destroy();
+        if (depth == 0 || bufferSize == 0 || numWorkers == 0 || numWorkers > MAX_WORKERS) {
+            return ASYNC_BAD_SIZE;
+        }
+
+        this->m_depth = depth;
+        this->m_bufferSize = bufferSize;
+        this->m_stride = (bufferSize + sizeof(U64) - 1) & ~(sizeof(U64) - 1);
+        void* memory = NULL;
+        if (posix_memalign(&memory, BUFFER_ALIGNMENT, this->m_stride * depth) != 0) {
+            this->m_depth = 0;
+            return ASYNC_ERROR;
+        }
+        this->m_memory = static_cast<U8*>(memory);
+        this->m_slots = new Slot[depth];
+        this->m_free = new NATIVE_UINT_TYPE[depth];
+        FW_ASSERT(this->m_slots != NULL && this->m_free != NULL);
+        // Hand out the lowest buffers first
+        for (NATIVE_UINT_TYPE index = 0; index < depth; index++) {
+            this->m_free[index] = depth - 1 - index;
+            this->m_slots[index].pending = 0;
+        }
+        this->m_numFree = depth;
+        this->m_inFlight = 0;
+        this->m_writeStatus = File::OP_OK;
+
+        if (BACKEND_AUTO == backend) {
+            this->m_uring = this->startUring();
+            if (not this->m_uring) {
+                this->stopUring();
+            }
+        }
+        if (not this->m_uring && not this->startWorkers(numWorkers)) {
+            this->destroy();
+            return ASYNC_ERROR;
+        }
+        return ASYNC_OK;
+    }
+
+    File::Status AsyncFile::open(const char* fileName, File::Mode mode) {
+        FW_ASSERT(fileName != NULL);
+        if (File::OPEN_READ == mode) {
+            return File::OTHER_ERROR;
+        }
+        this->close();
+        File::Status status = this->m_file.open(fileName, mode);
+        if (status != File::OP_OK) {
+            this->m_file.close();
+            return status;
+        }
+        // Writes carry their own offsets. The kernel ignores those under O_APPEND, which would let
+        // writes completing out of order land out of order, so appending starts at the end instead.
+        this->m_offset = 0;
+        if (File::OPEN_APPEND == mode) {
+            const NATIVE_INT_TYPE flags = fcntl(this->m_file.m_fd, F_GETFL);
+            const off_t end = ::lseek(this->m_file.m_fd, 0, SEEK_END);
+            if (flags == -1 || end == -1 || fcntl(this->m_file.m_fd, F_SETFL, flags & ~O_APPEND) == -1) {
+                status = errnoToStatus(errno);
+                this->m_file.close();
+                return status;
+            }
+            this->m_offset = end;
+        }
+        return File::OP_OK;
+    }
+
+    bool AsyncFile::isOpen(void) const {
+        return this->m_file.m_mode != File::OPEN_NO_MODE;
+    }
+
+    AsyncFile::AsyncStatus AsyncFile::getBuffer(U8*& buffer, NATIVE_UINT_TYPE& index, bool block) {
+        if (NULL == this->m_slots) {
+            return ASYNC_UNINITIALIZED;
+        }
+        if (this->m_numFree == 0) {
+            (void) this->complete(block);
+            if (this->m_numFree == 0) {
+                return ASYNC_NO_BUFFER;
+            }
+        }
+        index = this->m_free[--this->m_numFree];
+        buffer = &this->m_memory[index * this->m_stride];
+        return ASYNC_OK;
+    }
+
+    AsyncFile::AsyncStatus AsyncFile::submitWrite(NATIVE_UINT_TYPE index, NATIVE_UINT_TYPE size, bool waitForDone) {
+        if (NULL == this->m_slots) {
+            return ASYNC_UNINITIALIZED;
+        }
+        if (index >= this->m_depth || size == 0 || size > this->m_bufferSize) {
+            return ASYNC_BAD_SIZE;
+        }
+        Slot& slot = this->m_slots[index];
+        FW_ASSERT(slot.pending == 0, index);
+        if (not this->isOpen()) {
+            this->release(index);
+            return ASYNC_NOT_OPENED;
+        }
+        slot.offset = this->m_offset;
+        slot.size = size;
+        slot.result = 0;
+        slot.sync = waitForDone && (File::OPEN_SYNC_DIRECT_WRITE != this->m_file.m_mode);
+        this->m_offset += size;
+        this->m_inFlight++;
+        this->m_writeCalls++;
+        this->m_bytesWritten += size;
+
+        if (not this->m_uring) {
+            this->submitWorkers(index);
+        } else if (not this->submitUring(index)) {
+            // The entries stay queued and go to the kernel with the next call
+            return ASYNC_ERROR;
+        }
+        return ASYNC_OK;
+    }
+
+    AsyncFile::AsyncStatus AsyncFile::write(const void* data, NATIVE_UINT_TYPE size, bool waitForDone) {
+        FW_ASSERT(data != NULL);
+        if (not this->isOpen()) {
+            return ASYNC_NOT_OPENED;
+        }
+        const U8* source = static_cast<const U8*>(data);
+        while (size > 0) {
+            U8* buffer = NULL;
+            NATIVE_UINT_TYPE index = 0;
+            AsyncStatus status = this->getBuffer(buffer, index, true);
+            if (status != ASYNC_OK) {
+                return status;
+            }
+            const NATIVE_UINT_TYPE chunk = (size < this->m_bufferSize) ? size : this->m_bufferSize;
+            memcpy(buffer, source, chunk);
+            status = this->submitWrite(index, chunk, waitForDone);
+            if (status != ASYNC_OK) {
+                return status;
+            }
+            source += chunk;
+            size -= chunk;
+        }
+        return ASYNC_OK;
+    }
+
+    NATIVE_UINT_TYPE AsyncFile::complete(bool block) {
+        if (NULL == this->m_slots) {
+            return 0;
+        }
+        return this->m_uring ? this->reapUring(block) : this->reapWorkers(block);
+    }
+
+    void AsyncFile::flush(void) {
+        while (this->getInFlight() > 0) {
+            (void) this->complete(true);
+        }
+    }
+
+    void AsyncFile::retire(NATIVE_UINT_TYPE index) {
+        Slot& slot = this->m_slots[index];
+        if (slot.result != static_cast<NATIVE_INT_TYPE>(slot.size) && File::OP_OK == this->m_writeStatus) {
+            // a short write means the device is full
+            this->m_writeStatus = (slot.result < 0) ? errnoToStatus(-slot.result) : File::NO_SPACE;
+            this->m_failedWritten = (slot.result < 0) ? 0 : slot.result;
+            this->m_failedRequested = slot.size;
+        }
+        FW_ASSERT(this->m_inFlight > 0);
+        this->m_inFlight--;
+        this->release(index);
+    }
+
+    void AsyncFile::release(NATIVE_UINT_TYPE index) {
+        FW_ASSERT(this->m_numFree < this->m_depth, this->m_numFree);
+        this->m_free[this->m_numFree++] = index;
+    }
+
+    File::Status AsyncFile::getWriteStatus(NATIVE_UINT_TYPE& written, NATIVE_UINT_TYPE& requested) {
+        const File::Status status = this->m_writeStatus;
+        if (status != File::OP_OK) {
+            written = this->m_failedWritten;
+            requested = this->m_failedRequested;
+            this->m_writeStatus = File::OP_OK;
+        }
+        return status;
+    }
+
+    File::Status AsyncFile::toFileStatus(AsyncStatus status) {
+        switch (status) {
+            case ASYNC_OK:
+                return File::OP_OK;
+            case ASYNC_NOT_OPENED:
+                return File::NOT_OPENED;
+            case ASYNC_BAD_SIZE:
+                return File::BAD_SIZE;
+            default:
+                return File::OTHER_ERROR;
+        }
+    }
+
+    void AsyncFile::close(void) {
+        this->flush();
+        this->m_file.close();
+    }
+
+    NATIVE_UINT_TYPE AsyncFile::getInFlight(void) const {
+        return this->m_inFlight;
+    }
+
+    NATIVE_UINT_TYPE AsyncFile::getBufferSize(void) const {
+        return this->m_bufferSize;
+    }
+
+    bool AsyncFile::usingUring(void) const {
+        return this->m_uring;
+    }
+
+    U32 AsyncFile::getWriteCalls(void) const {
+        return this->m_writeCalls;
+    }
+
+    U64 AsyncFile::getBytesWritten(void) const {
+        return this->m_bytesWritten;
+    }
+
+}
@@ -0,0 +1,160 @@
+#include <Os/MappedFile.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Os {
+
+    // Translate an errno value as File::open does
+    static File::Status errnoToStatus(NATIVE_INT_TYPE error) {
+        switch (error) {
+            case ENOENT:
+                return File::DOESNT_EXIST;
+            case ENOSPC:
+            case EFBIG:
+                return File::NO_SPACE;
+            case EACCES:
+            case EPERM:
+                return File::NO_PERMISSION;
+            case EINVAL:
+                return File::BAD_SIZE;
+            default:
+                return File::OTHER_ERROR;
+        }
+    }
+
+    MappedFile::MappedFile() :
+        m_fd(-1),
+        m_data(NULL),
+        m_size(0),
+        m_mode(OPEN_READ),
+        m_syncCalls(0) {
+    }
+
+    MappedFile::~MappedFile() {
+        (void) this->close();
+    }
+
+    File::Status MappedFile::open(const char* fileName, Mode mode, NATIVE_UINT_TYPE size) {
+        FW_ASSERT(fileName != NULL);
+        FW_ASSERT(not this->isOpen());
+
+        const NATIVE_INT_TYPE flags = (OPEN_WRITE == mode) ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDONLY;
+        const NATIVE_INT_TYPE fd = ::open(fileName, flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
+        if (fd == -1) {
+            return errnoToStatus(errno);
+        }
+
+        if (OPEN_WRITE == mode) {
+            if (size == 0) {
+                (void) ::close(fd);
+                return File::BAD_SIZE;
+            }
+            // Allocate the blocks now: a store to a page with no block behind it faults instead of failing
+#ifdef __linux__
+            NATIVE_INT_TYPE error = posix_fallocate(fd, 0, size);
+            // file systems without fallocate leave a sparse file
+            if (error == EOPNOTSUPP || error == EINVAL) {
+                error = (ftruncate(fd, size) == 0) ? 0 : errno;
+            }
+#else
+            NATIVE_INT_TYPE error = (ftruncate(fd, size) == 0) ? 0 : errno;
+#endif
+            if (error != 0) {
+                (void) ::close(fd);
+                return errnoToStatus(error);
+            }
+        } else {
+            struct stat fileStat;
+            if (fstat(fd, &fileStat) != 0) {
+                const NATIVE_INT_TYPE error = errno;
+                (void) ::close(fd);
+                return errnoToStatus(error);
+            }
+            if (fileStat.st_size <= 0) {
+                (void) ::close(fd);
+                return File::BAD_SIZE;
+            }
+            size = static_cast<NATIVE_UINT_TYPE>(fileStat.st_size);
+        }
+
+        const NATIVE_INT_TYPE prot = (OPEN_WRITE == mode) ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        void* data = mmap(NULL, size, prot, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED) {
+            const NATIVE_INT_TYPE error = errno;
+            (void) ::close(fd);
+            return errnoToStatus(error);
+        }
+
+        this->m_fd = fd;
+        this->m_data = static_cast<U8*>(data);
+        this->m_size = size;
+        this->m_mode = mode;
+        return File::OP_OK;
+    }
+
+    bool MappedFile::isOpen(void) const {
+        return this->m_data != NULL;
+    }
+
+    U8* MappedFile::getData(void) const {
+        return this->m_data;
+    }
+
+    NATIVE_UINT_TYPE MappedFile::getSize(void) const {
+        return this->m_size;
+    }
+
+    File::Status MappedFile::sync(NATIVE_UINT_TYPE offset, NATIVE_UINT_TYPE length, bool wait) {
+        if (not this->isOpen()) {
+            return File::NOT_OPENED;
+        }
+        if (offset > this->m_size || length > this->m_size - offset) {
+            return File::BAD_SIZE;
+        }
+        if (length == 0 || OPEN_READ == this->m_mode) {
+            return File::OP_OK;
+        }
+        // msync takes a page aligned start
+        const NATIVE_UINT_TYPE pageSize = static_cast<NATIVE_UINT_TYPE>(sysconf(_SC_PAGESIZE));
+        const NATIVE_UINT_TYPE start = offset - (offset % pageSize);
+        this->m_syncCalls++;
+        if (msync(&this->m_data[start], length + (offset - start), wait ? MS_SYNC : MS_ASYNC) != 0) {
+            return errnoToStatus(errno);
+        }
+        return File::OP_OK;
+    }
+
+    File::Status MappedFile::close(NATIVE_UINT_TYPE finalSize) {
+        if (not this->isOpen()) {
+            return File::NOT_OPENED;
+        }
+        File::Status stat = File::OP_OK;
+        if (munmap(this->m_data, this->m_size) != 0) {
+            stat = errnoToStatus(errno);
+        }
+        if (OPEN_WRITE == this->m_mode && finalSize < this->m_size) {
+            if (ftruncate(this->m_fd, finalSize) != 0 && File::OP_OK == stat) {
+                stat = errnoToStatus(errno);
+            }
+        }
+        (void) ::close(this->m_fd);
+        this->m_fd = -1;
+        this->m_data = NULL;
+        this->m_size = 0;
+        return stat;
+    }
+
+    File::Status MappedFile::close(void) {
+        return this->close(this->m_size);
+    }
+
+    U32 MappedFile::getSyncCalls(void) const {
+        return this->m_syncCalls;
+    }
+
+}
@@ -0,0 +1,80 @@
+/**
+ * Reactor.hpp:
+ *
+ * Waits on many file descriptors from one task and calls a handler for each descriptor that becomes readable. Drivers
+ * register their sockets or serial ports instead of each dedicating a blocking read task, so one task and one wakeup
+ * serve every driver with data waiting.
+ *
+ * Handlers run on the reactor task and must not block. Descriptors may be added and removed from any task, including
+ * from a handler.
+ */
+#ifndef _REACTOR_HPP_
+#define _REACTOR_HPP_
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Fw/Types/StringType.hpp>
+#include <Os/Task.hpp>
+
+namespace Os {
+
+    class Reactor {
+        public:
+
+            //! Receives readiness notifications for a registered file descriptor. A driver with several descriptors
+            //! registers one handler for each.
+            class Handler {
+                public:
+                    virtual ~Handler() {}
+                    //! Called on the reactor task when the descriptor has data to read, or has been closed by the peer
+                    virtual void readable(void) = 0;
+            };
+
+            typedef enum {
+                REACTOR_OK, //!< Operation succeeded
+                REACTOR_UNINITIALIZED, //!< create has not been called, or failed
+                REACTOR_ERROR, //!< The operating system call failed
+                REACTOR_STOPPED //!< stop was called
+            } ReactorStatus;
+
+            enum {
+                MAX_EVENTS = 16 //!< Descriptors dispatched per wakeup
+            };
+
+            Reactor();
+            ~Reactor();
+
+            ReactorStatus create(void); //!< Create the reactor. Must be called before any other method.
+
+            //! Call handler whenever fd becomes readable
+            ReactorStatus add(NATIVE_INT_TYPE fd, Handler* handler);
+
+            //! Stop watching fd. Must be called before fd is closed.
+            ReactorStatus remove(NATIVE_INT_TYPE fd);
+
+            //! Wait up to timeoutMs (-1 for no limit) and call the handlers of the readable descriptors.
+            //! The reactor task calls this in a loop; it may be called directly instead of starting the task.
+            ReactorStatus poll(NATIVE_INT_TYPE timeoutMs);
+
+            //! Start a task that polls until stop is called
+            Task::TaskStatus start(const Fw::StringBase &name, NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize,
+                                   NATIVE_INT_TYPE cpuAffinity = -1);
+
+            void stop(void); //!< Wake the reactor task and make it exit
+            Task::TaskStatus join(void); //!< Wait for the reactor task to exit
+
+        private:
+
+            static void reactorTask(void* ptr); //!< Task entry point
+
+            NATIVE_INT_TYPE m_pollFd; //!< Descriptor of the operating system wait set
+            NATIVE_INT_TYPE m_wakeFd; //!< Descriptor written by stop to wake the task
+            volatile bool m_stop; //!< Set by stop
+            Task m_task; //!< The reactor task
+
+            Reactor(const Reactor&); //!< Disabled copy constructor
+            Reactor& operator=(const Reactor&); //!< Disabled assignment
+    };
+
+}
+
+#endif
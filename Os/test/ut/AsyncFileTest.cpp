@@ -0,0 +1,232 @@
+// ======================================================================
+// \title  AsyncFileTest.cpp
+// \brief  Test and benchmark for Os::AsyncFile
+//
+//         For the io_uring backend (when the kernel provides it) and for
+//         worker pools of one and four threads:
+//
+//         - writes records of varying size through registered buffers and
+//           through the copying write, and checks the file contents
+//         - appends to an existing file
+//         - checks that a failed write is reported (/dev/full), and that
+//           a failed submission maps to a File::Status
+//         - times the records against blocking Os::File writes
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Os/AsyncFile.hpp>
+#include <Os/File.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+enum {
+    DEPTH = 16,
+    BUFFER_SIZE = 256,
+    RECORDS = 4000,
+    MAX_RECORD = 600 // larger than a buffer, so the copying write splits it
+};
+
+static const char* const FILE_NAME = "AsyncFileTest.bin";
+
+static F64 now(void) {
+    timespec time;
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<F64>(time.tv_sec) + static_cast<F64>(time.tv_nsec) / 1000000000.0;
+}
+
+// Size and contents of a record depend only on its number
+static U32 recordSize(U32 record, U32 maxSize) {
+    return 1 + (record * 37) % maxSize;
+}
+
+static void fillRecord(U8* data, U32 record, U32 size) {
+    for (U32 byte = 0; byte < size; byte++) {
+        data[byte] = static_cast<U8>(record + byte);
+    }
+}
+
+static void checkFile(U32 records, U32 maxSize, U32 repeats) {
+    Os::File file;
+    Os::File::Status stat = file.open(FILE_NAME, Os::File::OPEN_READ);
+    FW_ASSERT(stat == Os::File::OP_OK, stat);
+    U8 expected[MAX_RECORD];
+    U8 actual[MAX_RECORD];
+    for (U32 repeat = 0; repeat < repeats; repeat++) {
+        for (U32 record = 0; record < records; record++) {
+            U32 size = recordSize(record, maxSize);
+            fillRecord(expected, record, size);
+            NATIVE_INT_TYPE readSize = size;
+            stat = file.read(actual, readSize);
+            FW_ASSERT(stat == Os::File::OP_OK, stat);
+            FW_ASSERT(readSize == static_cast<NATIVE_INT_TYPE>(size), readSize, size);
+            FW_ASSERT(memcmp(expected, actual, size) == 0, record);
+        }
+    }
+    // nothing after the last record
+    NATIVE_INT_TYPE readSize = 1;
+    stat = file.read(actual, readSize);
+    FW_ASSERT(readSize == 0, readSize);
+    file.close();
+}
+
+static void createFile(Os::AsyncFile& file, Os::AsyncFile::Backend backend, U32 workers) {
+    Os::AsyncFile::AsyncStatus stat = file.create(DEPTH, BUFFER_SIZE, backend, workers);
+    FW_ASSERT(stat == Os::AsyncFile::ASYNC_OK, stat);
+}
+
+static void testRegistered(Os::AsyncFile::Backend backend, U32 workers) {
+    Os::AsyncFile file;
+    createFile(file, backend, workers);
+    Os::File::Status fileStat = file.open(FILE_NAME, Os::File::OPEN_CREATE);
+    FW_ASSERT(fileStat == Os::File::OP_OK, fileStat);
+    for (U32 record = 0; record < RECORDS; record++) {
+        U8* buffer = NULL;
+        NATIVE_UINT_TYPE index = 0;
+        Os::AsyncFile::AsyncStatus stat = file.getBuffer(buffer, index, false);
+        if (stat == Os::AsyncFile::ASYNC_NO_BUFFER) {
+            stat = file.getBuffer(buffer, index, true);
+        }
+        FW_ASSERT(stat == Os::AsyncFile::ASYNC_OK, stat);
+        U32 size = recordSize(record, BUFFER_SIZE);
+        fillRecord(buffer, record, size);
+        stat = file.submitWrite(index, size, false);
+        FW_ASSERT(stat == Os::AsyncFile::ASYNC_OK, stat);
+        FW_ASSERT(file.getInFlight() <= DEPTH, file.getInFlight());
+    }
+    file.close();
+    FW_ASSERT(file.getInFlight() == 0, file.getInFlight());
+    NATIVE_UINT_TYPE written = 0;
+    NATIVE_UINT_TYPE requested = 0;
+    fileStat = file.getWriteStatus(written, requested);
+    FW_ASSERT(fileStat == Os::File::OP_OK, fileStat);
+    checkFile(RECORDS, BUFFER_SIZE, 1);
+}
+
+static void testCopyAndAppend(Os::AsyncFile::Backend backend, U32 workers) {
+    Os::AsyncFile file;
+    createFile(file, backend, workers);
+    U8 data[MAX_RECORD];
+    for (U32 pass = 0; pass < 2; pass++) {
+        // the second pass appends the same records again
+        Os::File::Mode mode = (pass == 0) ? Os::File::OPEN_CREATE : Os::File::OPEN_APPEND;
+        Os::File::Status fileStat = file.open(FILE_NAME, mode);
+        FW_ASSERT(fileStat == Os::File::OP_OK, fileStat);
+        for (U32 record = 0; record < RECORDS; record++) {
+            U32 size = recordSize(record, MAX_RECORD);
+            fillRecord(data, record, size);
+            Os::AsyncFile::AsyncStatus stat = file.write(data, size, false);
+            FW_ASSERT(stat == Os::AsyncFile::ASYNC_OK, stat);
+        }
+        file.close();
+    }
+    checkFile(RECORDS, MAX_RECORD, 2);
+}
+
+static void testWriteError(Os::AsyncFile::Backend backend, U32 workers) {
+    Os::AsyncFile file;
+    createFile(file, backend, workers);
+    Os::File::Status fileStat = file.open("/dev/full", Os::File::OPEN_WRITE);
+    if (fileStat != Os::File::OP_OK) {
+        printf("  /dev/full not available, skipping write error check\n");
+        return;
+    }
+    U8 data[BUFFER_SIZE];
+    memset(data, 0, sizeof(data));
+    Os::AsyncFile::AsyncStatus stat = file.write(data, sizeof(data), false);
+    FW_ASSERT(stat == Os::AsyncFile::ASYNC_OK, stat);
+    file.flush();
+    NATIVE_UINT_TYPE written = 1;
+    NATIVE_UINT_TYPE requested = 0;
+    fileStat = file.getWriteStatus(written, requested);
+    FW_ASSERT(fileStat == Os::File::NO_SPACE, fileStat);
+    FW_ASSERT(written == 0, written);
+    FW_ASSERT(requested == BUFFER_SIZE, requested);
+    // reported once
+    fileStat = file.getWriteStatus(written, requested);
+    FW_ASSERT(fileStat == Os::File::OP_OK, fileStat);
+    // a submission error is reported as a File::Status too
+    stat = file.submitWrite(DEPTH, 1);
+    FW_ASSERT(stat == Os::AsyncFile::ASYNC_BAD_SIZE, stat);
+    fileStat = Os::AsyncFile::toFileStatus(stat);
+    FW_ASSERT(fileStat == Os::File::BAD_SIZE, fileStat);
+    file.close();
+}
+
+// Time to hand a record to the file, and the longest single hand off, with the wait for the disk
+static void benchmark(const char* name, Os::AsyncFile* asyncFile) {
+    Os::File file;
+    U8 data[BUFFER_SIZE];
+    memset(data, 0xA5, sizeof(data));
+    F64 longest = 0.0;
+    if (asyncFile != NULL) {
+        Os::File::Status fileStat = asyncFile->open(FILE_NAME, Os::File::OPEN_CREATE);
+        FW_ASSERT(fileStat == Os::File::OP_OK, fileStat);
+    } else {
+        Os::File::Status fileStat = file.open(FILE_NAME, Os::File::OPEN_CREATE);
+        FW_ASSERT(fileStat == Os::File::OP_OK, fileStat);
+    }
+    F64 start = now();
+    for (U32 record = 0; record < RECORDS; record++) {
+        F64 before = now();
+        if (asyncFile != NULL) {
+            Os::AsyncFile::AsyncStatus stat = asyncFile->write(data, sizeof(data));
+            FW_ASSERT(stat == Os::AsyncFile::ASYNC_OK, stat);
+            (void) asyncFile->complete(false);
+        } else {
+            NATIVE_INT_TYPE size = sizeof(data);
+            Os::File::Status stat = file.write(data, size);
+            FW_ASSERT(stat == Os::File::OP_OK, stat);
+        }
+        F64 elapsed = now() - before;
+        if (elapsed > longest) {
+            longest = elapsed;
+        }
+    }
+    F64 submitted = now() - start;
+    if (asyncFile != NULL) {
+        asyncFile->close();
+    } else {
+        file.close();
+    }
+    F64 total = now() - start;
+    printf("  %-22s %8.2fus per write, longest %8.2fus, %8.2fms to close\n", name,
+           1000000.0 * submitted / static_cast<F64>(RECORDS), 1000000.0 * longest,
+           1000.0 * (total - submitted));
+}
+
+static void runBackend(const char* name, Os::AsyncFile::Backend backend, U32 workers) {
+    printf("%s\n", name);
+    testRegistered(backend, workers);
+    testCopyAndAppend(backend, workers);
+    testWriteError(backend, workers);
+    Os::AsyncFile file;
+    createFile(file, backend, workers);
+    benchmark("AsyncFile", &file);
+}
+
+int main(int argc, char* argv[]) {
+    printf("-----------------------------\n");
+    printf("---- async file test --------\n");
+    printf("-----------------------------\n");
+    Os::AsyncFile probe;
+    createFile(probe, Os::AsyncFile::BACKEND_AUTO, 1);
+    if (probe.usingUring()) {
+        runBackend("io_uring", Os::AsyncFile::BACKEND_AUTO, 1);
+    } else {
+        printf("io_uring not available\n");
+    }
+    runBackend("1 worker", Os::AsyncFile::BACKEND_WORKERS, 1);
+    runBackend("4 workers", Os::AsyncFile::BACKEND_WORKERS, 4);
+    printf("Os::File\n");
+    benchmark("File::write", NULL);
+    (void) unlink(FILE_NAME);
+    return 0;
+}
@@ -0,0 +1,188 @@
+// ======================================================================
+// \title  BufferedFileTest.cpp
+// \brief  Test and benchmark for Os::BufferedFile
+//
+//         - writes records of varying size, smaller and larger than a
+//           block, and checks the file contents and the write calls made
+//         - checks each sync policy and the unbuffered pass through
+//         - checks that a failed write is reported (/dev/full)
+//         - times the records against blocking Os::File writes
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Os/BufferedFile.hpp>
+#include <Os/File.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+enum {
+    BLOCK_SIZE = 512,
+    RECORDS = 4000,
+    MAX_RECORD = 1300 // larger than two blocks, so some records skip the buffer
+};
+
+static const char* const FILE_NAME = "BufferedFileTest.bin";
+
+static F64 now(void) {
+    timespec time;
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<F64>(time.tv_sec) + static_cast<F64>(time.tv_nsec) / 1000000000.0;
+}
+
+// Size and contents of a record depend only on its number
+static U32 recordSize(U32 record) {
+    return 1 + (record * 37) % MAX_RECORD;
+}
+
+static void fillRecord(U8* data, U32 record, U32 size) {
+    for (U32 byte = 0; byte < size; byte++) {
+        data[byte] = static_cast<U8>(record + byte);
+    }
+}
+
+static void checkFile(U32 records) {
+    Os::File file;
+    Os::File::Status stat = file.open(FILE_NAME, Os::File::OPEN_READ);
+    FW_ASSERT(stat == Os::File::OP_OK, stat);
+    U8 expected[MAX_RECORD];
+    U8 actual[MAX_RECORD];
+    for (U32 record = 0; record < records; record++) {
+        U32 size = recordSize(record);
+        fillRecord(expected, record, size);
+        NATIVE_INT_TYPE readSize = size;
+        stat = file.read(actual, readSize);
+        FW_ASSERT(stat == Os::File::OP_OK, stat);
+        FW_ASSERT(readSize == static_cast<NATIVE_INT_TYPE>(size), readSize, size);
+        FW_ASSERT(memcmp(expected, actual, size) == 0, record);
+    }
+    // nothing after the last record
+    NATIVE_INT_TYPE readSize = 1;
+    stat = file.read(actual, readSize);
+    FW_ASSERT(readSize == 0, readSize);
+    file.close();
+}
+
+// Write the records, flushing every flushEvery records, and return the bytes written
+static U64 writeRecords(Os::BufferedFile& file, U32 flushEvery) {
+    U8 data[MAX_RECORD];
+    U64 total = 0;
+    Os::File::Status stat = file.open(FILE_NAME, Os::File::OPEN_WRITE);
+    FW_ASSERT(stat == Os::File::OP_OK, stat);
+    for (U32 record = 0; record < RECORDS; record++) {
+        U32 size = recordSize(record);
+        fillRecord(data, record, size);
+        NATIVE_INT_TYPE writeSize = size;
+        stat = file.write(data, writeSize);
+        FW_ASSERT(stat == Os::File::OP_OK, stat);
+        FW_ASSERT(writeSize == static_cast<NATIVE_INT_TYPE>(size), writeSize, size);
+        FW_ASSERT(file.getBuffered() < file.getBlockSize() || file.getBuffered() == 0, file.getBuffered());
+        total += size;
+        if (flushEvery != 0 && record % flushEvery == flushEvery - 1) {
+            stat = file.flush();
+            FW_ASSERT(stat == Os::File::OP_OK, stat);
+            FW_ASSERT(file.getBuffered() == 0, file.getBuffered());
+        }
+    }
+    stat = file.close();
+    FW_ASSERT(stat == Os::File::OP_OK, stat);
+    return total;
+}
+
+static void testBuffered(Os::BufferedFile::SyncPolicy policy) {
+    Os::BufferedFile file;
+    bool created = file.create(BLOCK_SIZE, policy);
+    FW_ASSERT(created);
+    FW_ASSERT(file.getBlockSize() == BLOCK_SIZE, file.getBlockSize());
+    U64 total = writeRecords(file, 0);
+    checkFile(RECORDS);
+    FW_ASSERT(file.getBytesWritten() == total);
+    // Every call but the last writes at least a block
+    FW_ASSERT(file.getWriteCalls() <= total / BLOCK_SIZE + 1, file.getWriteCalls());
+
+    // Flushing writes out partial blocks without changing the contents
+    Os::BufferedFile flushed;
+    created = flushed.create(BLOCK_SIZE, policy);
+    FW_ASSERT(created);
+    total = writeRecords(flushed, 10);
+    checkFile(RECORDS);
+    FW_ASSERT(flushed.getBytesWritten() == total);
+    FW_ASSERT(flushed.getWriteCalls() > file.getWriteCalls(), flushed.getWriteCalls());
+}
+
+static void testUnbuffered(void) {
+    Os::BufferedFile file;
+    FW_ASSERT(file.getBlockSize() == 0, file.getBlockSize());
+    U64 total = writeRecords(file, 0);
+    checkFile(RECORDS);
+    FW_ASSERT(file.getBytesWritten() == total);
+    FW_ASSERT(file.getWriteCalls() == RECORDS, file.getWriteCalls());
+}
+
+static void testWriteError(void) {
+    Os::BufferedFile file;
+    bool created = file.create(BLOCK_SIZE);
+    FW_ASSERT(created);
+    Os::File::Status stat = file.open("/dev/full", Os::File::OPEN_WRITE);
+    if (stat != Os::File::OP_OK) {
+        printf("  /dev/full not available, skipping write error check\n");
+        return;
+    }
+    U8 data[BLOCK_SIZE / 2];
+    memset(data, 0, sizeof(data));
+    // buffered, so accepted
+    NATIVE_INT_TYPE size = sizeof(data);
+    stat = file.write(data, size);
+    FW_ASSERT(stat == Os::File::OP_OK, stat);
+    FW_ASSERT(file.getBuffered() == sizeof(data), file.getBuffered());
+    stat = file.flush();
+    FW_ASSERT(stat == Os::File::NO_SPACE, stat);
+    // a full block fails on the write itself, and drops what was buffered
+    stat = file.write(data, size);
+    FW_ASSERT(stat == Os::File::OP_OK, stat);
+    stat = file.write(data, size);
+    FW_ASSERT(stat == Os::File::NO_SPACE, stat);
+    FW_ASSERT(size == 0, size);
+    FW_ASSERT(file.getBuffered() == 0, file.getBuffered());
+    stat = file.close();
+    FW_ASSERT(stat == Os::File::OP_OK, stat);
+}
+
+// Time to write the records, and the write calls made
+static void benchmark(const char* name, NATIVE_UINT_TYPE blockSize) {
+    Os::BufferedFile file;
+    if (blockSize != 0) {
+        bool created = file.create(blockSize, Os::BufferedFile::SYNC_NONE);
+        FW_ASSERT(created);
+    }
+    F64 start = now();
+    U64 total = writeRecords(file, 0);
+    F64 elapsed = now() - start;
+    printf("  %-22s %8.2fus per record, %6u write calls, %8.1f bytes per call\n", name,
+           1000000.0 * elapsed / static_cast<F64>(RECORDS), file.getWriteCalls(),
+           static_cast<F64>(total) / static_cast<F64>(file.getWriteCalls()));
+}
+
+int main(int argc, char* argv[]) {
+    printf("-----------------------------\n");
+    printf("---- buffered file test -----\n");
+    printf("-----------------------------\n");
+    testBuffered(Os::BufferedFile::SYNC_NONE);
+    testBuffered(Os::BufferedFile::SYNC_ON_FLUSH);
+    testBuffered(Os::BufferedFile::SYNC_ON_WRITE);
+    testUnbuffered();
+    testWriteError();
+    benchmark("File::write", 0);
+    benchmark("512 byte blocks", 512);
+    benchmark("4096 byte blocks", 4096);
+    benchmark("65536 byte blocks", 65536);
+    (void) unlink(FILE_NAME);
+    return 0;
+}
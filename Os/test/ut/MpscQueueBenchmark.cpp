@@ -0,0 +1,151 @@
+// ======================================================================
+// \title  MpscQueueBenchmark.cpp
+// \brief  Contention benchmark for Os::MpscQueue
+//
+//         1, 4, 8 and 16 producer threads send to one consumer thread,
+//         first through an Os::MpscQueue and then through an Os::Queue
+//         of the backend selected by FPRIME_OS_QUEUE. The consumer checks
+//         that every message arrives and that each producer's messages
+//         arrive in order.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Os/MpscQueue.hpp>
+#include <Os/Queue.hpp>
+#include <Fw/Types/EightyCharString.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+enum {
+    MSG_SIZE = 64, // typical serialized async port call
+    QUEUE_DEPTH = 64,
+    TOTAL_MESSAGES = 1600000, // divisible by every producer count
+    MAX_PRODUCERS = 16
+};
+
+static F64 now(void) {
+    timespec time;
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<F64>(time.tv_sec) + static_cast<F64>(time.tv_nsec) / 1000000000.0;
+}
+
+// Either queue type behind one interface, so both run the same benchmark
+class BenchQueue {
+    public:
+        virtual ~BenchQueue() {}
+        virtual Os::Queue::QueueStatus send(const U8* buffer, NATIVE_INT_TYPE size) = 0;
+        virtual Os::Queue::QueueStatus receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &size) = 0;
+};
+
+class BenchMpscQueue : public BenchQueue {
+    public:
+        BenchMpscQueue() {
+            Os::Queue::QueueStatus stat = m_queue.create(QUEUE_DEPTH, MSG_SIZE);
+            FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+        }
+        Os::Queue::QueueStatus send(const U8* buffer, NATIVE_INT_TYPE size) {
+            return m_queue.send(buffer, size, 0, Os::Queue::QUEUE_BLOCKING);
+        }
+        Os::Queue::QueueStatus receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &size) {
+            NATIVE_INT_TYPE priority;
+            return m_queue.receive(buffer, capacity, size, priority, Os::Queue::QUEUE_BLOCKING);
+        }
+    private:
+        Os::MpscQueue m_queue;
+};
+
+class BenchOsQueue : public BenchQueue {
+    public:
+        BenchOsQueue() {
+            Os::Queue::QueueStatus stat = m_queue.create(Fw::EightyCharString("BenchQ"), QUEUE_DEPTH, MSG_SIZE);
+            FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+        }
+        Os::Queue::QueueStatus send(const U8* buffer, NATIVE_INT_TYPE size) {
+            return m_queue.send(buffer, size, 0, Os::Queue::QUEUE_BLOCKING);
+        }
+        Os::Queue::QueueStatus receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &size) {
+            NATIVE_INT_TYPE priority;
+            return m_queue.receive(buffer, capacity, size, priority, Os::Queue::QUEUE_BLOCKING);
+        }
+    private:
+        Os::Queue m_queue;
+};
+
+struct ProducerArgs {
+    BenchQueue* queue;
+    U32 id;
+    U32 count;
+};
+
+static void* producerTask(void* arg) {
+    ProducerArgs* args = static_cast<ProducerArgs*>(arg);
+    U8 msg[MSG_SIZE];
+    memset(msg, 0, sizeof(msg));
+    for (U32 seq = 0; seq < args->count; seq++) {
+        memcpy(&msg[0], &args->id, sizeof(U32));
+        memcpy(&msg[sizeof(U32)], &seq, sizeof(U32));
+        Os::Queue::QueueStatus stat = args->queue->send(msg, sizeof(msg));
+        FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    }
+    return NULL;
+}
+
+static void runContention(const char* name, BenchQueue& queue, U32 producers) {
+    pthread_t threads[MAX_PRODUCERS];
+    ProducerArgs args[MAX_PRODUCERS];
+    U32 next[MAX_PRODUCERS];
+    const U32 perProducer = TOTAL_MESSAGES / producers;
+
+    F64 start = now();
+    for (U32 producer = 0; producer < producers; producer++) {
+        args[producer].queue = &queue;
+        args[producer].id = producer;
+        args[producer].count = perProducer;
+        next[producer] = 0;
+        int ret = pthread_create(&threads[producer], NULL, producerTask, &args[producer]);
+        FW_ASSERT(ret == 0, ret);
+    }
+    U8 msg[MSG_SIZE];
+    for (U32 received = 0; received < perProducer * producers; received++) {
+        NATIVE_INT_TYPE size = 0;
+        Os::Queue::QueueStatus stat = queue.receive(msg, sizeof(msg), size);
+        FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+        FW_ASSERT(size == MSG_SIZE, size);
+        U32 id;
+        U32 seq;
+        memcpy(&id, &msg[0], sizeof(U32));
+        memcpy(&seq, &msg[sizeof(U32)], sizeof(U32));
+        FW_ASSERT(id < producers, id);
+        FW_ASSERT(seq == next[id], seq, next[id], id);
+        next[id]++;
+    }
+    for (U32 producer = 0; producer < producers; producer++) {
+        int ret = pthread_join(threads[producer], NULL);
+        FW_ASSERT(ret == 0, ret);
+    }
+    F64 elapsed = now() - start;
+    printf("%-10s %2u producers: %10.0f msgs/s\n", name, producers,
+           static_cast<F64>(perProducer * producers) / elapsed);
+}
+
+int main(int argc, char* argv[]) {
+    static const U32 PRODUCER_COUNTS[] = {1, 4, 8, 16};
+    printf("-----------------------------\n");
+    printf("---- MPSC queue benchmark ---\n");
+    printf("-----------------------------\n");
+    for (U32 index = 0; index < FW_NUM_ARRAY_ELEMENTS(PRODUCER_COUNTS); index++) {
+        BenchMpscQueue mpsc;
+        runContention("MpscQueue", mpsc, PRODUCER_COUNTS[index]);
+        BenchOsQueue queue;
+        runContention("Os::Queue", queue, PRODUCER_COUNTS[index]);
+    }
+    return 0;
+}
@@ -0,0 +1,148 @@
+// ======================================================================
+// \title  OsQueueBenchmark.cpp
+// \brief  Latency and throughput benchmark for Os::Queue
+//
+//         Measures whichever Os::Queue backend the build selected (see
+//         FPRIME_OS_QUEUE in cmake/Options.cmake). Build once per backend
+//         to compare them:
+//
+//         - single thread send/receive with no contention
+//         - round trip latency between two threads over a pair of queues
+//         - throughput from one sending thread to one receiving thread
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Os/Queue.hpp>
+#include <Fw/Types/EightyCharString.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+enum {
+    MSG_SIZE = 64, // typical serialized async port call
+    QUEUE_DEPTH = 10, // default Linux mq msg_max, so the Posix backend can run
+    UNCONTENDED_ITERATIONS = 1000000,
+    ROUND_TRIPS = 100000,
+    THROUGHPUT_MESSAGES = 1000000
+};
+
+static F64 now(void) {
+    timespec time;
+    (void)clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<F64>(time.tv_sec) + static_cast<F64>(time.tv_nsec) / 1000000000.0;
+}
+
+static Os::Queue* createQueue(const char* name) {
+    Os::Queue* queue = new Os::Queue();
+    Os::Queue::QueueStatus stat = queue->create(Fw::EightyCharString(name), QUEUE_DEPTH, MSG_SIZE);
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    return queue;
+}
+
+static void sendMsg(Os::Queue* queue, U32 value, Os::Queue::QueueBlocking block) {
+    U8 msg[MSG_SIZE];
+    memset(msg, 0, sizeof(msg));
+    memcpy(msg, &value, sizeof(value));
+    Os::Queue::QueueStatus stat = queue->send(msg, sizeof(msg), 0, block);
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+}
+
+static U32 receiveMsg(Os::Queue* queue, Os::Queue::QueueBlocking block) {
+    U8 msg[MSG_SIZE];
+    NATIVE_INT_TYPE size = 0;
+    NATIVE_INT_TYPE priority = 0;
+    Os::Queue::QueueStatus stat = queue->receive(msg, sizeof(msg), size, priority, block);
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    FW_ASSERT(size == MSG_SIZE, size);
+    U32 value;
+    memcpy(&value, msg, sizeof(value));
+    return value;
+}
+
+// Queues shared with the second thread
+static Os::Queue* s_request = NULL;
+static Os::Queue* s_response = NULL;
+
+static void* echoTask(void*) {
+    for (U32 trip = 0; trip < ROUND_TRIPS; trip++) {
+        U32 value = receiveMsg(s_request, Os::Queue::QUEUE_BLOCKING);
+        sendMsg(s_response, value, Os::Queue::QUEUE_BLOCKING);
+    }
+    return NULL;
+}
+
+static void* consumerTask(void*) {
+    for (U32 count = 0; count < THROUGHPUT_MESSAGES; count++) {
+        U32 value = receiveMsg(s_request, Os::Queue::QUEUE_BLOCKING);
+        FW_ASSERT(value == count, value, count);
+    }
+    return NULL;
+}
+
+void qbench_uncontended(void) {
+    Os::Queue* queue = createQueue("BenchQ");
+    F64 start = now();
+    for (U32 iter = 0; iter < UNCONTENDED_ITERATIONS; iter++) {
+        sendMsg(queue, iter, Os::Queue::QUEUE_NONBLOCKING);
+        U32 value = receiveMsg(queue, Os::Queue::QUEUE_NONBLOCKING);
+        FW_ASSERT(value == iter, value, iter);
+    }
+    F64 elapsed = now() - start;
+    printf("Uncontended send+receive: %0.3fus per pair\n",
+           1000000.0 * elapsed / static_cast<F64>(UNCONTENDED_ITERATIONS));
+    delete queue;
+}
+
+void qbench_latency(void) {
+    s_request = createQueue("BenchReqQ");
+    s_response = createQueue("BenchRespQ");
+    pthread_t thread;
+    int ret = pthread_create(&thread, NULL, echoTask, NULL);
+    FW_ASSERT(ret == 0, ret);
+    F64 start = now();
+    for (U32 trip = 0; trip < ROUND_TRIPS; trip++) {
+        sendMsg(s_request, trip, Os::Queue::QUEUE_BLOCKING);
+        U32 value = receiveMsg(s_response, Os::Queue::QUEUE_BLOCKING);
+        FW_ASSERT(value == trip, value, trip);
+    }
+    F64 elapsed = now() - start;
+    ret = pthread_join(thread, NULL);
+    FW_ASSERT(ret == 0, ret);
+    printf("Round trip latency: %0.3fus\n", 1000000.0 * elapsed / static_cast<F64>(ROUND_TRIPS));
+    delete s_request;
+    delete s_response;
+}
+
+void qbench_throughput(void) {
+    s_request = createQueue("BenchReqQ");
+    pthread_t thread;
+    int ret = pthread_create(&thread, NULL, consumerTask, NULL);
+    FW_ASSERT(ret == 0, ret);
+    F64 start = now();
+    for (U32 count = 0; count < THROUGHPUT_MESSAGES; count++) {
+        sendMsg(s_request, count, Os::Queue::QUEUE_BLOCKING);
+    }
+    ret = pthread_join(thread, NULL);
+    FW_ASSERT(ret == 0, ret);
+    F64 elapsed = now() - start;
+    printf("Throughput: %0.0f msgs/s\n", static_cast<F64>(THROUGHPUT_MESSAGES) / elapsed);
+    delete s_request;
+}
+
+int main(int argc, char* argv[]) {
+    printf("-----------------------------\n");
+    printf("---- queue benchmark --------\n");
+    printf("-----------------------------\n");
+    qbench_uncontended();
+    qbench_latency();
+    qbench_throughput();
+    return 0;
+}
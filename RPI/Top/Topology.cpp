@@ -142,6 +142,8 @@ void constructApp(U32 port_number, char* hostname) {
     fileDownlink.regCommands();
     health.regCommands();
     rpiDemo.regCommands();
+    rateGroup10HzComp.regCommands();
+    rateGroup1HzComp.regCommands();
 
     // set sequencer timeout
     cmdSeq.setTimeout(30);
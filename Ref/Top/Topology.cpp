@@ -190,6 +190,9 @@ bool constructApp(bool dump, U32 port_number, char* hostname) {
     SG5.regCommands();
     health.regCommands();
     pingRcvr.regCommands();
+    rateGroup1Comp.regCommands();
+    rateGroup2Comp.regCommands();
+    rateGroup3Comp.regCommands();
 
     // read parameters
     prmDb.readParamFile();
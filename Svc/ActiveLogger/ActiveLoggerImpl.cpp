@@ -8,11 +8,15 @@
 #include <Svc/ActiveLogger/ActiveLoggerImpl.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Os/File.hpp>
+#include <string.h>
 
 namespace Svc {
 
     ActiveLoggerImpl::ActiveLoggerImpl(const char* name) : 
-        ActiveLoggerComponentBase(name)
+        ActiveLoggerComponentBase(name),
+        m_idTable(0),
+        m_batching(false),
+        m_batchEvents(0)
     {
         // set filter defaults
         this->m_filterState[FILTER_WARNING_HI].enabled =
@@ -29,6 +33,7 @@ namespace Svc {
                 FILTER_DIAGNOSTIC_DEFAULT?FILTER_ENABLED:FILTER_DISABLED;
 
         memset(m_filteredIDs,0,sizeof(m_filteredIDs));
+        memset(m_filteredSlots,0,sizeof(m_filteredSlots));
 
     }
 
@@ -42,6 +47,29 @@ namespace Svc {
         ActiveLoggerComponentBase::init(queueDepth,instance);
     }
 
+    void ActiveLoggerImpl::setIdTable(const Fw::IdTable& idTable) {
+
+        // Make sure that there are enough filter bits for the table
+        FW_ASSERT(idTable.numSlots <= ACTIVE_LOGGER_ID_TABLE_SLOTS,idTable.numSlots);
+
+        memset(this->m_filteredSlots,0,sizeof(this->m_filteredSlots));
+        this->m_idTable = &idTable;
+
+        // move any IDs already filtered that are in the table to their bits
+        for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
+            NATIVE_UINT_TYPE slot;
+            if ((this->m_filteredIDs[entry] != 0) &&
+                Fw::IdTableUtils::lookup(idTable,this->m_filteredIDs[entry],slot)) {
+                this->m_filteredSlots[slot / 32] |= (1U << (slot % 32));
+                this->m_filteredIDs[entry] = 0;
+            }
+        }
+    }
+
+    void ActiveLoggerImpl::setBatching(bool enable) {
+        this->m_batching = enable;
+    }
+
     void ActiveLoggerImpl::LogRecv_handler(NATIVE_INT_TYPE portNum, FwEventIdType id, Fw::Time &timeTag, Fw::LogSeverity severity, Fw::LogBuffer &args) {
 
         // make sure ID is not zero. Zero is reserved for ID filter.
@@ -86,13 +114,8 @@ namespace Svc {
         }
 
         // check ID filters
-        for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-            if (
-              (m_filteredIDs[entry] == id) &&
-              (severity != Fw::LOG_FATAL)
-              ) {
-                return;
-            }
+        if ((severity != Fw::LOG_FATAL) && this->isIdFiltered(id)) {
+            return;
         }
 
         // send event to the logger thread
@@ -116,11 +139,85 @@ namespace Svc {
         Fw::SerializeStatus stat = this->m_logPacket.serialize(this->m_comBuffer);
         FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
 
-        if (this->isConnected_PktSend_OutputPort(0)) {
+        if (this->m_batching) {
+            this->batchPacket(this->m_comBuffer);
+            // don't hold a FATAL back
+            if (QUEUE_LOG_FATAL == severity) {
+                this->sendBatch();
+            } else {
+                this->sendBatchIfIdle();
+            }
+        } else if (this->isConnected_PktSend_OutputPort(0)) {
             this->PktSend_out(0, this->m_comBuffer,0);
         }
     }
 
+    bool ActiveLoggerImpl::isIdFiltered(FwEventIdType id) {
+
+        // events in the id table have a filter bit
+        NATIVE_UINT_TYPE slot;
+        if ((this->m_idTable != 0) && Fw::IdTableUtils::lookup(*this->m_idTable,id,slot)) {
+            return (this->m_filteredSlots[slot / 32] & (1U << (slot % 32))) != 0;
+        }
+
+        for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
+            if (this->m_filteredIDs[entry] == id) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ActiveLoggerImpl::batchPacket(const Fw::ComBuffer& packet) {
+
+        // A batch holds each event without its packet descriptor, after its size
+        const U8* const entry = packet.getBuffAddr() + sizeof(FwPacketDescriptorType);
+        const NATIVE_UINT_TYPE entrySize = packet.getBuffLength() - sizeof(FwPacketDescriptorType);
+        const NATIVE_UINT_TYPE batchSize =
+                sizeof(FwPacketDescriptorType) + sizeof(FwBuffSizeType) + entrySize;
+
+        // send the batch if the event doesn't fit
+        if (this->m_batchBuffer.getBuffLength() + sizeof(FwBuffSizeType) + entrySize >
+                this->m_batchBuffer.getBuffCapacity()) {
+            this->sendBatch();
+        }
+
+        // an event too big for any batch is sent in its own packet
+        if (batchSize > this->m_batchBuffer.getBuffCapacity()) {
+            if (this->isConnected_PktSend_OutputPort(0)) {
+                this->PktSend_out(0, const_cast<Fw::ComBuffer&>(packet),0);
+            }
+            return;
+        }
+
+        Fw::SerializeStatus stat;
+        if (0 == this->m_batchEvents) {
+            this->m_batchBuffer.resetSer();
+            stat = this->m_batchBuffer.serialize(
+                    static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_LOG_BATCH));
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+        }
+        stat = this->m_batchBuffer.serialize(entry,entrySize);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+        this->m_batchEvents++;
+    }
+
+    void ActiveLoggerImpl::sendBatch(void) {
+        if (0 == this->m_batchEvents) {
+            return;
+        }
+        if (this->isConnected_PktSend_OutputPort(0)) {
+            this->PktSend_out(0, this->m_batchBuffer,0);
+        }
+        this->m_batchEvents = 0;
+    }
+
+    void ActiveLoggerImpl::sendBatchIfIdle(void) {
+        if (this->m_queue.getNumMsgs() == 0) {
+            this->sendBatch();
+        }
+    }
+
     void ActiveLoggerImpl::SET_EVENT_FILTER_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, EventLevel FilterLevel, FilterEnabled FilterEnable) {
         if (  (FilterLevel > FILTER_DIAGNOSTIC) or
               (FilterLevel < FILTER_WARNING_HI) or
@@ -139,6 +236,16 @@ namespace Svc {
             U32 ID,
             IdFilterEnabled IdFilterEnable //!< ID filter state
         ) {
+        this->setIdFilter(opCode,cmdSeq,ID,IdFilterEnable);
+        this->sendBatchIfIdle();
+    }
+
+    void ActiveLoggerImpl::setIdFilter(
+            FwOpcodeType opCode,
+            U32 cmdSeq,
+            U32 ID,
+            IdFilterEnabled IdFilterEnable
+        ) {
 
         // check parameter
         switch (IdFilterEnable) {
@@ -150,6 +257,25 @@ namespace Svc {
                 return;
         }
 
+        // events in the id table have a filter bit
+        NATIVE_UINT_TYPE slot;
+        if ((this->m_idTable != 0) && Fw::IdTableUtils::lookup(*this->m_idTable,ID,slot)) {
+            const U32 bit = 1U << (slot % 32);
+            if (ID_ENABLED == IdFilterEnable) {
+                this->m_filteredSlots[slot / 32] |= bit;
+                this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+                this->log_ACTIVITY_HI_ID_FILTER_ENABLED(ID);
+            } else if (this->m_filteredSlots[slot / 32] & bit) {
+                this->m_filteredSlots[slot / 32] &= ~bit;
+                this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+                this->log_ACTIVITY_HI_ID_FILTER_REMOVED(ID);
+            } else {
+                this->log_WARNING_LO_ID_FILTER_NOT_FOUND(ID);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+            }
+            return;
+        }
+
         if (ID_ENABLED == IdFilterEnable) { // add ID
             // search list for existing entry
             for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
@@ -201,7 +327,14 @@ namespace Svc {
                     );
         }
 
-        // iterate through ID filter
+        // iterate through ID filter, first the events in the id table
+        if (this->m_idTable != 0) {
+            for (NATIVE_UINT_TYPE slot = 0; slot < this->m_idTable->numSlots; slot++) {
+                if (this->m_filteredSlots[slot / 32] & (1U << (slot % 32))) {
+                    this->log_ACTIVITY_HI_ID_FILTER_ENABLED(this->m_idTable->ids[slot]);
+                }
+            }
+        }
         for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
             if (this->m_filteredIDs[entry] != 0) {
                 this->log_ACTIVITY_HI_ID_FILTER_ENABLED(this->m_filteredIDs[entry]);
@@ -209,6 +342,7 @@ namespace Svc {
         }
 
         this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+        this->sendBatchIfIdle();
     }
 
     void ActiveLoggerImpl::pingIn_handler(
@@ -218,6 +352,10 @@ namespace Svc {
     {
         // return key
         this->pingOut_out(0,key);
+        // a batch held back behind the ping is sent now
+        if (this->m_batching) {
+            this->sendBatchIfIdle();
+        }
     }
 
 } // namespace Svc
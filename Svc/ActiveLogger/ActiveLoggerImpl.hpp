@@ -10,6 +10,7 @@
 
 #include <Svc/ActiveLogger/ActiveLoggerComponentAc.hpp>
 #include <Fw/Log/LogPacket.hpp>
+#include <Fw/Types/IdTable.hpp>
 #include <ActiveLoggerImplCfg.hpp>
 
 namespace Svc {
@@ -22,6 +23,19 @@ namespace Svc {
                     NATIVE_INT_TYPE queueDepth, /*!< The queue depth*/
                     NATIVE_INT_TYPE instance /*!< The instance number*/
                     ); //!< initialization function
+            //! Set the generated event id table. Each event in the table gets
+            //! a filter bit found with a perfect hash, so any number of them can
+            //! be filtered by ID. Events not in the table use the ID filter list.
+            //! Call before any ID filters are set.
+            void setIdTable(
+                    const Fw::IdTable& idTable /*!< generated event id table*/
+                    );
+            //! Turn batching on or off. When on, events are packed into one
+            //! FW_PACKET_LOG_BATCH packet until it is full or the component
+            //! queue is empty, instead of being sent one packet each.
+            void setBatching(
+                    bool enable /*!< whether to batch events*/
+                    );
         PROTECTED:
         PRIVATE:
             void LogRecv_handler(NATIVE_INT_TYPE portNum, FwEventIdType id, Fw::Time &timeTag, Fw::LogSeverity severity, Fw::LogBuffer &args);
@@ -52,6 +66,28 @@ namespace Svc {
                 U32 key /*!< Value to return to pinger*/
             );
 
+            //! Carry out SET_ID_FILTER and send its response
+            void setIdFilter(
+                    FwOpcodeType opCode, //!< The opcode
+                    U32 cmdSeq, //!< The command sequence number
+                    U32 ID, //!< The event ID
+                    IdFilterEnabled IdFilterEnable //!< ID filter state
+                );
+
+            //! Check whether an event ID is filtered
+            bool isIdFiltered(FwEventIdType id);
+
+            //! Add an event packet to the batch, sending the batch first if
+            //! the packet does not fit
+            void batchPacket(const Fw::ComBuffer& packet);
+
+            //! Send the batch if it holds any events
+            void sendBatch(void);
+
+            //! Send the batch if no more messages are waiting in the queue.
+            //! Every async handler calls this last
+            void sendBatchIfIdle(void);
+
             // Filter state
             struct t_filterState {
                 FilterEnabled enabled; //<! filter is enabled
@@ -65,6 +101,17 @@ namespace Svc {
             // value of 0 means no entry
             FwEventIdType m_filteredIDs[TELEM_ID_FILTER_SIZE];
 
+            // generated event id table, or NULL
+            const Fw::IdTable* m_idTable;
+
+            // filter bits for the events in the id table, one per slot
+            U32 m_filteredSlots[(ACTIVE_LOGGER_ID_TABLE_SLOTS + 31) / 32];
+
+            // batching
+            bool m_batching; //!< whether events are batched
+            Fw::ComBuffer m_batchBuffer; //!< com buffer for assembling a batch of events
+            NATIVE_UINT_TYPE m_batchEvents; //!< number of events in the batch
+
     };
 
 }
@@ -25,6 +25,7 @@ namespace Svc {
             Svc::ActiveLoggerGTestBase("testerbase",100),
             m_impl(inst),
             m_receivedPacket(false),
+            m_sentPackets(0),
             m_receivedFatalEvent(false) {
     }
 
@@ -38,6 +39,7 @@ namespace Svc {
         ) {
         this->m_sentPacket = data;
         this->m_receivedPacket = true;
+        this->m_sentPackets++;
     }
 
     void ActiveLoggerImplTester::from_FatalAnnounce_handler(
@@ -571,6 +573,176 @@ namespace Svc {
 
     }
 
+    void ActiveLoggerImplTester::sendEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value) {
+        Fw::LogBuffer buff;
+
+        Fw::SerializeStatus stat = buff.serialize(value);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+        Fw::Time timeTag(TB_NONE,1,2);
+
+        this->invoke_to_LogRecv(0,id,timeTag,severity,buff);
+    }
+
+    void ActiveLoggerImplTester::runFilterIdTable(void) {
+
+        U32 cmdSeq = 21;
+
+        // Table generated by the autocoder for ids 0x100 to 0x127
+        static const U32 ids[] = {
+            0x123,0x111,0x10B,0x119,0x108,0x100,0x10C,0x109,0x10E,0x10F,
+            0x117,0x106,0x122,0x104,0x10A,0x101,0x116,0x11C,0x124,0x114,
+            0x127,0x110,0x125,0x115,0x103,0x107,0x112,0x11E,0x11F,0x11A,
+            0x11D,0x120,0x105,0x126,0x102,0x113,0x121,0x11B,0x10D,0x118};
+        static const U32 seeds[] = {149,36,165,103,164,1,1,2997,34,89};
+        static const Fw::IdTable table = {ids,seeds,FW_NUM_ARRAY_ELEMENTS(ids),FW_NUM_ARRAY_ELEMENTS(seeds)};
+
+        // an ID filtered before the table is set moves to the table
+        this->sendCmd_SET_ID_FILTER(0,cmdSeq,0x100,ActiveLoggerComponentBase::ID_ENABLED);
+        this->m_impl.doDispatch();
+        this->m_impl.setIdTable(table);
+        ASSERT_EQ(0u,this->m_impl.m_filteredIDs[0]);
+
+        // filter more IDs from the table than the ID filter list holds
+        ASSERT_GT(FW_NUM_ARRAY_ELEMENTS(ids),static_cast<NATIVE_UINT_TYPE>(TELEM_ID_FILTER_SIZE));
+        for (NATIVE_UINT_TYPE entry = 1; entry < FW_NUM_ARRAY_ELEMENTS(ids); entry++) {
+            this->clearHistory();
+            this->sendCmd_SET_ID_FILTER(0,cmdSeq,0x100 + entry,ActiveLoggerComponentBase::ID_ENABLED);
+            this->m_impl.doDispatch();
+            ASSERT_CMD_RESPONSE_SIZE(1);
+            ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_SET_ID_FILTER,cmdSeq,Fw::COMMAND_OK);
+            ASSERT_EVENTS_ID_FILTER_ENABLED_SIZE(1);
+            ASSERT_EVENTS_ID_FILTER_ENABLED(0,0x100 + entry);
+        }
+        // the list is still free for IDs not in the table
+        this->clearHistory();
+        this->sendCmd_SET_ID_FILTER(0,cmdSeq,0x200,ActiveLoggerComponentBase::ID_ENABLED);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_SET_ID_FILTER,cmdSeq,Fw::COMMAND_OK);
+
+        // filtered IDs don't get to the queue
+        for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(ids); entry++) {
+            this->sendEvent(ids[entry],Fw::LOG_ACTIVITY_HI,10);
+            ASSERT_EQ(0,this->m_impl.m_queue.getNumMsgs());
+        }
+        this->sendEvent(0x200,Fw::LOG_ACTIVITY_HI,10);
+        ASSERT_EQ(0,this->m_impl.m_queue.getNumMsgs());
+        // unfiltered IDs do
+        this->writeEvent(0x128,Fw::LOG_ACTIVITY_HI,10);
+
+        // dump shows all of them
+        this->clearHistory();
+        this->sendCmd_DUMP_FILTER_STATE(0,cmdSeq);
+        this->m_impl.doDispatch();
+        ASSERT_EVENTS_ID_FILTER_ENABLED_SIZE(FW_NUM_ARRAY_ELEMENTS(ids) + 1);
+
+        // remove an ID in the table, then remove it again
+        this->clearHistory();
+        this->sendCmd_SET_ID_FILTER(0,cmdSeq,0x110,ActiveLoggerComponentBase::ID_DISABLED);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_SET_ID_FILTER,cmdSeq,Fw::COMMAND_OK);
+        ASSERT_EVENTS_ID_FILTER_REMOVED_SIZE(1);
+        ASSERT_EVENTS_ID_FILTER_REMOVED(0,0x110);
+        this->writeEvent(0x110,Fw::LOG_ACTIVITY_HI,10);
+
+        this->clearHistory();
+        this->sendCmd_SET_ID_FILTER(0,cmdSeq,0x110,ActiveLoggerComponentBase::ID_DISABLED);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_SET_ID_FILTER,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+        ASSERT_EVENTS_ID_FILTER_NOT_FOUND_SIZE(1);
+        ASSERT_EVENTS_ID_FILTER_NOT_FOUND(0,0x110);
+
+    }
+
+    void ActiveLoggerImplTester::runBatching(void) {
+
+        this->m_impl.setBatching(true);
+
+        // events queued together go out in one batch once the queue is empty
+        const NATIVE_INT_TYPE numEvents = 3;
+        this->m_sentPackets = 0;
+        for (NATIVE_INT_TYPE event = 0; event < numEvents; event++) {
+            this->sendEvent(10 + event,Fw::LOG_ACTIVITY_HI,event);
+        }
+        for (NATIVE_INT_TYPE event = 0; event < numEvents; event++) {
+            ASSERT_EQ(0,this->m_sentPackets);
+            this->m_impl.doDispatch();
+        }
+        ASSERT_EQ(1,this->m_sentPackets);
+
+        // the batch descriptor, then each event after its size
+        FwPacketDescriptorType desc;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(desc));
+        ASSERT_EQ(desc,(FwPacketDescriptorType)Fw::ComPacket::FW_PACKET_LOG_BATCH);
+        for (NATIVE_INT_TYPE event = 0; event < numEvents; event++) {
+            FwBuffSizeType size;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(size));
+            ASSERT_EQ(sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE + sizeof(U32),size);
+            FwEventIdType id;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(id));
+            ASSERT_EQ(static_cast<FwEventIdType>(10 + event),id);
+            Fw::Time timeTag;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(timeTag));
+            ASSERT_EQ(Fw::Time(TB_NONE,1,2),timeTag);
+            U32 value;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(value));
+            ASSERT_EQ(static_cast<U32>(event),value);
+        }
+        ASSERT_EQ(0u,this->m_sentPacket.getBuffLeft());
+
+        // a full batch is sent as soon as the next event doesn't fit
+        const NATIVE_UINT_TYPE eventSize =
+            sizeof(FwBuffSizeType) + sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE + sizeof(U32);
+        const NATIVE_INT_TYPE perBatch = (FW_COM_BUFFER_MAX_SIZE - sizeof(FwPacketDescriptorType)) / eventSize;
+        this->m_sentPackets = 0;
+        for (NATIVE_INT_TYPE event = 0; event < perBatch + 1; event++) {
+            this->sendEvent(10,Fw::LOG_ACTIVITY_HI,event);
+        }
+        for (NATIVE_INT_TYPE event = 0; event < perBatch; event++) {
+            this->m_impl.doDispatch();
+        }
+        ASSERT_EQ(0,this->m_sentPackets);
+        this->m_impl.doDispatch();
+        ASSERT_EQ(2,this->m_sentPackets);
+
+        // a FATAL is not held back
+        this->m_sentPackets = 0;
+        this->sendEvent(11,Fw::LOG_FATAL,1);
+        this->sendEvent(12,Fw::LOG_ACTIVITY_HI,2);
+        this->m_impl.doDispatch();
+        ASSERT_EQ(1,this->m_sentPackets);
+        this->m_impl.doDispatch();
+        ASSERT_EQ(2,this->m_sentPackets);
+
+        // a batch queued ahead of an async command is sent once the command is done
+        this->m_sentPackets = 0;
+        this->clearHistory();
+        this->sendEvent(13,Fw::LOG_ACTIVITY_HI,3);
+        this->sendCmd_DUMP_FILTER_STATE(0,20);
+        this->m_impl.doDispatch();
+        ASSERT_EQ(0,this->m_sentPackets);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_DUMP_FILTER_STATE,20,Fw::COMMAND_OK);
+        ASSERT_EQ(1,this->m_sentPackets);
+
+        // also when the command fails
+        this->m_sentPackets = 0;
+        this->clearHistory();
+        this->sendEvent(14,Fw::LOG_ACTIVITY_HI,4);
+        this->sendCmd_SET_ID_FILTER(0,21,14,static_cast<ActiveLoggerComponentBase::IdFilterEnabled>(10));
+        this->m_impl.doDispatch();
+        ASSERT_EQ(0,this->m_sentPackets);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_SET_ID_FILTER,21,Fw::COMMAND_VALIDATION_ERROR);
+        ASSERT_EQ(1,this->m_sentPackets);
+
+        // without batching each event has its own packet
+        this->m_impl.setBatching(false);
+        this->writeEvent(29,Fw::LOG_WARNING_HI,10);
+
+    }
+
     void ActiveLoggerImplTester::readEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value, Os::File& file) {
         static const BYTE delimiter = 0xA5;
 
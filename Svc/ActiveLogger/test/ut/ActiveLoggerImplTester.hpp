@@ -29,6 +29,8 @@ namespace Svc {
             void runEventFatal(void);
             void runFileDump(void);
             void runFileDumpErrors(void);
+            void runFilterIdTable(void);
+            void runBatching(void);
 
         private:
 
@@ -46,6 +48,7 @@ namespace Svc {
 
             bool m_receivedPacket;
             Fw::ComBuffer m_sentPacket;
+            NATIVE_INT_TYPE m_sentPackets;
 
             bool m_receivedFatalEvent;
             FwEventIdType m_fatalID;
@@ -54,6 +57,7 @@ namespace Svc {
 
             void writeEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value);
             void readEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value, Os::File& file);
+            void sendEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value);
 
             // open call modifiers
 
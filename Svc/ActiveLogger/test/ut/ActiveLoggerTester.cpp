@@ -150,6 +150,44 @@ TEST(ActiveLoggerTest,FatalTesting) {
 
 }
 
+TEST(ActiveLoggerTest,FilterIdTableTest) {
+
+    TEST_CASE(100.1.5,"Event ID table filter");
+
+    Svc::ActiveLoggerImpl impl("ActiveLoggerImpl");
+
+    impl.init(10,0);
+
+    Svc::ActiveLoggerImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runFilterIdTable();
+
+}
+
+TEST(ActiveLoggerTest,BatchingTest) {
+
+    TEST_CASE(100.1.6,"Event batching");
+
+    Svc::ActiveLoggerImpl impl("ActiveLoggerImpl");
+
+    impl.init(10,0);
+
+    Svc::ActiveLoggerImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runBatching();
+
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
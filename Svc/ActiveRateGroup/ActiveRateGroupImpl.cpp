@@ -17,6 +17,7 @@
 #include <Fw/Types/BasicTypes.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Os/Log.hpp>
+#include <string.h>
 
 namespace Svc {
 
@@ -26,7 +27,10 @@ namespace Svc {
             m_maxTime(0),
             m_cycleStarted(false),
             m_overrunThrottle(0),
-            m_cycleSlips(0) {
+            m_cycleSlips(0),
+            m_hogMember(0),
+            m_hogTime(0),
+            m_budgetOverruns(0) {
         FW_ASSERT(contexts);
         FW_ASSERT(numContexts == static_cast<NATIVE_UINT_TYPE>(this->getNum_RateGroupMemberOut_OutputPorts()),numContexts,this->getNum_RateGroupMemberOut_OutputPorts());
         FW_ASSERT(FW_NUM_ARRAY_ELEMENTS(this->m_contexts) == this->getNum_RateGroupMemberOut_OutputPorts(),
@@ -36,7 +40,11 @@ namespace Svc {
         // copy context values
         for (NATIVE_INT_TYPE entry = 0; entry < this->getNum_RateGroupMemberOut_OutputPorts(); entry++) {
             this->m_contexts[entry] = contexts[entry];
+            this->m_memberTimes[entry].budget = 0;
+            this->m_memberTimes[entry].budgetThrottle = 0;
         }
+
+        this->clearMemberTimes();
     }
     
     void ActiveRateGroupImpl::init(NATIVE_INT_TYPE queueDepth, NATIVE_INT_TYPE instance) {
@@ -47,6 +55,16 @@ namespace Svc {
 
     }
 
+    void ActiveRateGroupImpl::setMemberBudgets(const U32 budgets[], NATIVE_UINT_TYPE numBudgets) {
+        FW_ASSERT(budgets);
+        FW_ASSERT(numBudgets <= static_cast<NATIVE_UINT_TYPE>(this->getNum_RateGroupMemberOut_OutputPorts()),numBudgets,this->getNum_RateGroupMemberOut_OutputPorts());
+
+        for (NATIVE_UINT_TYPE entry = 0; entry < numBudgets; entry++) {
+            this->m_memberTimes[entry].budget = budgets[entry];
+            this->m_memberTimes[entry].budgetThrottle = 0;
+        }
+    }
+
     void ActiveRateGroupImpl::preamble(void) {
         this->log_DIAGNOSTIC_RateGroupStarted();
     }
@@ -57,10 +75,14 @@ namespace Svc {
 
         this->m_cycleStarted = false;
 
-        // invoke any members of the rate group
+        // invoke any members of the rate group, timing each one
         for (NATIVE_INT_TYPE port = 0; port < this->getNum_RateGroupMemberOut_OutputPorts(); port++) {
             if (this->isConnected_RateGroupMemberOut_OutputPort(port)) {
+                TimerVal memberStart;
+                memberStart.take();
                 this->RateGroupMemberOut_out(port,this->m_contexts[port]);
+                end.take();
+                this->updateMemberTime(port,end.diffUSec(memberStart));
             }
         }
 
@@ -99,6 +121,65 @@ namespace Svc {
 
     }
 
+    void ActiveRateGroupImpl::updateMemberTime(NATIVE_INT_TYPE port, U32 time) {
+        MemberTimes& member = this->m_memberTimes[port];
+
+        if ((member.calls == 0) || (time < member.minTime)) {
+            member.minTime = time;
+        }
+        if (time > member.maxTime) {
+            member.maxTime = time;
+        }
+        member.calls++;
+        member.totalTime += time;
+
+        // find the histogram bin. Each bin after the first is twice as wide as the one before.
+        NATIVE_UINT_TYPE bin = 0;
+        U32 limit = ACTIVE_RATE_GROUP_HISTOGRAM_BASE;
+        while ((time >= limit) && (bin < ACTIVE_RATE_GROUP_HISTOGRAM_BINS - 1)) {
+            bin++;
+            limit *= 2;
+        }
+        member.histogram[bin]++;
+
+        // report the member that takes the longest
+        if (time > this->m_hogTime) {
+            this->m_hogTime = time;
+            this->m_hogMember = port;
+            this->tlmWrite_RgHogMember(this->m_hogMember);
+            this->tlmWrite_RgHogMaxTime(this->m_hogTime);
+        }
+
+        // check the member budget
+        if ((member.budget > 0) && (time > member.budget)) {
+            member.overBudget++;
+            this->m_budgetOverruns++;
+            if (member.budgetThrottle < ACTIVE_RATE_GROUP_BUDGET_THROTTLE) {
+                this->log_WARNING_HI_RateGroupMemberOverBudget(port,time,member.budget);
+                member.budgetThrottle++;
+            }
+            this->tlmWrite_RgBudgetOverruns(this->m_budgetOverruns);
+        } else { // if call is within budget start decrementing throttle value
+            if (member.budgetThrottle > 0) {
+                member.budgetThrottle--;
+            }
+        }
+    }
+
+    void ActiveRateGroupImpl::clearMemberTimes(void) {
+        for (NATIVE_INT_TYPE port = 0; port < this->getNum_RateGroupMemberOut_OutputPorts(); port++) {
+            MemberTimes& member = this->m_memberTimes[port];
+            member.calls = 0;
+            member.minTime = 0;
+            member.maxTime = 0;
+            member.totalTime = 0;
+            memset(member.histogram,0,sizeof(member.histogram));
+            member.overBudget = 0;
+        }
+        this->m_hogMember = 0;
+        this->m_hogTime = 0;
+    }
+
     void ActiveRateGroupImpl::CycleIn_preMsgHook(NATIVE_INT_TYPE portNum, Svc::TimerVal& cycleStart) {
         // set flag to indicate cycle has started. Check in thread for overflow.
         this->m_cycleStarted = true;
@@ -109,5 +190,49 @@ namespace Svc {
         this->PingOut_out(0,key);
     }
 
+    void ActiveRateGroupImpl::RG_DUMP_MEMBER_TIMES_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+        for (NATIVE_INT_TYPE port = 0; port < this->getNum_RateGroupMemberOut_OutputPorts(); port++) {
+            const MemberTimes& member = this->m_memberTimes[port];
+            if (member.calls == 0) {
+                continue;
+            }
+            this->log_ACTIVITY_LO_RateGroupMemberTimes(
+                    port,
+                    member.calls,
+                    member.minTime,
+                    member.maxTime,
+                    static_cast<U32>(member.totalTime / member.calls),
+                    member.overBudget);
+            // report the bins that have calls
+            U32 lowerLimit = 0;
+            for (NATIVE_UINT_TYPE bin = 0; bin < ACTIVE_RATE_GROUP_HISTOGRAM_BINS; bin++) {
+                if (member.histogram[bin] > 0) {
+                    this->log_ACTIVITY_LO_RateGroupMemberHistogram(port,member.histogram[bin],lowerLimit);
+                }
+                lowerLimit = (bin == 0) ? ACTIVE_RATE_GROUP_HISTOGRAM_BASE : 2 * lowerLimit;
+            }
+        }
+        this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+    }
+
+    void ActiveRateGroupImpl::RG_CLEAR_MEMBER_TIMES_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+        this->clearMemberTimes();
+        this->tlmWrite_RgHogMember(this->m_hogMember);
+        this->tlmWrite_RgHogMaxTime(this->m_hogTime);
+        this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+    }
+
+    void ActiveRateGroupImpl::RG_SET_MEMBER_BUDGET_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, U32 member, U32 budget) {
+        if (member >= static_cast<U32>(this->getNum_RateGroupMemberOut_OutputPorts())) {
+            this->log_WARNING_LO_RateGroupMemberInvalid(member);
+            this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_VALIDATION_ERROR);
+            return;
+        }
+        this->m_memberTimes[member].budget = budget;
+        this->m_memberTimes[member].budgetThrottle = 0;
+        this->log_ACTIVITY_HI_RateGroupMemberBudgetSet(member,budget);
+        this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+    }
+
 
 }
@@ -16,6 +16,7 @@
 #define SVC_ACTIVERATEGROUP_IMPL_HPP
 
 #include <Svc/ActiveRateGroup/ActiveRateGroupComponentAc.hpp>
+#include <ActiveRateGroupImplCfg.hpp>
 
 namespace Svc {
 
@@ -27,6 +28,10 @@ namespace Svc {
     //! array at the index corresponding to the output port number. It keeps track of the execution
     //! time of the rate group and detects overruns.
     //!
+    //! It also times each member port call, keeping the minimum, maximum, mean and
+    //! a histogram of the execution times of each member, and can warn when a member
+    //! takes longer than a budget set for it.
+    //!
 
     class ActiveRateGroupImpl : public ActiveRateGroupComponentBase {
         public:
@@ -59,6 +64,18 @@ namespace Svc {
 
             ~ActiveRateGroupImpl(void);
 
+            //!  \brief Set the execution time budgets of the rate group members
+            //!
+            //!  A member that takes longer than its budget raises a throttled warning.
+            //!  A budget of zero means the member has none. Budgets can also be set by command.
+            //!
+            //!  \param budgets Array of budgets in microseconds. The index of the array
+            //!         corresponds to the output port number.
+            //!  \param numBudgets The number of elements in the budget array. Must not be
+            //!         more than the number of output ports.
+
+            void setMemberBudgets(const U32 budgets[], NATIVE_UINT_TYPE numBudgets);
+
         PRIVATE:
 
             //!  \brief Input cycle port handler
@@ -99,12 +116,68 @@ namespace Svc {
 
             void preamble(void);
 
+            //!  \brief Dump member times command handler
+            //!
+            //!  Reports the execution times of each member that has been called as events
+            //!
+            //!  \param opCode The opcode
+            //!  \param cmdSeq The command sequence number
+
+            void RG_DUMP_MEMBER_TIMES_cmdHandler(FwOpcodeType opCode, U32 cmdSeq);
+
+            //!  \brief Clear member times command handler
+            //!
+            //!  Clears the execution times of the members and the longest member time telemetry
+            //!
+            //!  \param opCode The opcode
+            //!  \param cmdSeq The command sequence number
+
+            void RG_CLEAR_MEMBER_TIMES_cmdHandler(FwOpcodeType opCode, U32 cmdSeq);
+
+            //!  \brief Set member budget command handler
+            //!
+            //!  Sets the execution time budget of one member
+            //!
+            //!  \param opCode The opcode
+            //!  \param cmdSeq The command sequence number
+            //!  \param member The member output port number
+            //!  \param budget The budget in microseconds. Zero removes the budget.
+
+            void RG_SET_MEMBER_BUDGET_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, U32 member, U32 budget);
+
+            //!  \brief Record the execution time of a member port call
+            //!
+            //!  \param port The member output port number
+            //!  \param time The execution time in microseconds
+
+            void updateMemberTime(NATIVE_INT_TYPE port, U32 time);
+
+            //!  \brief Clear the execution times of the members, keeping their budgets
+
+            void clearMemberTimes(void);
+
+            //!  \brief Execution times of a rate group member
+            struct MemberTimes {
+                U32 calls; //!< calls timed
+                U32 minTime; //!< minimum execution time in microseconds
+                U32 maxTime; //!< maximum execution time in microseconds
+                U64 totalTime; //!< sum of the execution times in microseconds, for the mean
+                U32 histogram[ACTIVE_RATE_GROUP_HISTOGRAM_BINS]; //!< calls per execution time bin
+                U32 budget; //!< execution time budget in microseconds, or zero for none
+                U32 overBudget; //!< calls that took longer than the budget
+                NATIVE_INT_TYPE budgetThrottle; //!< throttle value for budget events
+            };
+
             U32 m_cycles; //!< cycles executed
             U32 m_maxTime; //!< maximum execution time in microseconds
             volatile bool m_cycleStarted; //!< indicate that cycle has started. Used to detect overruns.
             NATIVE_UINT_TYPE m_contexts[NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS]; //!< Must match number of output ports
             NATIVE_INT_TYPE m_overrunThrottle; //!< throttle value for overrun events
             U32 m_cycleSlips; //!< tracks number of cycle slips
+            MemberTimes m_memberTimes[NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS]; //!< execution times of each member
+            U32 m_hogMember; //!< member with the longest execution time
+            U32 m_hogTime; //!< longest execution time of a member in microseconds
+            U32 m_budgetOverruns; //!< member calls that took longer than their budget
     };
 
 }
@@ -17,6 +17,7 @@
 #include <ActiveRateGroupImplCfg.hpp>
 #include <gtest/gtest.h>
 #include <Fw/Test/UnitTest.hpp>
+#include <Os/Task.hpp>
 
 #include <cstdio>
 #include <cstring>
@@ -29,7 +30,8 @@ namespace Svc {
 
     ActiveRateGroupImplTester::ActiveRateGroupImplTester(Svc::ActiveRateGroupImpl& inst) :
             ActiveRateGroupGTestBase("testerbase",100),
-            m_impl(inst),m_causeOverrun(false),m_callOrder(0) {
+            m_impl(inst),m_causeOverrun(false),m_callOrder(0),
+            m_slowPort(-1),m_slowTime(0) {
         this->clearPortCalls();
     }
 
@@ -38,6 +40,17 @@ namespace Svc {
         this->m_callOrder = 0;
     }
 
+    NATIVE_INT_TYPE ActiveRateGroupImplTester::hogTlmSize(void) {
+        return this->tlmHistory_RgHogMember->size() + this->tlmHistory_RgHogMaxTime->size();
+    }
+
+    void ActiveRateGroupImplTester::runCycle(void) {
+        Svc::TimerVal timer;
+        timer.take();
+        this->invoke_to_CycleIn(0,timer);
+        this->m_impl.doDispatch();
+    }
+
 
     ActiveRateGroupImplTester::~ActiveRateGroupImplTester() {
     }
@@ -54,6 +67,10 @@ namespace Svc {
             this->invoke_to_CycleIn(0,zero);
             this->m_causeOverrun = false;
         }
+        // a slow member port call
+        if (portNum == this->m_slowPort) {
+            Os::Task::delay(this->m_slowTime);
+        }
     }
 
     void ActiveRateGroupImplTester ::
@@ -105,8 +122,8 @@ namespace Svc {
         // Timer should be non-zero
         REQUIREMENT("ARG-003");
 
-        // Should have gotten write of size
-        ASSERT_TLM_SIZE(1);
+        // Should have gotten write of size, and of the longest member time if any member took time
+        ASSERT_TLM_SIZE(1 + this->hogTlmSize());
         // Should not have slip
         ASSERT_EVENTS_RateGroupCycleSlip_SIZE(0);
         // Should not have increased cycle slip counter
@@ -167,9 +184,9 @@ namespace Svc {
 
             // check to see if max time was put out
             if (this->tlmHistory_RgMaxTime->size() == 1) {
-                ASSERT_TLM_SIZE(2);
+                ASSERT_TLM_SIZE(2 + this->hogTlmSize());
             } else {
-                ASSERT_TLM_SIZE(1);
+                ASSERT_TLM_SIZE(1 + this->hogTlmSize());
             }
             ASSERT_TLM_RgCycleSlips_SIZE(1);
             ASSERT_TLM_RgCycleSlips(0,(U32)(cycle+1));
@@ -213,9 +230,9 @@ namespace Svc {
         // verify channel updated
         // check to see if max time was put out
         if (this->tlmHistory_RgMaxTime->size() == 1) {
-            ASSERT_TLM_SIZE(2);
+            ASSERT_TLM_SIZE(2 + this->hogTlmSize());
         } else {
-            ASSERT_TLM_SIZE(1);
+            ASSERT_TLM_SIZE(1 + this->hogTlmSize());
         }
         ASSERT_TLM_RgCycleSlips_SIZE(1);
         ASSERT_TLM_RgCycleSlips(0,(U32)(ACTIVE_RATE_GROUP_OVERRUN_THROTTLE+1));
@@ -255,7 +272,7 @@ namespace Svc {
         ASSERT_EQ(this->m_impl.m_overrunThrottle,ACTIVE_RATE_GROUP_OVERRUN_THROTTLE-1);
 
         // verify channel not updated
-        ASSERT_TLM_SIZE(0);
+        ASSERT_TLM_SIZE(this->hogTlmSize());
         ASSERT_TLM_RgCycleSlips_SIZE(0);
 
         // Now one more slip to verify event is sent again
@@ -294,9 +311,9 @@ namespace Svc {
         // verify channel updated
         // check to see if max time was put out
         if (this->tlmHistory_RgMaxTime->size() == 1) {
-            ASSERT_TLM_SIZE(2);
+            ASSERT_TLM_SIZE(2 + this->hogTlmSize());
         } else {
-            ASSERT_TLM_SIZE(1);
+            ASSERT_TLM_SIZE(1 + this->hogTlmSize());
         }
         ASSERT_TLM_RgCycleSlips_SIZE(1);
         ASSERT_TLM_RgCycleSlips(0,(U32)(ACTIVE_RATE_GROUP_OVERRUN_THROTTLE+2));
@@ -315,4 +332,92 @@ namespace Svc {
 
     }
 
+    void ActiveRateGroupImplTester::runMemberTimes(void) {
+
+        TEST_CASE(101.3.1,"Time rate group members");
+
+        const NATIVE_INT_TYPE numPorts =
+            (NATIVE_INT_TYPE)FW_NUM_ARRAY_ELEMENTS(this->m_impl.m_RateGroupMemberOut_OutputPort);
+        const NATIVE_INT_TYPE slowPort = 3;
+        const U32 budget = 1000;
+
+        // set a budget for a slow member
+        this->clearHistory();
+        this->sendCmd_RG_SET_MEMBER_BUDGET(0,10,slowPort,budget);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveRateGroupComponentBase::OPCODE_RG_SET_MEMBER_BUDGET,10,Fw::COMMAND_OK);
+        ASSERT_EVENTS_RateGroupMemberBudgetSet_SIZE(1);
+        ASSERT_EVENTS_RateGroupMemberBudgetSet(0,slowPort,budget);
+
+        // a budget for a member that does not exist is rejected
+        this->clearHistory();
+        this->sendCmd_RG_SET_MEMBER_BUDGET(0,11,numPorts,budget);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveRateGroupComponentBase::OPCODE_RG_SET_MEMBER_BUDGET,11,Fw::COMMAND_VALIDATION_ERROR);
+        ASSERT_EVENTS_RateGroupMemberInvalid_SIZE(1);
+        ASSERT_EVENTS_RateGroupMemberInvalid(0,numPorts);
+
+        // run the slow member over its budget until the budget event is throttled
+        this->clearHistory();
+        this->m_slowPort = slowPort;
+        this->m_slowTime = 5;
+        for (NATIVE_INT_TYPE cycle = 0; cycle < ACTIVE_RATE_GROUP_BUDGET_THROTTLE + 1; cycle++) {
+            this->runCycle();
+        }
+        ASSERT_EVENTS_RateGroupMemberOverBudget_SIZE(ACTIVE_RATE_GROUP_BUDGET_THROTTLE);
+        ASSERT_EQ(slowPort,(NATIVE_INT_TYPE)this->eventHistory_RateGroupMemberOverBudget->at(0).member);
+        ASSERT_LT(budget,this->eventHistory_RateGroupMemberOverBudget->at(0).time);
+        ASSERT_EQ(budget,this->eventHistory_RateGroupMemberOverBudget->at(0).budget);
+        ASSERT_EQ(ACTIVE_RATE_GROUP_BUDGET_THROTTLE,this->m_impl.m_memberTimes[slowPort].budgetThrottle);
+        ASSERT_TLM_RgBudgetOverruns_SIZE(ACTIVE_RATE_GROUP_BUDGET_THROTTLE + 1);
+        ASSERT_TLM_RgBudgetOverruns(ACTIVE_RATE_GROUP_BUDGET_THROTTLE,ACTIVE_RATE_GROUP_BUDGET_THROTTLE + 1);
+        // the slow member is the longest
+        ASSERT_TLM_RgHogMember(this->tlmHistory_RgHogMember->size() - 1,slowPort);
+        ASSERT_EQ(this->m_impl.m_memberTimes[slowPort].maxTime,this->m_impl.m_hogTime);
+
+        // a call within budget counts the throttle down
+        this->m_slowPort = -1;
+        this->runCycle();
+        ASSERT_EQ(ACTIVE_RATE_GROUP_BUDGET_THROTTLE - 1,this->m_impl.m_memberTimes[slowPort].budgetThrottle);
+
+        // dump the member times
+        this->clearHistory();
+        this->sendCmd_RG_DUMP_MEMBER_TIMES(0,12);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveRateGroupComponentBase::OPCODE_RG_DUMP_MEMBER_TIMES,12,Fw::COMMAND_OK);
+        ASSERT_EVENTS_RateGroupMemberTimes_SIZE(numPorts);
+        for (NATIVE_INT_TYPE port = 0; port < numPorts; port++) {
+            ASSERT_EQ((U32)port,this->eventHistory_RateGroupMemberTimes->at(port).member);
+            ASSERT_EQ((U32)ACTIVE_RATE_GROUP_BUDGET_THROTTLE + 2,this->eventHistory_RateGroupMemberTimes->at(port).calls);
+        }
+        const EventEntry_RateGroupMemberTimes& slowTimes = this->eventHistory_RateGroupMemberTimes->at(slowPort);
+        ASSERT_LE(slowTimes.minTime,slowTimes.meanTime);
+        ASSERT_LE(slowTimes.meanTime,slowTimes.maxTime);
+        ASSERT_LT(budget,slowTimes.maxTime);
+        ASSERT_EQ((U32)ACTIVE_RATE_GROUP_BUDGET_THROTTLE + 1,slowTimes.overBudget);
+        // the histogram bins of each member add up to its calls
+        U32 binCalls = 0;
+        for (U32 entry = 0; entry < this->eventHistory_RateGroupMemberHistogram->size(); entry++) {
+            if (this->eventHistory_RateGroupMemberHistogram->at(entry).member == (U32)slowPort) {
+                binCalls += this->eventHistory_RateGroupMemberHistogram->at(entry).calls;
+            }
+        }
+        ASSERT_EQ(slowTimes.calls,binCalls);
+
+        // clear the member times
+        this->clearHistory();
+        this->sendCmd_RG_CLEAR_MEMBER_TIMES(0,13);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveRateGroupComponentBase::OPCODE_RG_CLEAR_MEMBER_TIMES,13,Fw::COMMAND_OK);
+        ASSERT_TLM_RgHogMaxTime(0,0);
+        this->clearHistory();
+        this->sendCmd_RG_DUMP_MEMBER_TIMES(0,14);
+        this->m_impl.doDispatch();
+        ASSERT_EVENTS_SIZE(0);
+        // the budget is kept
+        ASSERT_EQ(budget,this->m_impl.m_memberTimes[slowPort].budget);
+
+    }
+
 } /* namespace SvcTest */
@@ -31,6 +31,7 @@ namespace Svc {
             void runNominal(NATIVE_UINT_TYPE contexts[], NATIVE_UINT_TYPE numContexts, NATIVE_INT_TYPE instance);
             void runCycleOverrun(NATIVE_UINT_TYPE contexts[], NATIVE_UINT_TYPE numContexts, NATIVE_INT_TYPE instance);
             void runPingTest(void);
+            void runMemberTimes(void);
 
         private:
 
@@ -47,6 +48,12 @@ namespace Svc {
 
             void clearPortCalls(void);
 
+            //! Number of writes of the longest member time channels, which depend on timing
+            NATIVE_INT_TYPE hogTlmSize(void);
+
+            //! Run one cycle of the rate group
+            void runCycle(void);
+
             struct {
                 bool portCalled;
                 NATIVE_UINT_TYPE contextVal;
@@ -55,6 +62,8 @@ namespace Svc {
 
             bool m_causeOverrun; //!< flag to cause an overrun during a rate group member port call
             NATIVE_UINT_TYPE m_callOrder; //!< tracks order of port call.
+            NATIVE_INT_TYPE m_slowPort; //!< rate group member port call that takes m_slowTime
+            NATIVE_UINT_TYPE m_slowTime; //!< delay in milliseconds of the slow member port call
 
     };
 
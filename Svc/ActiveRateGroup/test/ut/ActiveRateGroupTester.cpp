@@ -40,6 +40,10 @@ void connectPorts(Svc::ActiveRateGroupImpl& impl, Svc::ActiveRateGroupImplTester
     impl.set_PingOut_OutputPort(0,tester.get_from_PingOut(0));
     tester.connect_to_PingIn(0,impl.get_PingIn_InputPort(0));
 
+    tester.connect_to_CmdDisp(0,impl.get_CmdDisp_InputPort(0));
+    impl.set_CmdStatus_OutputPort(0,tester.get_from_CmdStatus(0));
+    impl.set_CmdReg_OutputPort(0,tester.get_from_CmdReg(0));
+
 #if FW_PORT_TRACING
     // Fw::PortBase::setTrace(true);
 #endif
@@ -104,6 +108,20 @@ TEST(ActiveRateGroupTest,PingPort) {
     tester.runPingTest();
 }
 
+TEST(ActiveRateGroupTest,MemberTimes) {
+
+    NATIVE_UINT_TYPE contexts[] = {1,2,3,4,5,6,7,8,9,10};
+
+    Svc::ActiveRateGroupImpl impl("ActiveRateGroupImpl",contexts,FW_NUM_ARRAY_ELEMENTS(contexts));
+    Svc::ActiveRateGroupImplTester tester(impl);
+
+    tester.init();
+    impl.init(10,0);
+
+    connectPorts(impl,tester);
+    tester.runMemberTimes();
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -148,5 +148,10 @@ namespace Svc {
         return this->m_log_file.set_log_file(fileName, maxSize, maxBackups);
     }
 
+    bool ActiveTextLoggerComponentImpl::set_async_writes(const U32 depth)
+    {
+        return this->m_log_file.set_async(depth, FW_INTERNAL_INTERFACE_STRING_MAX_SIZE);
+    }
+
 
 } // namespace Svc
@@ -58,6 +58,16 @@ namespace Svc {
             //!  \return true if creating the file was successful, false otherwise
             bool set_log_file(const char* fileName, const U32 maxSize, const U32 maxBackups = 10);
 
+            //!  \brief Write the log file in the background
+            //!
+            //!  Lines are handed to an Os::AsyncFile so that the component does not wait
+            //!  for the disk. Must be called before set_log_file.
+            //!
+            //!  \param depth The number of lines that may be in flight
+            //!
+            //!  \return true if the asynchronous file was created, false otherwise
+            bool set_async_writes(const U32 depth);
+
 
         PRIVATE:
 
@@ -19,7 +19,8 @@ namespace Svc {
     // ----------------------------------------------------------------------
 
     LogFile::LogFile() :
-        m_fileName(), m_file(), m_maxFileSize(0), m_openFile(false), m_currentFileSize(0)
+        m_fileName(), m_file(), m_asyncFile(), m_async(false), m_maxFileSize(0), m_openFile(false),
+        m_currentFileSize(0)
     {
 
     }
@@ -28,7 +29,7 @@ namespace Svc {
     {
         // Close the file if needed:
         if (this->m_openFile) {
-            this->m_file.close();
+            this->close_file();
         }
     }
 
@@ -55,7 +56,21 @@ namespace Svc {
 
                 status = false;
                 this->m_openFile = false;
-                this->m_file.close();
+                this->close_file();
+            }
+            // Hand the write to the background:
+            else if (this->m_async) {
+
+                Os::AsyncFile::AsyncStatus stat = this->m_asyncFile.write(buf,size);
+                (void) this->m_asyncFile.complete(false);
+
+                // Only return a good status if neither this write nor an earlier one failed
+                NATIVE_UINT_TYPE written = 0;
+                NATIVE_UINT_TYPE requested = 0;
+                status = (stat == Os::AsyncFile::ASYNC_OK) &&
+                         (this->m_asyncFile.getWriteStatus(written,requested) == Os::File::OP_OK);
+
+                this->m_currentFileSize += size;
             }
             // Wont exceed max size, so write to file:
             else {
@@ -84,7 +99,7 @@ namespace Svc {
         // If there is already a previously open file then close it:
         if (this->m_openFile) {
             this->m_openFile = false;
-            this->m_file.close();
+            this->close_file();
         }
 
         // If file name is too large, return failure:
@@ -139,8 +154,13 @@ namespace Svc {
         }
 
         // Open the file (using CREATE so that it truncates an already existing file):
-        Os::File::Status stat = this->m_file.open(fileNameFinal,
-                                                  Os::File::OPEN_CREATE);
+        Os::File::Status stat;
+        if (this->m_async) {
+            stat = this->m_asyncFile.open(fileNameFinal, Os::File::OPEN_CREATE);
+        }
+        else {
+            stat = this->m_file.open(fileNameFinal, Os::File::OPEN_CREATE);
+        }
 
         // Bad status when trying to open the file:
         if (stat != Os::File::OP_OK) {
@@ -156,4 +176,25 @@ namespace Svc {
     }
 
 
+    bool LogFile::set_async(const U32 depth, const U32 bufferSize)
+    {
+        // Switching must happen before a file is opened:
+        FW_ASSERT(not this->m_openFile);
+
+        this->m_async = (this->m_asyncFile.create(depth, bufferSize) == Os::AsyncFile::ASYNC_OK);
+        return this->m_async;
+    }
+
+
+    void LogFile::close_file()
+    {
+        if (this->m_async) {
+            this->m_asyncFile.close();
+        }
+        else {
+            this->m_file.close();
+        }
+    }
+
+
 } // namespace Svc
@@ -8,6 +8,7 @@
 
 #include <Fw/Types/EightyCharString.hpp>
 #include <Os/File.hpp>
+#include <Os/AsyncFile.hpp>
 #include <Os/FileSystem.hpp>
 
 
@@ -49,6 +50,21 @@ namespace Svc {
         //!  \return true if writing to the file was successful, false otherwise
         bool write_to_log(const char *const buf, const U32 size);
 
+        //!  \brief Write through an Os::AsyncFile, so that writing does not wait for the disk
+        //!
+        //!  Must be called before set_log_file. Lines are copied into depth buffers of
+        //!  bufferSize bytes, and a write only waits when all of them are in flight.
+        //!
+        //!  \param depth The number of buffers
+        //!  \param bufferSize The size of each buffer. Longer lines use several buffers.
+        //!
+        //!  \return true if the buffers were created, false otherwise
+        bool set_async(const U32 depth, const U32 bufferSize);
+
+        //!  \brief Close the open file, waiting for any writes in flight
+        //!
+        void close_file();
+
         // ----------------------------------------------------------------------
         // Member Variables
         // ----------------------------------------------------------------------
@@ -59,6 +75,12 @@ namespace Svc {
         // The file to write text logs to:
         Os::File m_file;
 
+        // The file to write text logs to when writes are asynchronous:
+        Os::AsyncFile m_asyncFile;
+
+        // True if writes go through m_asyncFile:
+        bool m_async;
+
         // The max size of the text log file:
         U32 m_maxFileSize;
 
@@ -52,6 +52,30 @@ namespace Svc {
       m_file.init(logFilePrefix, logFileSuffix, maxFileSize, sizeOfSize);
   }
 
+  bool BufferLogger ::
+    setAsyncWrites(
+        const NATIVE_UINT_TYPE depth,
+        const NATIVE_UINT_TYPE bufferSize
+    )
+  {
+      return m_file.setAsync(depth, bufferSize);
+  }
+
+  void BufferLogger ::
+    setSegmentFormat(const U32 indexInterval)
+  {
+      m_file.setSegments(indexInterval);
+  }
+
+  bool BufferLogger ::
+    setBufferedWrites(
+        const NATIVE_UINT_TYPE blockSize,
+        const Os::BufferedFile::SyncPolicy policy
+    )
+  {
+      return m_file.setBuffered(blockSize, policy);
+  }
+
   // ----------------------------------------------------------------------
   // Handler implementations for user-defined typed input ports
   // ----------------------------------------------------------------------
@@ -96,7 +120,14 @@ namespace Svc {
         NATIVE_UINT_TYPE context
     )
   {
-    // TODO
+    (void) m_file.flush();
+    U32 writeCalls = 0;
+    U64 bytes = 0;
+    m_file.getWriteStats(writeCalls, bytes);
+    this->tlmWrite_BufferLogger_FileWrites(writeCalls);
+    this->tlmWrite_BufferLogger_BytesPerWrite(
+      (writeCalls > 0) ? static_cast<F32>(bytes) / static_cast<F32>(writeCalls) : 0.0f
+    );
   }
 
   // ----------------------------------------------------------------------
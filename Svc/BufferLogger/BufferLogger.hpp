@@ -15,6 +15,9 @@
 
 #include "Svc/BufferLogger/BufferLoggerComponentAc.hpp"
 #include "Os/File.hpp"
+#include "Os/AsyncFile.hpp"
+#include "Os/BufferedFile.hpp"
+#include "Svc/BufferLogger/LogSegment.hpp"
 #include "Fw/Types/EightyCharString.hpp"
 #include "Fw/Types/Assert.hpp"
 #include "Os/Mutex.hpp"
@@ -82,6 +85,31 @@ namespace Svc {
           //! Flush the file
           bool flush(void);
 
+          //! Write through an Os::AsyncFile
+          //! \return Success or failure
+          bool setAsync(
+              const NATIVE_UINT_TYPE depth, //!< The number of buffers
+              const NATIVE_UINT_TYPE bufferSize //!< The size of each buffer
+          );
+
+          //! Coalesce writes into blocks
+          //! \return Success or failure
+          bool setBuffered(
+              const NATIVE_UINT_TYPE blockSize, //!< The block size
+              const Os::BufferedFile::SyncPolicy policy //!< When to sync the file data to disk
+          );
+
+          //! Write files in the LogSegment format
+          void setSegments(
+              const U32 indexInterval //!< Records per index entry
+          );
+
+          //! Get the write calls made to the operating system, and the bytes they wrote
+          void getWriteStats(
+              U32& writeCalls, //!< The number of write calls
+              U64& bytes //!< The number of bytes
+          ) const;
+
         PRIVATE:
 
           //! Open the file
@@ -100,6 +128,13 @@ namespace Svc {
               const U32 size //!< The size
           );
 
+          //! Append a buffer to the segment
+          //! \return Success or failure
+          bool writeRecord(
+              const U8 *const data, //!< The buffer data
+              const U32 size //!< The size
+          );
+
           //! Write bytes to a file
           //! \return Success or failure
           bool writeBytes(
@@ -107,6 +142,10 @@ namespace Svc {
               const U32 length //!< The number of bytes to write
           );
 
+          //! Emit an event for the first asynchronous write that failed since the last check
+          //! \return True if none failed
+          bool checkAsyncWrites(void);
+
           //! Write a hash file
           void writeHashFile(void);
 
@@ -142,8 +181,26 @@ namespace Svc {
           // The current mode
           Mode::t mode;
 
-          //! The underlying Os::File representation
-          Os::File osFile;
+          //! The underlying Os::File representation, buffered if setBuffered was called
+          Os::BufferedFile osFile;
+
+          //! The file used instead of osFile when writes are asynchronous
+          Os::AsyncFile asyncFile;
+
+          //! Whether writes go through asyncFile
+          bool async;
+
+          //! The segment written instead of osFile in the LogSegment format
+          LogSegment::Writer segment;
+
+          //! Records per segment index entry, or zero if files are not segments
+          U32 indexInterval;
+
+          //! The sequence number of the next buffer logged, counted across files
+          U32 sequence;
+
+          //! The number of bytes appended to segments
+          U64 segmentBytes;
 
           //! The number of bytes written to the current file
           U32 bytesWritten;
@@ -179,6 +236,33 @@ namespace Svc {
           const U8 sizeOfSize //!< The number of bytes to use when storing the size field at the start of each buffer
       );
 
+      //! Write log files through an Os::AsyncFile, so that logging a buffer does not wait for the disk.
+      //! Data is copied into the given buffers and a write only waits when all of them are in flight.
+      //! Call before the component is started.
+      //! \return Success or failure
+      bool setAsyncWrites(
+          const NATIVE_UINT_TYPE depth, //!< The number of buffers
+          const NATIVE_UINT_TYPE bufferSize //!< The size of each buffer; larger data uses several
+      );
+
+      //! Write log files as memory mapped LogSegment files: each file is created at the maximum file
+      //! size and filled without a system call per buffer, records carry a sequence number and time,
+      //! and a sparse index every indexInterval records lets LogSegment::Reader seek by either.
+      //! Flushing syncs the mapping to disk. Call before the component is started, and instead of
+      //! setAsyncWrites and setBufferedWrites.
+      void setSegmentFormat(
+          const U32 indexInterval //!< Records per index entry
+      );
+
+      //! Coalesce log file writes into blocks of blockSize bytes. A block is written when it fills,
+      //! on each call to schedIn, on BL_FlushFile and when the file is closed. Call before the
+      //! component is started, and instead of setAsyncWrites.
+      //! \return Success or failure
+      bool setBufferedWrites(
+          const NATIVE_UINT_TYPE blockSize, //!< The block size
+          const Os::BufferedFile::SyncPolicy policy //!< When to sync the file data to disk
+      );
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -208,7 +292,7 @@ namespace Svc {
       );
 
       //! Handler implementation for schedIn
-      //!
+      //! Flushes the log file and reports write telemetry
       void schedIn_handler(
           const NATIVE_INT_TYPE portNum, /*!< The port number*/
           NATIVE_UINT_TYPE context /*!< The call order*/
@@ -32,6 +32,10 @@ namespace Svc {
       maxSize(0),
       sizeOfSize(0),
       mode(Mode::CLOSED),
+      async(false),
+      indexInterval(0),
+      sequence(0),
+      segmentBytes(0),
       bytesWritten(0)
   {
   }
@@ -66,6 +70,67 @@ namespace Svc {
       FW_ASSERT(maxSize > sizeOfSize, maxSize);
   }
 
+  bool BufferLogger::File ::
+    setAsync(
+        const NATIVE_UINT_TYPE depth,
+        const NATIVE_UINT_TYPE bufferSize
+    )
+  {
+      //NOTE - only call this before opening the file
+      FW_ASSERT(this->mode == File::Mode::CLOSED);
+      FW_ASSERT(this->osFile.getBlockSize() == 0);
+      FW_ASSERT(this->indexInterval == 0);
+
+      this->async = (this->asyncFile.create(depth, bufferSize) == Os::AsyncFile::ASYNC_OK);
+      return this->async;
+  }
+
+  bool BufferLogger::File ::
+    setBuffered(
+        const NATIVE_UINT_TYPE blockSize,
+        const Os::BufferedFile::SyncPolicy policy
+    )
+  {
+      //NOTE - only call this before opening the file
+      FW_ASSERT(this->mode == File::Mode::CLOSED);
+      FW_ASSERT(!this->async);
+      FW_ASSERT(this->indexInterval == 0);
+
+      return this->osFile.create(blockSize, policy);
+  }
+
+  void BufferLogger::File ::
+    setSegments(const U32 indexInterval)
+  {
+      //NOTE - only call this before opening the file
+      FW_ASSERT(this->mode == File::Mode::CLOSED);
+      FW_ASSERT(!this->async);
+      FW_ASSERT(this->osFile.getBlockSize() == 0);
+      FW_ASSERT(indexInterval > 0);
+
+      this->indexInterval = indexInterval;
+  }
+
+  void BufferLogger::File ::
+    getWriteStats(
+        U32& writeCalls,
+        U64& bytes
+    ) const
+  {
+      if (this->indexInterval > 0) {
+        writeCalls = this->segment.getSyncCalls();
+        bytes = this->segmentBytes;
+      }
+      else if (this->async) {
+        writeCalls = this->asyncFile.getWriteCalls();
+        bytes = this->asyncFile.getBytesWritten();
+      }
+      else {
+        writeCalls = this->osFile.getWriteCalls();
+        bytes = this->osFile.getBytesWritten();
+      }
+  }
+
   void BufferLogger::File ::
     setBaseName(
         const Fw::EightyCharString& baseName
@@ -89,7 +154,9 @@ namespace Svc {
     if (this->mode == File::Mode::OPEN) {
       const U32 projectedByteCount =
         this->bytesWritten + this->sizeOfSize + size;
-      if (projectedByteCount > this->maxSize) {
+      const bool fits = (this->indexInterval > 0) ?
+        this->segment.fits(size) : (projectedByteCount <= this->maxSize);
+      if (!fits) {
         this->closeAndEmitEvent();
       }
     }
@@ -99,7 +166,12 @@ namespace Svc {
     }
     // Write to the file if it is open
     if (this->mode == File::Mode::OPEN) {
-      (void) this->writeBuffer(data, size);
+      if (this->indexInterval > 0) {
+        (void) this->writeRecord(data, size);
+      }
+      else {
+        (void) this->writeBuffer(data, size);
+      }
     }
   }
 
@@ -107,6 +179,8 @@ namespace Svc {
     closeAndEmitEvent(void)
   {
     if (this->mode == File::Mode::OPEN) {
+      // Report writes that failed before the file is closed
+      (void) this->flush();
       this->close();
       Fw::LogStringArg logStringArg(this->name.toChar());
       this->bufferLogger.log_DIAGNOSTIC_BL_LogFileClosed(logStringArg);
@@ -148,10 +222,21 @@ namespace Svc {
         );
     }
 
-    const Os::File::Status status = this->osFile.open(
-        this->name.toChar(),
-        Os::File::OPEN_WRITE
-    );
+    Os::File::Status status;
+    if (this->indexInterval > 0) {
+      status = this->segment.open(
+          this->name.toChar(),
+          this->maxSize,
+          this->indexInterval,
+          this->sequence
+      );
+    }
+    else if (this->async) {
+      status = this->asyncFile.open(this->name.toChar(), Os::File::OPEN_WRITE);
+    }
+    else {
+      status = this->osFile.open(this->name.toChar(), Os::File::OPEN_WRITE);
+    }
     if (status == Os::File::OP_OK) {
       this->fileCounter++;
       // Reset bytes written
@@ -178,6 +263,26 @@ namespace Svc {
     return status;
   }
 
+  bool BufferLogger::File ::
+    writeRecord(
+        const U8 *const data,
+        const U32 size
+    )
+  {
+    const Os::File::Status fileStatus =
+      this->segment.append(this->bufferLogger.getTime(), data, size);
+    if (fileStatus != Os::File::OP_OK) {
+      Fw::LogStringArg string(this->name.toChar());
+      this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(fileStatus, 0, size, string);
+      return false;
+    }
+    // Numbers continue in the next file
+    this->sequence = this->segment.getNextSequence();
+    this->bytesWritten = this->segment.getBytesAppended();
+    this->segmentBytes += size + LogSegment::RECORD_HEADER_SIZE;
+    return true;
+  }
+
   bool BufferLogger::File ::
     writeSize(const U32 size)
   {
@@ -201,6 +306,22 @@ namespace Svc {
     )
   {
     FW_ASSERT(length > 0, length);
+    if (this->async) {
+      // Copy the data and write it in the background, reporting earlier writes that failed
+      const Os::AsyncFile::AsyncStatus asyncStatus = this->asyncFile.write(data, length);
+      (void) this->asyncFile.complete(false);
+      bool status = this->checkAsyncWrites();
+      if (asyncStatus == Os::AsyncFile::ASYNC_OK) {
+        this->bytesWritten += length;
+      }
+      else {
+        Fw::LogStringArg string(this->name.toChar());
+        this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(
+            Os::AsyncFile::toFileStatus(asyncStatus), 0, length, string);
+        status = false;
+      }
+      return status;
+    }
     NATIVE_INT_TYPE size = length;
     const Os::File::Status fileStatus = this->osFile.write(data, size);
     bool status;
@@ -217,6 +338,20 @@ namespace Svc {
     return status;
   }
 
+  bool BufferLogger::File ::
+    checkAsyncWrites(void)
+  {
+    NATIVE_UINT_TYPE written = 0;
+    NATIVE_UINT_TYPE requested = 0;
+    const Os::File::Status fileStatus = this->asyncFile.getWriteStatus(written, requested);
+    if (fileStatus != Os::File::OP_OK) {
+      Fw::LogStringArg string(this->name.toChar());
+      this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(fileStatus, written, requested, string);
+      return false;
+    }
+    return true;
+  }
+
   void BufferLogger::File ::
     writeHashFile(void)
   {
@@ -236,22 +371,30 @@ namespace Svc {
   bool BufferLogger::File ::
   flush(void)
   {
-    return true;
-    // NOTE(if your fprime uses buffered file I/O, re-enable this)
-    /*bool status = true;
-    if(this->mode == File::Mode::OPEN)
-    {
-      const Os::File::Status fileStatus = this->osFile.flush();
-      if(fileStatus == Os::File::OP_OK)
-      {
-        status = true;
+    // Asynchronous writes are flushed by waiting for the writes in flight
+    if (this->async) {
+      this->asyncFile.flush();
+      return this->checkAsyncWrites();
+    }
+    bool status = true;
+    if (this->mode == File::Mode::OPEN && this->indexInterval > 0) {
+      const Os::File::Status fileStatus = this->segment.flush();
+      if (fileStatus != Os::File::OP_OK) {
+        Fw::LogStringArg string(this->name.toChar());
+        this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(fileStatus, 0, 0, string);
+        status = false;
       }
-      else
-      {
+    }
+    else if (this->mode == File::Mode::OPEN) {
+      const NATIVE_UINT_TYPE buffered = this->osFile.getBuffered();
+      const Os::File::Status fileStatus = this->osFile.flush();
+      if (fileStatus != Os::File::OP_OK) {
+        Fw::LogStringArg string(this->name.toChar());
+        this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(fileStatus, 0, buffered, string);
         status = false;
       }
     }
-    return status;*/
+    return status;
   }
 
   void BufferLogger::File ::
@@ -259,7 +402,15 @@ namespace Svc {
   {
     if (this->mode == File::Mode::OPEN) {
       // Close file
-      this->osFile.close();
+      if (this->indexInterval > 0) {
+        (void) this->segment.close();
+      }
+      else if (this->async) {
+        this->asyncFile.close();
+      }
+      else {
+        this->osFile.close();
+      }
       // Write out the hash file to disk
       this->writeHashFile();
       // Update mode
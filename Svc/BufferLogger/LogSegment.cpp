@@ -0,0 +1,506 @@
+// ======================================================================
+// \title  LogSegment.cpp
+// \brief  Implementation for Svc::LogSegment
+//
+// \copyright
+// Copyright (C) 2015-2017 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Svc/BufferLogger/LogSegment.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <string.h>
+
+namespace Svc {
+
+  namespace LogSegment {
+
+    // Header field offsets
+    enum {
+      OFFSET_MAGIC = 0,
+      OFFSET_VERSION = 4,
+      OFFSET_FLAGS = 8,
+      OFFSET_INDEX_INTERVAL = 12,
+      OFFSET_FIRST_SEQUENCE = 16,
+      OFFSET_RECORD_COUNT = 20,
+      OFFSET_DATA_END = 24,
+      OFFSET_INDEX_OFFSET = 28,
+      OFFSET_INDEX_COUNT = 32,
+      OFFSET_TIME_BASE = 36,
+      OFFSET_TIME_CONTEXT = 40
+    };
+
+    static void putU32(U8 *const dest, const U32 value)
+    {
+      dest[0] = static_cast<U8>(value >> 24);
+      dest[1] = static_cast<U8>(value >> 16);
+      dest[2] = static_cast<U8>(value >> 8);
+      dest[3] = static_cast<U8>(value);
+    }
+
+    static U32 getU32(const U8 *const source)
+    {
+      return (static_cast<U32>(source[0]) << 24) |
+        (static_cast<U32>(source[1]) << 16) |
+        (static_cast<U32>(source[2]) << 8) |
+        static_cast<U32>(source[3]);
+    }
+
+    // True if the first time is earlier than the second
+    static bool earlier(
+        const U32 seconds1,
+        const U32 useconds1,
+        const U32 seconds2,
+        const U32 useconds2
+    )
+    {
+      return (seconds1 < seconds2) ||
+        ((seconds1 == seconds2) && (useconds1 < useconds2));
+    }
+
+    // ----------------------------------------------------------------------
+    // Writer
+    // ----------------------------------------------------------------------
+
+    Writer ::
+      Writer(void) :
+        indexInterval(0),
+        firstSequence(0),
+        recordCount(0),
+        dataEnd(0),
+        indexCount(0),
+        syncedEnd(0),
+        syncedIndexCount(0)
+    {
+    }
+
+    Writer ::
+      ~Writer(void)
+    {
+      if (this->isOpen()) {
+        (void) this->close();
+      }
+    }
+
+    Os::File::Status Writer ::
+      open(
+          const char *const fileName,
+          const U32 capacity,
+          const U32 indexInterval,
+          const U32 firstSequence
+      )
+    {
+      FW_ASSERT(!this->isOpen());
+      FW_ASSERT(indexInterval > 0);
+      if (capacity < HEADER_SIZE + INDEX_ENTRY_SIZE) {
+        return Os::File::BAD_SIZE;
+      }
+      const Os::File::Status status =
+        this->file.open(fileName, Os::MappedFile::OPEN_WRITE, capacity);
+      if (status != Os::File::OP_OK) {
+        return status;
+      }
+      this->indexInterval = indexInterval;
+      this->firstSequence = firstSequence;
+      this->recordCount = 0;
+      this->dataEnd = HEADER_SIZE;
+      this->indexCount = 0;
+      this->syncedEnd = 0;
+      this->syncedIndexCount = 0;
+
+      // The file starts out zero, so only the nonzero fields are written
+      U8 *const header = this->file.getData();
+      putU32(&header[OFFSET_MAGIC], MAGIC);
+      putU32(&header[OFFSET_VERSION], VERSION);
+      putU32(&header[OFFSET_INDEX_INTERVAL], indexInterval);
+      putU32(&header[OFFSET_FIRST_SEQUENCE], firstSequence);
+      this->updateHeader();
+      return Os::File::OP_OK;
+    }
+
+    bool Writer ::
+      isOpen(void) const
+    {
+      return this->file.isOpen();
+    }
+
+    bool Writer ::
+      fits(const U32 size) const
+    {
+      if (!this->isOpen()) {
+        return false;
+      }
+      const U32 entries = this->indexCount +
+        (((this->recordCount % this->indexInterval) == 0) ? 1 : 0);
+      const U32 free = this->file.getSize() - this->dataEnd - this->indexCount * INDEX_ENTRY_SIZE;
+      const U32 needed = (entries - this->indexCount) * INDEX_ENTRY_SIZE + RECORD_HEADER_SIZE;
+      return (needed <= free) && (size <= free - needed);
+    }
+
+    Os::File::Status Writer ::
+      append(
+          const Fw::Time& time,
+          const U8 *const data,
+          const U32 size
+      )
+    {
+      if (!this->isOpen()) {
+        return Os::File::NOT_OPENED;
+      }
+      if (!this->fits(size)) {
+        return Os::File::BAD_SIZE;
+      }
+      U8 *const base = this->file.getData();
+      const U32 seconds = time.getSeconds();
+      const U32 useconds = time.getUSeconds();
+
+      if (this->recordCount == 0) {
+        putU32(&base[OFFSET_TIME_BASE], time.getTimeBase());
+        putU32(&base[OFFSET_TIME_CONTEXT], time.getContext());
+      }
+      if ((this->recordCount % this->indexInterval) == 0) {
+        this->indexCount++;
+        U8 *const entry = &base[this->file.getSize() - this->indexCount * INDEX_ENTRY_SIZE];
+        putU32(&entry[0], this->dataEnd);
+        putU32(&entry[4], seconds);
+        putU32(&entry[8], useconds);
+      }
+
+      U8 *const record = &base[this->dataEnd];
+      putU32(&record[0], size);
+      putU32(&record[4], seconds);
+      putU32(&record[8], useconds);
+      if (size > 0) {
+        memcpy(&record[RECORD_HEADER_SIZE], data, size);
+      }
+      this->dataEnd += RECORD_HEADER_SIZE + size;
+      this->recordCount++;
+      this->updateHeader();
+      return Os::File::OP_OK;
+    }
+
+    Os::File::Status Writer ::
+      flush(void)
+    {
+      if (!this->isOpen()) {
+        return Os::File::NOT_OPENED;
+      }
+      // The header, then the records and index entries since the last flush. The first
+      // flush syncs from the start of the file, header included.
+      Os::File::Status status = Os::File::OP_OK;
+      if (this->syncedEnd > 0) {
+        status = this->file.sync(0, HEADER_SIZE);
+      }
+      if (status == Os::File::OP_OK && this->dataEnd > this->syncedEnd) {
+        status = this->file.sync(this->syncedEnd, this->dataEnd - this->syncedEnd);
+      }
+      if (status == Os::File::OP_OK && this->indexCount > this->syncedIndexCount) {
+        const U32 size = this->file.getSize();
+        status = this->file.sync(
+            size - this->indexCount * INDEX_ENTRY_SIZE,
+            (this->indexCount - this->syncedIndexCount) * INDEX_ENTRY_SIZE
+        );
+      }
+      if (status == Os::File::OP_OK) {
+        this->syncedEnd = this->dataEnd;
+        this->syncedIndexCount = this->indexCount;
+      }
+      return status;
+    }
+
+    Os::File::Status Writer ::
+      close(void)
+    {
+      if (!this->isOpen()) {
+        return Os::File::NOT_OPENED;
+      }
+      U8 *const base = this->file.getData();
+      const U32 indexSize = this->indexCount * INDEX_ENTRY_SIZE;
+
+      // Move the index to just after the records, then put its entries in order
+      U8 *const index = &base[this->dataEnd];
+      memmove(index, &base[this->file.getSize() - indexSize], indexSize);
+      for (U32 low = 0, high = this->indexCount; low + 1 < high; ++low, --high) {
+        U8 entry[INDEX_ENTRY_SIZE];
+        memcpy(entry, &index[low * INDEX_ENTRY_SIZE], INDEX_ENTRY_SIZE);
+        memcpy(&index[low * INDEX_ENTRY_SIZE], &index[(high - 1) * INDEX_ENTRY_SIZE], INDEX_ENTRY_SIZE);
+        memcpy(&index[(high - 1) * INDEX_ENTRY_SIZE], entry, INDEX_ENTRY_SIZE);
+      }
+      putU32(&base[OFFSET_INDEX_OFFSET], this->dataEnd);
+      putU32(&base[OFFSET_FLAGS], FLAG_SEALED);
+      this->updateHeader();
+
+      const U32 finalSize = this->dataEnd + indexSize;
+      Os::File::Status status = this->file.sync(0, finalSize);
+      const Os::File::Status closeStatus = this->file.close(finalSize);
+      if (status == Os::File::OP_OK) {
+        status = closeStatus;
+      }
+      return status;
+    }
+
+    U32 Writer ::
+      getRecordCount(void) const
+    {
+      return this->recordCount;
+    }
+
+    U32 Writer ::
+      getNextSequence(void) const
+    {
+      return this->firstSequence + this->recordCount;
+    }
+
+    U32 Writer ::
+      getBytesAppended(void) const
+    {
+      return this->dataEnd - HEADER_SIZE;
+    }
+
+    U32 Writer ::
+      getSyncCalls(void) const
+    {
+      return this->file.getSyncCalls();
+    }
+
+    void Writer ::
+      updateHeader(void)
+    {
+      U8 *const header = this->file.getData();
+      putU32(&header[OFFSET_RECORD_COUNT], this->recordCount);
+      putU32(&header[OFFSET_DATA_END], this->dataEnd);
+      putU32(&header[OFFSET_INDEX_COUNT], this->indexCount);
+    }
+
+    // ----------------------------------------------------------------------
+    // Reader
+    // ----------------------------------------------------------------------
+
+    Reader ::
+      Reader(void) :
+        flags(0),
+        indexInterval(0),
+        firstSequence(0),
+        recordCount(0),
+        dataEnd(0),
+        indexOffset(0),
+        indexCount(0),
+        timeBase(0),
+        timeContext(0),
+        position(0),
+        positionRecord(0)
+    {
+    }
+
+    Os::File::Status Reader ::
+      open(const char *const fileName)
+    {
+      FW_ASSERT(!this->file.isOpen());
+      const Os::File::Status status =
+        this->file.open(fileName, Os::MappedFile::OPEN_READ);
+      if (status != Os::File::OP_OK) {
+        return status;
+      }
+      const U32 size = this->file.getSize();
+      const U8 *const header = this->file.getData();
+      if (size < HEADER_SIZE ||
+          getU32(&header[OFFSET_MAGIC]) != MAGIC ||
+          getU32(&header[OFFSET_VERSION]) != VERSION) {
+        this->close();
+        return Os::File::BAD_SIZE;
+      }
+      this->flags = getU32(&header[OFFSET_FLAGS]);
+      this->indexInterval = getU32(&header[OFFSET_INDEX_INTERVAL]);
+      this->firstSequence = getU32(&header[OFFSET_FIRST_SEQUENCE]);
+      this->recordCount = getU32(&header[OFFSET_RECORD_COUNT]);
+      this->dataEnd = getU32(&header[OFFSET_DATA_END]);
+      this->indexOffset = getU32(&header[OFFSET_INDEX_OFFSET]);
+      this->indexCount = getU32(&header[OFFSET_INDEX_COUNT]);
+      this->timeBase = getU32(&header[OFFSET_TIME_BASE]);
+      this->timeContext = getU32(&header[OFFSET_TIME_CONTEXT]);
+
+      // The records and the index must lie within the file, and the index must cover the records
+      const U32 indexStart = this->isSealed() ?
+        this->indexOffset : size - this->indexCount * INDEX_ENTRY_SIZE;
+      const bool valid =
+        (this->indexInterval > 0) &&
+        (this->dataEnd >= HEADER_SIZE) &&
+        (this->indexCount <= (size - HEADER_SIZE) / INDEX_ENTRY_SIZE) &&
+        (indexStart >= this->dataEnd) &&
+        (static_cast<U64>(indexStart) + this->indexCount * INDEX_ENTRY_SIZE <= size) &&
+        (this->recordCount <= static_cast<U64>(this->indexCount) * this->indexInterval) &&
+        (this->recordCount <= (this->dataEnd - HEADER_SIZE) / RECORD_HEADER_SIZE);
+      if (!valid) {
+        this->close();
+        return Os::File::BAD_SIZE;
+      }
+      this->position = HEADER_SIZE;
+      this->positionRecord = 0;
+      return Os::File::OP_OK;
+    }
+
+    void Reader ::
+      close(void)
+    {
+      (void) this->file.close();
+      this->recordCount = 0;
+      this->indexCount = 0;
+    }
+
+    bool Reader ::
+      isSealed(void) const
+    {
+      return (this->flags & FLAG_SEALED) != 0;
+    }
+
+    U32 Reader ::
+      getRecordCount(void) const
+    {
+      return this->recordCount;
+    }
+
+    U32 Reader ::
+      getFirstSequence(void) const
+    {
+      return this->firstSequence;
+    }
+
+    bool Reader ::
+      seekSequence(const U32 sequence)
+    {
+      const U32 record = sequence - this->firstSequence;
+      if (sequence < this->firstSequence || record >= this->recordCount) {
+        return false;
+      }
+      // Start from the index entry at or before the record, then skip fewer than an interval
+      const U32 entry = record / this->indexInterval;
+      this->position = getU32(&this->file.getData()[this->entryOffset(entry)]);
+      this->positionRecord = entry * this->indexInterval;
+      while (this->positionRecord < record) {
+        if (!this->skip()) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    bool Reader ::
+      seekTime(const Fw::Time& time)
+    {
+      if (this->recordCount == 0) {
+        return false;
+      }
+      const U8 *const base = this->file.getData();
+      const U32 seconds = time.getSeconds();
+      const U32 useconds = time.getUSeconds();
+
+      // Find the last index entry earlier than the time
+      U32 low = 0;
+      U32 high = this->indexCount;
+      while (low < high) {
+        const U32 middle = low + (high - low) / 2;
+        const U8 *const entry = &base[this->entryOffset(middle)];
+        if (earlier(getU32(&entry[4]), getU32(&entry[8]), seconds, useconds)) {
+          low = middle + 1;
+        }
+        else {
+          high = middle;
+        }
+      }
+      const U32 entry = (low > 0) ? low - 1 : 0;
+      this->position = getU32(&base[this->entryOffset(entry)]);
+      this->positionRecord = entry * this->indexInterval;
+
+      // Then scan to the first record that is not earlier
+      while (this->positionRecord < this->recordCount) {
+        U32 size = 0;
+        U32 recordSeconds = 0;
+        U32 recordUseconds = 0;
+        if (!this->readRecordHeader(this->position, size, recordSeconds, recordUseconds)) {
+          return false;
+        }
+        if (!earlier(recordSeconds, recordUseconds, seconds, useconds)) {
+          return true;
+        }
+        this->position += RECORD_HEADER_SIZE + size;
+        this->positionRecord++;
+      }
+      return false;
+    }
+
+    bool Reader ::
+      next(Record& record)
+    {
+      if (this->positionRecord >= this->recordCount) {
+        return false;
+      }
+      U32 size = 0;
+      U32 seconds = 0;
+      U32 useconds = 0;
+      if (!this->readRecordHeader(this->position, size, seconds, useconds)) {
+        return false;
+      }
+      record.sequence = this->firstSequence + this->positionRecord;
+      record.time.set(
+          static_cast<TimeBase>(this->timeBase),
+          static_cast<FwTimeContextStoreType>(this->timeContext),
+          seconds,
+          useconds
+      );
+      record.data = &this->file.getData()[this->position + RECORD_HEADER_SIZE];
+      record.size = size;
+      this->position += RECORD_HEADER_SIZE + size;
+      this->positionRecord++;
+      return true;
+    }
+
+    U32 Reader ::
+      entryOffset(const U32 entry) const
+    {
+      FW_ASSERT(entry < this->indexCount, entry, this->indexCount);
+      if (this->isSealed()) {
+        return this->indexOffset + entry * INDEX_ENTRY_SIZE;
+      }
+      // An open segment's index grows down from the end of the file
+      return this->file.getSize() - (entry + 1) * INDEX_ENTRY_SIZE;
+    }
+
+    bool Reader ::
+      readRecordHeader(
+          const U32 offset,
+          U32& size,
+          U32& seconds,
+          U32& useconds
+      ) const
+    {
+      if (offset < HEADER_SIZE || offset > this->dataEnd ||
+          this->dataEnd - offset < RECORD_HEADER_SIZE) {
+        return false;
+      }
+      const U8 *const header = &this->file.getData()[offset];
+      size = getU32(&header[0]);
+      seconds = getU32(&header[4]);
+      useconds = getU32(&header[8]);
+      return size <= this->dataEnd - offset - RECORD_HEADER_SIZE;
+    }
+
+    bool Reader ::
+      skip(void)
+    {
+      U32 size = 0;
+      U32 seconds = 0;
+      U32 useconds = 0;
+      if (!this->readRecordHeader(this->position, size, seconds, useconds)) {
+        return false;
+      }
+      this->position += RECORD_HEADER_SIZE + size;
+      this->positionRecord++;
+      return true;
+    }
+
+  }
+
+}
@@ -0,0 +1,255 @@
+// ======================================================================
+// \title  LogSegment.hpp
+// \brief  Memory mapped, indexed log segments for BufferLogger
+//
+// A segment is a file of fixed capacity, mapped into memory and filled
+// with plain memory writes, so logging a buffer makes no system call.
+// All fields are big endian. It holds:
+//
+// - A header of HEADER_SIZE bytes:
+//     magic, version, flags, index interval, first sequence number,
+//     record count, end of the records, index offset, index entry
+//     count, time base and time context of the first record, each a U32,
+//     then zero padding.
+//
+// - The records, one after the other from HEADER_SIZE: size, seconds
+//   and microseconds, each a U32, then size bytes of data. Record n has
+//   sequence number first sequence + n.
+//
+// - A sparse index with one entry for every index interval records:
+//   record offset, seconds and microseconds, each a U32. While the
+//   segment is being written the entries grow down from the end of the
+//   file. Closing the segment moves them, in order, to just after the
+//   records, sets the SEALED flag and cuts the file to the records and
+//   the index.
+//
+// The reader finds a record by sequence number in constant time and by
+// time with a binary search of the index, assuming record times do not
+// go backwards within a segment. It reads sealed segments and segments
+// left open by a reset.
+//
+// \copyright
+// Copyright (C) 2015-2017 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_LogSegment_HPP
+#define Svc_LogSegment_HPP
+
+#include "Fw/Types/BasicTypes.hpp"
+#include "Fw/Time/Time.hpp"
+#include "Os/MappedFile.hpp"
+
+namespace Svc {
+
+  namespace LogSegment {
+
+    enum {
+      MAGIC = 0x464C5347, //!< "FLSG"
+      VERSION = 1, //!< Format version
+      HEADER_SIZE = 64, //!< Bytes before the first record
+      RECORD_HEADER_SIZE = 12, //!< Bytes before the data of each record
+      INDEX_ENTRY_SIZE = 12, //!< Bytes in an index entry
+      FLAG_SEALED = 1 //!< The segment was closed and its index is after the records
+    };
+
+    //! Writes a segment
+    class Writer {
+
+      public:
+
+        Writer(void);
+
+        //! Close the segment if still open
+        ~Writer(void);
+
+        //! Create a segment and map it
+        //! \return The status of creating and mapping the file
+        Os::File::Status open(
+            const char *const fileName, //!< The file name
+            const U32 capacity, //!< The file size while the segment is written
+            const U32 indexInterval, //!< Records per index entry
+            const U32 firstSequence //!< Sequence number of the first record
+        );
+
+        //! Whether a segment is open
+        bool isOpen(void) const;
+
+        //! Whether a record of size bytes fits in the segment
+        bool fits(
+            const U32 size //!< The record data size
+        ) const;
+
+        //! Append a record
+        //! \return BAD_SIZE if the record does not fit
+        Os::File::Status append(
+            const Fw::Time& time, //!< The record time
+            const U8 *const data, //!< The record data
+            const U32 size //!< The record data size
+        );
+
+        //! Write the records appended since the last flush to disk
+        Os::File::Status flush(void);
+
+        //! Seal the segment, cut the file to its contents and close it
+        Os::File::Status close(void);
+
+        //! The number of records in the segment
+        U32 getRecordCount(void) const;
+
+        //! The sequence number of the next record
+        U32 getNextSequence(void) const;
+
+        //! The bytes of records appended since open
+        U32 getBytesAppended(void) const;
+
+        //! Sync calls made to the operating system since construction
+        U32 getSyncCalls(void) const;
+
+      private:
+
+        //! Write the record count, end of the records and index entry count to the header
+        void updateHeader(void);
+
+        //! The mapped file
+        Os::MappedFile file;
+
+        //! The index interval
+        U32 indexInterval;
+
+        //! The sequence number of the first record
+        U32 firstSequence;
+
+        //! The number of records
+        U32 recordCount;
+
+        //! The end of the records
+        U32 dataEnd;
+
+        //! The number of index entries
+        U32 indexCount;
+
+        //! The end of the records at the last flush
+        U32 syncedEnd;
+
+        //! The number of index entries at the last flush
+        U32 syncedIndexCount;
+
+    };
+
+    //! A record read from a segment
+    struct Record {
+      U32 sequence; //!< The sequence number
+      Fw::Time time; //!< The time
+      const U8* data; //!< The data, in the mapping of the segment
+      U32 size; //!< The data size
+    };
+
+    //! Reads a segment
+    class Reader {
+
+      public:
+
+        Reader(void);
+
+        //! Map a segment and check its header
+        //! \return The status of mapping the file, or BAD_SIZE if it is not a valid segment
+        Os::File::Status open(
+            const char *const fileName //!< The file name
+        );
+
+        //! Unmap the segment
+        void close(void);
+
+        //! Whether the segment was sealed by its writer
+        bool isSealed(void) const;
+
+        //! The number of records in the segment
+        U32 getRecordCount(void) const;
+
+        //! The sequence number of the first record
+        U32 getFirstSequence(void) const;
+
+        //! Position the reader at a record, in constant time
+        //! \return false if no record has that sequence number
+        bool seekSequence(
+            const U32 sequence //!< The sequence number
+        );
+
+        //! Position the reader at the first record at or after a time
+        //! \return false if no record is that late
+        bool seekTime(
+            const Fw::Time& time //!< The time
+        );
+
+        //! Read the record at the reader position and move to the next one
+        //! \return false at the end of the segment, or if the record is damaged
+        bool next(
+            Record& record //!< The record
+        );
+
+      private:
+
+        //! The offset of an index entry
+        U32 entryOffset(
+            const U32 entry //!< The entry number
+        ) const;
+
+        //! Read the header of the record at offset
+        //! \return false if the record does not lie within the records
+        bool readRecordHeader(
+            const U32 offset, //!< The record offset
+            U32& size, //!< The data size
+            U32& seconds, //!< The seconds of the record time
+            U32& useconds //!< The microseconds of the record time
+        ) const;
+
+        //! Move to the record after the one at the reader position
+        //! \return false if the record is damaged
+        bool skip(void);
+
+        //! The mapped file
+        Os::MappedFile file;
+
+        //! The segment flags
+        U32 flags;
+
+        //! The index interval
+        U32 indexInterval;
+
+        //! The sequence number of the first record
+        U32 firstSequence;
+
+        //! The number of records
+        U32 recordCount;
+
+        //! The end of the records
+        U32 dataEnd;
+
+        //! The offset of the index, if sealed
+        U32 indexOffset;
+
+        //! The number of index entries
+        U32 indexCount;
+
+        //! The time base of the records
+        U32 timeBase;
+
+        //! The time context of the records
+        U32 timeContext;
+
+        //! The offset of the record at the reader position
+        U32 position;
+
+        //! The number of the record at the reader position
+        U32 positionRecord;
+
+    };
+
+  }
+
+}
+
+#endif
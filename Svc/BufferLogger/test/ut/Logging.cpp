@@ -12,6 +12,7 @@
 
 #include "Logging.hpp"
 #include "Os/FileSystem.hpp"
+#include "Svc/BufferLogger/LogSegment.hpp"
 
 namespace Svc {
 
@@ -273,6 +274,132 @@ namespace Svc {
       }
     }
 
+    class BufferedWritesTester :
+      public Logging::Tester
+    {
+
+      private:
+
+        //! Check the size of the open file
+        void checkFileSize(const U64 expectedSize) {
+          U64 actualSize = 0;
+          const Os::FileSystem::Status status = Os::FileSystem::getFileSize(
+              this->component.m_file.name.toChar(),
+              actualSize
+          );
+          ASSERT_EQ(Os::FileSystem::OP_OK, status);
+          ASSERT_EQ(expectedSize, actualSize);
+        }
+
+      public:
+
+        void test(void) {
+          const U32 entrySize = COM_BUFFER_LENGTH + sizeof(SIZE_TYPE);
+          const U32 firstEntries = MAX_ENTRIES_PER_FILE - 2;
+          // A block larger than the file
+          ASSERT_TRUE(this->component.setBufferedWrites(
+              2 * MAX_BYTES_PER_FILE,
+              Os::BufferedFile::SYNC_ON_FLUSH
+          ));
+          this->component.m_file.baseName = Fw::EightyCharString("BufferedWritesTester");
+          this->sendComBuffers(firstEntries);
+          ASSERT_EQ(BufferLogger::File::Mode::OPEN, component.m_file.mode);
+          // Nothing has reached the file yet
+          this->checkFileSize(0);
+          // The timer writes the block out, in a single call
+          this->invoke_to_schedIn(0, 0);
+          this->dispatchOne();
+          this->checkFileSize(firstEntries * entrySize);
+          ASSERT_TLM_SIZE(2);
+          ASSERT_TLM_BufferLogger_FileWrites_SIZE(1);
+          ASSERT_TLM_BufferLogger_FileWrites(0, 1);
+          ASSERT_TLM_BufferLogger_BytesPerWrite_SIZE(1);
+          ASSERT_TLM_BufferLogger_BytesPerWrite(0, static_cast<F32>(firstEntries * entrySize));
+          // The rest is written when the file is closed
+          this->sendComBuffers(MAX_ENTRIES_PER_FILE - firstEntries);
+          this->sendCmd_BL_CloseFile(0, 0);
+          this->dispatchOne();
+          ASSERT_EVENTS_SIZE(1);
+          ASSERT_EVENTS_BL_LogFileClosed_SIZE(1);
+          ASSERT_EQ(2U, this->component.m_file.osFile.getWriteCalls());
+          this->checkLogFileIntegrity(
+              this->component.m_file.name.toChar(),
+              MAX_BYTES_PER_FILE,
+              MAX_ENTRIES_PER_FILE
+          );
+          this->checkFileValidation(this->component.m_file.name.toChar());
+        }
+
+    };
+
+    void Tester ::
+      BufferedWrites(void)
+    {
+      BufferedWritesTester tester;
+      tester.test();
+    }
+
+    class SegmentsTester :
+      public Logging::Tester
+    {
+
+      public:
+
+        void test(void) {
+          const U32 numBuffers = 7;
+          // Room for the segment header
+          this->component.initLog("buf/log", ".seg", 1024, sizeof(SIZE_TYPE));
+          this->component.setSegmentFormat(2);
+          this->component.m_file.baseName = Fw::EightyCharString("SegmentsTester");
+          // One buffer per time step
+          for (U32 i = 0; i < numBuffers; ++i) {
+            this->setTestTimeSeconds(i);
+            this->sendComBuffers(1);
+          }
+          this->sendCmd_BL_CloseFile(0, 0);
+          this->dispatchOne();
+          ASSERT_EVENTS_SIZE(1);
+          ASSERT_EVENTS_BL_LogFileClosed_SIZE(1);
+          const Fw::EightyCharString& fileName = this->component.m_file.name;
+          this->checkFileValidation(fileName.toChar());
+
+          // Read the records back
+          LogSegment::Reader reader;
+          ASSERT_EQ(Os::File::OP_OK, reader.open(fileName.toChar()));
+          ASSERT_TRUE(reader.isSealed());
+          ASSERT_EQ(numBuffers, reader.getRecordCount());
+          ASSERT_EQ(0U, reader.getFirstSequence());
+          LogSegment::Record record;
+          for (U32 i = 0; i < numBuffers; ++i) {
+            ASSERT_TRUE(reader.next(record));
+            ASSERT_EQ(i, record.sequence);
+            ASSERT_EQ(this->generateTestTime(i), record.time);
+            ASSERT_EQ(sizeof(data), record.size);
+            ASSERT_EQ(0, memcmp(record.data, data, sizeof(data)));
+          }
+          ASSERT_FALSE(reader.next(record));
+
+          // Seek by sequence number and by time
+          ASSERT_TRUE(reader.seekSequence(5));
+          ASSERT_TRUE(reader.next(record));
+          ASSERT_EQ(5U, record.sequence);
+          ASSERT_FALSE(reader.seekSequence(numBuffers));
+          ASSERT_TRUE(reader.seekTime(this->generateTestTime(3)));
+          ASSERT_TRUE(reader.next(record));
+          ASSERT_EQ(3U, record.sequence);
+          ASSERT_FALSE(reader.seekTime(this->generateTestTime(numBuffers)));
+          reader.close();
+        }
+
+    };
+
+    void Tester ::
+      Segments(void)
+    {
+      SegmentsTester tester;
+      tester.test();
+    }
+
   }
 
 }
@@ -41,6 +41,12 @@ namespace Svc {
         //! Test logging on/off capability
         void OnOff(void);
 
+        //! Test coalesced writes, flushed by schedIn and on close
+        void BufferedWrites(void);
+
+        //! Test the LogSegment format and reading it back
+        void Segments(void);
+
     };
 
   }
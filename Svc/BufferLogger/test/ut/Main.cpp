@@ -55,6 +55,16 @@ TEST(TestLogging, OnOff) {
   tester.OnOff();
 }
 
+TEST(TestLogging, BufferedWrites) {
+  Svc::Logging::Tester tester;
+  tester.BufferedWrites();
+}
+
+TEST(TestLogging, Segments) {
+  Svc::Logging::Tester tester;
+  tester.Segments();
+}
+
 // ----------------------------------------------------------------------
 // Test Health
 // ----------------------------------------------------------------------
@@ -240,6 +240,126 @@ namespace Svc {
     return Free::SUCCESS;
   }
 
+  // ----------------------------------------------------------------------
+  // A buffer pool
+  // ----------------------------------------------------------------------
+
+  BufferManager::Pool ::
+    Pool(void) :
+      bufferSize(0),
+      numBuffers(0),
+      firstId(0),
+      memory(NULL),
+      next(NULL),
+      inUse(NULL),
+      head(END_OF_LIST)
+  {
+
+  }
+
+  BufferManager::Pool ::
+    ~Pool(void)
+  {
+    delete[] this->next;
+    delete[] this->inUse;
+  }
+
+  U32 BufferManager::Pool ::
+    getStride(const U32 bufferSize)
+  {
+    // Keep every buffer aligned for any scalar type
+    return (bufferSize + sizeof(U64) - 1) & ~static_cast<U32>(sizeof(U64) - 1);
+  }
+
+  void BufferManager::Pool ::
+    setup(
+        const U32 bufferSize,
+        const U32 numBuffers,
+        const U32 firstId,
+        U8 *const memory
+    )
+  {
+    FW_ASSERT(this->next == NULL);
+    FW_ASSERT(numBuffers > 0);
+    this->bufferSize = bufferSize;
+    this->numBuffers = numBuffers;
+    this->firstId = firstId;
+    this->memory = memory;
+    this->next = new U32[numBuffers];
+    this->inUse = new U32[numBuffers];
+    FW_ASSERT(this->next != NULL);
+    FW_ASSERT(this->inUse != NULL);
+    for (U32 index = 0; index < numBuffers; ++index) {
+      this->next[index] = index + 1;
+      this->inUse[index] = 0;
+    }
+    this->next[numBuffers - 1] = END_OF_LIST;
+    this->head = 0;
+  }
+
+  U32 BufferManager::Pool ::
+    getBufferSize(void) const
+  {
+    return this->bufferSize;
+  }
+
+  bool BufferManager::Pool ::
+    owns(const U32 id) const
+  {
+    return id >= this->firstId && id - this->firstId < this->numBuffers;
+  }
+
+  bool BufferManager::Pool ::
+    allocate(
+        U32& id,
+        U8* &address
+    )
+  {
+    U64 oldHead;
+    U64 newHead;
+    U32 index;
+    do {
+      oldHead = this->head;
+      index = static_cast<U32>(oldHead);
+      if (index == END_OF_LIST) {
+        return false;
+      }
+      // next[index] may be stale if another thread takes the buffer
+      // first. The change count then makes the swap fail.
+      newHead = ((oldHead >> 32) + 1) << 32 | this->next[index];
+    } while (!__sync_bool_compare_and_swap(&this->head, oldHead, newHead));
+
+    FW_ASSERT(this->inUse[index] == 0, index);
+    this->inUse[index] = 1;
+    id = this->firstId + index;
+    address = &this->memory[index * Pool::getStride(this->bufferSize)];
+    return true;
+  }
+
+  void BufferManager::Pool ::
+    free(
+        const U32 id,
+        U8 *const address
+    )
+  {
+    FW_ASSERT(this->owns(id), id);
+    const U32 index = id - this->firstId;
+    FW_ASSERT(
+        address == &this->memory[index * Pool::getStride(this->bufferSize)],
+        id
+    );
+    // Catch a buffer that is freed twice
+    const bool wasInUse = __sync_bool_compare_and_swap(&this->inUse[index], 1, 0);
+    FW_ASSERT(wasInUse, id);
+    U64 oldHead;
+    U64 newHead;
+    do {
+      oldHead = this->head;
+      this->next[index] = static_cast<U32>(oldHead);
+      newHead = ((oldHead >> 32) + 1) << 32 | index;
+    } while (!__sync_bool_compare_and_swap(&this->head, oldHead, newHead));
+  }
+
   // ----------------------------------------------------------------------
   // Construction, initialization, and destruction 
   // ----------------------------------------------------------------------
@@ -253,11 +373,72 @@ namespace Svc {
       BufferManagerComponentBase(compName),
       warnings(*this),
       store(storeSize),
-      allocationQueue(maxNumBuffers)
+      allocationQueue(maxNumBuffers),
+      pools(NULL),
+      numPools(0),
+      poolMemory(NULL),
+      numAllocated(0),
+      allocatedSize(0),
+      hiBuffs(0),
+      noBuffs(0)
   {
 
   }
 
+  BufferManager ::
+    BufferManager(
+        const char *const compName,
+        const Bin *const bins,
+        const U32 numBins
+    ) :
+      BufferManagerComponentBase(compName),
+      warnings(*this),
+      store(0),
+      allocationQueue(0),
+      pools(NULL),
+      numPools(numBins),
+      poolMemory(NULL),
+      numAllocated(0),
+      allocatedSize(0),
+      hiBuffs(0),
+      noBuffs(0)
+  {
+    FW_ASSERT(bins != NULL);
+    FW_ASSERT(numBins > 0);
+
+    // Lay the bins out end to end in one block of memory
+    U64 memorySize = 0;
+    U32 numBuffers = 0;
+    for (U32 bin = 0; bin < numBins; ++bin) {
+      FW_ASSERT(bins[bin].numBuffers > 0, bin);
+      if (bin > 0) {
+        FW_ASSERT(bins[bin].bufferSize > bins[bin - 1].bufferSize, bin);
+      }
+      memorySize += static_cast<U64>(Pool::getStride(bins[bin].bufferSize)) * bins[bin].numBuffers;
+      numBuffers += bins[bin].numBuffers;
+      // Buffer IDs must fit in the buffer context
+      FW_ASSERT(numBuffers <= 0x10000, numBuffers);
+    }
+    FW_ASSERT(memorySize <= 0xFFFFFFFF);
+    this->poolMemory = new U8[memorySize];
+    this->pools = new Pool[numBins];
+    FW_ASSERT(this->poolMemory != NULL);
+    FW_ASSERT(this->pools != NULL);
+
+    U32 offset = 0;
+    U32 firstId = 0;
+    for (U32 bin = 0; bin < numBins; ++bin) {
+      this->pools[bin].setup(
+          bins[bin].bufferSize,
+          bins[bin].numBuffers,
+          firstId,
+          &this->poolMemory[offset]
+      );
+      offset += Pool::getStride(bins[bin].bufferSize) * bins[bin].numBuffers;
+      firstId += bins[bin].numBuffers;
+    }
+  }
+
   void BufferManager ::
     init(const NATIVE_INT_TYPE instance) 
   {
@@ -267,7 +448,8 @@ namespace Svc {
   BufferManager ::
     ~BufferManager(void)
   {
-
+    delete[] this->pools;
+    delete[] this->poolMemory;
   }
 
   U32 BufferManager :: getBufferContext(const U32 managerId, const U32 bufferId) {
@@ -300,6 +482,110 @@ namespace Svc {
         NATIVE_INT_TYPE portNum,
         U32 size 
     )
+  {
+    if (this->pools != NULL) {
+      return this->allocateFromPools(size);
+    }
+    this->storeLock.lock();
+    Fw::Buffer buffer = this->allocateFromStore(size);
+    this->storeLock.unLock();
+    return buffer;
+  }
+
+  void BufferManager ::
+    bufferSendIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &buffer
+    )
+  {
+    const U32 instance = static_cast<U32>(this->getInstance());
+    FW_ASSERT(BufferManager::getManagerIdFromBufferContext(buffer.getContext()) == instance);
+
+    if (this->pools != NULL) {
+      this->freeToPool(buffer);
+      return;
+    }
+    this->storeLock.lock();
+    this->freeToStore(buffer);
+    this->storeLock.unLock();
+  }
+
+  void BufferManager ::
+    schedIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    this->tlmWrite_BufferManager_NumAllocatedBuffers(this->numAllocated);
+    this->tlmWrite_BufferManager_AllocatedSize(this->allocatedSize);
+    this->tlmWrite_BufferManager_HiBuffs(this->hiBuffs);
+    this->tlmWrite_BufferManager_NoBuffs(this->noBuffs);
+  }
+
+  // ----------------------------------------------------------------------
+  // Helper methods
+  // ----------------------------------------------------------------------
+
+  void BufferManager ::
+    recordAllocation(const U32 size)
+  {
+    const U32 count = __sync_add_and_fetch(&this->numAllocated, 1);
+    (void) __sync_fetch_and_add(&this->allocatedSize, size);
+    U32 hi = this->hiBuffs;
+    while (count > hi && !__sync_bool_compare_and_swap(&this->hiBuffs, hi, count)) {
+      hi = this->hiBuffs;
+    }
+  }
+
+  void BufferManager ::
+    recordFree(const U32 size)
+  {
+    (void) __sync_fetch_and_sub(&this->numAllocated, 1);
+    (void) __sync_fetch_and_sub(&this->allocatedSize, size);
+  }
+
+  Fw::Buffer BufferManager ::
+    allocateFromPools(const U32 size)
+  {
+    Fw::Buffer buffer;
+    buffer.setContext(BufferManager::getBufferContext(this->getInstance(), 0));
+
+    // Try the smallest bin that fits, then larger bins if it is empty
+    for (U32 pool = 0; pool < this->numPools; ++pool) {
+      if (this->pools[pool].getBufferSize() < size) {
+        continue;
+      }
+      U32 id;
+      U8 *address;
+      if (this->pools[pool].allocate(id, address)) {
+        buffer.setContext(BufferManager::getBufferContext(this->getInstance(), id));
+        buffer.setData(address);
+        buffer.setSize(size);
+        this->recordAllocation(this->pools[pool].getBufferSize());
+        return buffer;
+      }
+    }
+
+    (void) __sync_fetch_and_add(&this->noBuffs, 1);
+    return buffer;
+  }
+
+  void BufferManager ::
+    freeToPool(Fw::Buffer &buffer)
+  {
+    const U32 id = BufferManager::getBufferIdFromBufferContext(buffer.getContext());
+    for (U32 pool = 0; pool < this->numPools; ++pool) {
+      if (this->pools[pool].owns(id)) {
+        this->pools[pool].free(id, buffer.getData());
+        this->recordFree(this->pools[pool].getBufferSize());
+        return;
+      }
+    }
+    FW_ASSERT(0, id);
+  }
+
+  Fw::Buffer BufferManager ::
+    allocateFromStore(const U32 size)
   {
     U8 *address;
     U32 id;
@@ -329,6 +615,10 @@ namespace Svc {
         buffer.setContext(BufferManager::getBufferContext(this->getInstance(), id));
         buffer.setData(address);
         buffer.setSize(size);
+        this->recordAllocation(size);
+    }
+    else {
+        (void) __sync_fetch_and_add(&this->noBuffs, 1);
     }
 
     this->warnings.update(warningStatus);
@@ -336,15 +626,8 @@ namespace Svc {
   }
 
   void BufferManager ::
-    bufferSendIn_handler(
-        const NATIVE_INT_TYPE portNum,
-        Fw::Buffer &buffer
-    )
+    freeToStore(Fw::Buffer &buffer)
   {
-
-    const U32 instance = static_cast<U32>(this->getInstance());
-    FW_ASSERT(BufferManager::getManagerIdFromBufferContext(buffer.getContext()) == instance);
-
     const U32 expectedId = BufferManager::getBufferIdFromBufferContext(buffer.getContext());
     U8 *const address = buffer.getData();
     U32 sawId = 0;
@@ -363,6 +646,7 @@ namespace Svc {
       this->store.free(size, address);
     }
 
+    this->recordFree(size);
   }
 
 }
@@ -14,6 +14,7 @@
 #define BufferManager_HPP
 
 #include "Svc/BufferManager/BufferManagerComponentAc.hpp"
+#include "Os/Mutex.hpp"
 
 namespace Svc {
 
@@ -282,6 +283,120 @@ namespace Svc {
 
       };
 
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // A buffer pool
+      // ----------------------------------------------------------------------
+
+      //! A pool of equal-size buffers with a lock-free free list.
+      //! Buffers may be allocated and freed from any thread and in any order.
+      class Pool {
+
+        public:
+
+          // ----------------------------------------------------------------------
+          // Construction and destruction 
+          // ----------------------------------------------------------------------
+
+          // Construct an empty Pool
+          Pool(void);
+
+          // Destroy a Pool
+          ~Pool(void);
+
+        public:
+
+          // ----------------------------------------------------------------------
+          // Methods 
+          // ----------------------------------------------------------------------
+
+          // Set up the pool on memory owned by the caller
+          void setup(
+              const U32 bufferSize, //!< The size of each buffer
+              const U32 numBuffers, //!< The number of buffers
+              const U32 firstId, //!< The buffer ID of the first buffer
+              U8 *const memory //!< numBuffers * getStride(bufferSize) bytes
+          );
+
+          // Get the size of each buffer
+          U32 getBufferSize(void) const;
+
+          // Check whether the pool owns a buffer ID
+          bool owns(
+              const U32 id //!< The buffer ID
+          ) const;
+
+          // Pop a buffer off the free list
+          // Returns false if the pool is empty
+          bool allocate(
+              U32& id, //!< The buffer ID
+              U8* &address //!< The buffer address
+          );
+
+          // Push a buffer back onto the free list
+          void free(
+              const U32 id, //!< The buffer ID
+              U8 *const address //!< The buffer address
+          );
+
+          // Get the distance in bytes between buffers of a given size
+          static U32 getStride(const U32 bufferSize);
+
+        PRIVATE:
+
+          // ----------------------------------------------------------------------
+          // Constants
+          // ----------------------------------------------------------------------
+
+          //! Index marking the end of the free list
+          static const U32 END_OF_LIST = 0xFFFFFFFF;
+
+          // ----------------------------------------------------------------------
+          // Variables
+          // ----------------------------------------------------------------------
+
+          //! The size of each buffer
+          U32 bufferSize;
+
+          //! The number of buffers
+          U32 numBuffers;
+
+          //! The buffer ID of the first buffer
+          U32 firstId;
+
+          //! The buffer memory. Not owned by the pool.
+          U8* memory;
+
+          //! For each buffer on the free list, the index of the next one
+          U32* next;
+
+          //! For each buffer, whether it is allocated. Catches double frees.
+          volatile U32* inUse;
+
+          //! Top of the free list: a change count in the high word and a
+          //! buffer index in the low word. The count defeats ABA.
+          volatile U64 head;
+
+        PRIVATE:
+
+          Pool(const Pool&); //!< Disabled copy constructor
+          Pool& operator=(const Pool&); //!< Disabled assignment
+
+      };
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Types
+      // ----------------------------------------------------------------------
+
+      //! A size class for the pool mode
+      struct Bin {
+        U32 bufferSize; //!< The size of each buffer in the bin
+        U32 numBuffers; //!< The number of buffers in the bin
+      };
+
     public:
 
       // ----------------------------------------------------------------------
@@ -289,6 +404,8 @@ namespace Svc {
       // ----------------------------------------------------------------------
 
       //! Construct object BufferManager
+      //! Buffers are allocated from a store and must be freed in the
+      //! order they were allocated
       //!
       BufferManager(
           const char *const compName, //!< The component name
@@ -296,6 +413,18 @@ namespace Svc {
           const U32 maxNumBuffers
       );
 
+      //! Construct object BufferManager in pool mode
+      //! Each bin is a preallocated pool of equal-size buffers. A request
+      //! is served by the smallest bin with a free buffer that is large
+      //! enough. Buffers may be freed in any order, and requests are
+      //! served without taking a lock.
+      //!
+      BufferManager(
+          const char *const compName, //!< The component name
+          const Bin *const bins, //!< The bins, in increasing order of buffer size
+          const U32 numBins //!< The number of bins
+      );
+
       //! Initialize object BufferManager
       //!
       void init(
@@ -338,6 +467,37 @@ namespace Svc {
           Fw::Buffer &buffer
       );
 
+      //! Handler implementation for schedIn
+      //!
+      void schedIn_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          NATIVE_UINT_TYPE context //!< The call order
+      );
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Helper methods
+      // ----------------------------------------------------------------------
+
+      //! Allocate a buffer from the store
+      Fw::Buffer allocateFromStore(const U32 size);
+
+      //! Free a buffer to the store
+      void freeToStore(Fw::Buffer &buffer);
+
+      //! Allocate a buffer from the pools
+      Fw::Buffer allocateFromPools(const U32 size);
+
+      //! Free a buffer to its pool
+      void freeToPool(Fw::Buffer &buffer);
+
+      //! Record a successful allocation in the statistics
+      void recordAllocation(const U32 size);
+
+      //! Record a free in the statistics
+      void recordFree(const U32 size);
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -353,6 +513,31 @@ namespace Svc {
       //! The allocation queue
       AllocationQueue allocationQueue;
 
+      //! Guards the store and the allocation queue
+      Os::Mutex storeLock;
+
+      //! The pools, in increasing order of buffer size. NULL if the
+      //! store is used instead.
+      Pool* pools;
+
+      //! The number of pools
+      U32 numPools;
+
+      //! The memory holding the pool buffers
+      U8* poolMemory;
+
+      //! The number of buffers currently allocated
+      volatile U32 numAllocated;
+
+      //! The total size of all allocated buffers
+      volatile U32 allocatedSize;
+
+      //! The largest number of buffers allocated at once
+      volatile U32 hiBuffs;
+
+      //! The number of requests that could not be served
+      volatile U32 noBuffs;
+
     };
 
 }
@@ -9,6 +9,25 @@ TEST(Test, ThreeBufferProblem) {
   tester.three_buffer_problem();
 }
 
+TEST(Test, PoolOutOfOrder) {
+  const Svc::BufferManager::Bin bins[] = { { 16, 4 } };
+  Svc::Tester tester(bins, FW_NUM_ARRAY_ELEMENTS(bins));
+  tester.pool_out_of_order();
+}
+
+TEST(Test, PoolSizeClasses) {
+  const Svc::BufferManager::Bin bins[] = { { 16, 4 }, { 64, 2 } };
+  Svc::Tester tester(bins, FW_NUM_ARRAY_ELEMENTS(bins));
+  tester.pool_size_classes();
+}
+
+TEST(Test, PoolConcurrent) {
+  // Two buffers for each of the four threads, so none is ever refused
+  const Svc::BufferManager::Bin bins[] = { { 8, 8 } };
+  Svc::Tester tester(bins, FW_NUM_ARRAY_ELEMENTS(bins));
+  tester.pool_concurrent();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
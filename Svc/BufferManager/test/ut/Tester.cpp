@@ -11,9 +11,13 @@
 // ====================================================================== 
 
 #include "Tester.hpp"
+#include <pthread.h>
+#include <string.h>
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 10
+#define NUM_THREADS 4
+#define ITERATIONS 100000
 
 namespace Svc {
 
@@ -35,6 +39,23 @@ namespace Svc {
     this->connectPorts();
   }
 
+  Tester ::
+    Tester(
+        const BufferManager::Bin *const bins,
+        const U32 numBins
+    ) : 
+#if FW_OBJECT_NAMES == 1
+      BufferManagerGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("BufferManager", bins, numBins)
+#else
+      BufferManagerGTestBase(MAX_HISTORY_SIZE),
+      component(bins, numBins)
+#endif
+  {
+    this->initComponents();
+    this->connectPorts();
+  }
+
   Tester ::
     ~Tester(void) 
   {
@@ -63,6 +84,111 @@ namespace Svc {
       ASSERT_EQ(0xDEADBEEF,*((U32*)buffer2.getData()));
   }
 
+  void Tester ::
+    pool_out_of_order(void)
+  {
+    Fw::Buffer buffers[4];
+    for (U32 i = 0; i < 4; ++i) {
+      buffers[i] = this->invoke_to_bufferGetCallee(0, 16);
+      ASSERT_TRUE(buffers[i].getData() != NULL);
+      ASSERT_EQ(16U, buffers[i].getSize());
+      memset(buffers[i].getData(), i, 16);
+    }
+    // The bin is empty
+    Fw::Buffer empty = this->invoke_to_bufferGetCallee(0, 16);
+    ASSERT_TRUE(empty.getData() == NULL);
+
+    // Free from the middle, then reuse the buffer
+    this->invoke_to_bufferSendIn(0, buffers[1]);
+    this->invoke_to_bufferSendIn(0, buffers[3]);
+    Fw::Buffer again = this->invoke_to_bufferGetCallee(0, 16);
+    ASSERT_TRUE(again.getData() == buffers[3].getData());
+    memset(again.getData(), 0xFF, 16);
+    for (U32 i = 0; i < 16; ++i) {
+      ASSERT_EQ(0, buffers[0].getData()[i]);
+      ASSERT_EQ(2, buffers[2].getData()[i]);
+    }
+    this->invoke_to_bufferSendIn(0, buffers[0]);
+    this->invoke_to_bufferSendIn(0, buffers[2]);
+    this->invoke_to_bufferSendIn(0, again);
+
+    this->invoke_to_schedIn(0, 0);
+    ASSERT_TLM_BufferManager_NumAllocatedBuffers(0, 0);
+    ASSERT_TLM_BufferManager_AllocatedSize(0, 0);
+    ASSERT_TLM_BufferManager_HiBuffs(0, 4);
+    ASSERT_TLM_BufferManager_NoBuffs(0, 1);
+  }
+
+  void Tester ::
+    pool_size_classes(void)
+  {
+    // Bins are 16 x 4 and 64 x 2
+    Fw::Buffer small[4];
+    for (U32 i = 0; i < 4; ++i) {
+      small[i] = this->invoke_to_bufferGetCallee(0, 10);
+      ASSERT_TRUE(small[i].getData() != NULL);
+    }
+    // The small bin is empty, so a small request takes a large buffer
+    Fw::Buffer spill = this->invoke_to_bufferGetCallee(0, 10);
+    ASSERT_TRUE(spill.getData() != NULL);
+    Fw::Buffer large = this->invoke_to_bufferGetCallee(0, 64);
+    ASSERT_TRUE(large.getData() != NULL);
+    // Nothing left, and nothing is large enough
+    Fw::Buffer none = this->invoke_to_bufferGetCallee(0, 10);
+    ASSERT_TRUE(none.getData() == NULL);
+    Fw::Buffer tooBig = this->invoke_to_bufferGetCallee(0, 65);
+    ASSERT_TRUE(tooBig.getData() == NULL);
+
+    this->invoke_to_schedIn(0, 0);
+    ASSERT_TLM_BufferManager_NumAllocatedBuffers(0, 6);
+    ASSERT_TLM_BufferManager_AllocatedSize(0, 4 * 16 + 2 * 64);
+    ASSERT_TLM_BufferManager_HiBuffs(0, 6);
+    ASSERT_TLM_BufferManager_NoBuffs(0, 2);
+
+    for (U32 i = 0; i < 4; ++i) {
+      this->invoke_to_bufferSendIn(0, small[i]);
+    }
+    this->invoke_to_bufferSendIn(0, large);
+    this->invoke_to_bufferSendIn(0, spill);
+  }
+
+  void* Tester ::
+    poolTask(void* arg)
+  {
+    Tester* tester = static_cast<Tester*>(arg);
+    Fw::Buffer held[2];
+    for (U32 i = 0; i < ITERATIONS; ++i) {
+      // Hold two buffers and return them in reverse order
+      for (U32 j = 0; j < 2; ++j) {
+        held[j] = tester->invoke_to_bufferGetCallee(0, 8);
+        EXPECT_TRUE(held[j].getData() != NULL);
+        memcpy(held[j].getData(), &i, sizeof(i));
+      }
+      for (U32 j = 2; j > 0; --j) {
+        U32 value;
+        memcpy(&value, held[j - 1].getData(), sizeof(value));
+        EXPECT_EQ(i, value);
+        tester->invoke_to_bufferSendIn(0, held[j - 1]);
+      }
+    }
+    return NULL;
+  }
+
+  void Tester ::
+    pool_concurrent(void)
+  {
+    pthread_t threads[NUM_THREADS];
+    for (U32 i = 0; i < NUM_THREADS; ++i) {
+      ASSERT_EQ(0, pthread_create(&threads[i], NULL, Tester::poolTask, this));
+    }
+    for (U32 i = 0; i < NUM_THREADS; ++i) {
+      ASSERT_EQ(0, pthread_join(threads[i], NULL));
+    }
+    this->invoke_to_schedIn(0, 0);
+    ASSERT_TLM_BufferManager_NumAllocatedBuffers(0, 0);
+    ASSERT_TLM_BufferManager_NoBuffs(0, 0);
+  }
+
   // ----------------------------------------------------------------------
   // Helper methods 
   // ----------------------------------------------------------------------
@@ -83,6 +209,12 @@ namespace Svc {
         this->component.get_bufferGetCallee_InputPort(0)
     );
 
+    // schedIn
+    this->connect_to_schedIn(
+        0,
+        this->component.get_schedIn_InputPort(0)
+    );
+
     // timeCaller
     this->component.set_timeCaller_OutputPort(
         0, 
@@ -32,6 +32,13 @@ namespace Svc {
       //!
       Tester(void);
 
+      //! Construct object Tester with a component in pool mode
+      //!
+      Tester(
+          const BufferManager::Bin *const bins, //!< The bins
+          const U32 numBins //!< The number of bins
+      );
+
       //! Destroy object Tester
       //!
       ~Tester(void);
@@ -43,6 +50,16 @@ namespace Svc {
       // ---------------------------------------------------------------------- 
 
       void three_buffer_problem(void);
+
+      //! Free pool buffers out of allocation order
+      void pool_out_of_order(void);
+
+      //! Fall back to larger bins, then fail and report NoBuffs
+      void pool_size_classes(void);
+
+      //! Allocate and free from several threads at once
+      void pool_concurrent(void);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -57,6 +74,10 @@ namespace Svc {
       //!
       void initComponents(void);
 
+      //! Thread body for pool_concurrent
+      //!
+      static void* poolTask(void* arg);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -8,17 +8,24 @@
 #include <Svc/CmdDispatcher/CommandDispatcherImpl.hpp>
 #include <Fw/Cmd/CmdPacket.hpp>
 #include <Fw/Types/Assert.hpp>
+#include <Fw/Types/IdTable.hpp>
 #include <stdio.h>
 
 namespace Svc {
     CommandDispatcherImpl::CommandDispatcherImpl(const char* name) :
         CommandDispatcherComponentBase(name),
+        m_numEntries(0),
+        m_freeTracker(-1),
         m_seq(0),
         m_numCmdsDispatched(0),
         m_numCmdErrors(0)
     {
         memset(this->m_entryTable,0,sizeof(this->m_entryTable));
         memset(this->m_sequenceTracker,0,sizeof(this->m_sequenceTracker));
+        for (NATIVE_INT_TYPE slot = 0; slot < CMD_DISPATCHER_OPCODE_HASH_SLOTS; slot++) {
+            this->m_opcodeSlots[slot] = -1;
+        }
+        this->clearTracking();
     }
 
     CommandDispatcherImpl::~CommandDispatcherImpl() {
@@ -31,21 +38,41 @@ namespace Svc {
         CommandDispatcherComponentBase::init(queueDepth);
     }
 
-    void CommandDispatcherImpl::compCmdReg_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode) {
-        // search for an empty slot
-        bool slotFound = false;
-        for (U32 slot = 0; slot < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable); slot++) {
-            if ((not this->m_entryTable[slot].used) and (not slotFound)) {
-                this->m_entryTable[slot].opcode = opCode;
-                this->m_entryTable[slot].port = portNum;
-                this->m_entryTable[slot].used = true;
-                this->log_DIAGNOSTIC_OpCodeRegistered(opCode,portNum,slot);
-                slotFound = true;
-            } else if (this->m_entryTable[slot].used) { // make sure no duplicates
-                FW_ASSERT(this->m_entryTable[slot].opcode != opCode, opCode);
+    void CommandDispatcherImpl::clearTracking(void) {
+        // put all tracking entries on the free list in table order
+        for (NATIVE_INT_TYPE entry = 0; entry < CMD_DISPATCHER_SEQUENCER_TABLE_SIZE; entry++) {
+            this->m_sequenceTracker[entry].used = false;
+            this->m_sequenceTracker[entry].next = entry + 1;
+            this->m_seqSlots[entry] = -1;
+        }
+        this->m_sequenceTracker[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE - 1].next = -1;
+        this->m_freeTracker = 0;
+    }
+
+    NATIVE_INT_TYPE CommandDispatcherImpl::findEntry(FwOpcodeType opCode) {
+        NATIVE_INT_TYPE entry = this->m_opcodeSlots[Fw::IdTableUtils::hash(opCode,0) % CMD_DISPATCHER_OPCODE_HASH_SLOTS];
+        while (entry != -1) {
+            if (this->m_entryTable[entry].opcode == opCode) {
+                break;
             }
+            entry = this->m_entryTable[entry].next;
         }
-        FW_ASSERT(slotFound,opCode);
+        return entry;
+    }
+
+    void CommandDispatcherImpl::compCmdReg_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode) {
+        // make sure no duplicates
+        FW_ASSERT(this->findEntry(opCode) == -1, opCode);
+        // entries are never removed, so the next empty slot is the one after the last used
+        FW_ASSERT(this->m_numEntries < CMD_DISPATCHER_DISPATCH_TABLE_SIZE,opCode);
+        NATIVE_INT_TYPE slot = this->m_numEntries++;
+        NATIVE_UINT_TYPE hashSlot = Fw::IdTableUtils::hash(opCode,0) % CMD_DISPATCHER_OPCODE_HASH_SLOTS;
+        this->m_entryTable[slot].opcode = opCode;
+        this->m_entryTable[slot].port = portNum;
+        this->m_entryTable[slot].used = true;
+        this->m_entryTable[slot].next = this->m_opcodeSlots[hashSlot];
+        this->m_opcodeSlots[hashSlot] = slot;
+        this->log_DIAGNOSTIC_OpCodeRegistered(opCode,portNum,slot);
     }
 
     void CommandDispatcherImpl::compCmdStat_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode, U32 cmdSeq, Fw::CommandResponse response) {
@@ -84,18 +111,23 @@ namespace Svc {
         // look for command source
         NATIVE_INT_TYPE portToCall = -1;
         U32 context;
-        for (U32 pending = 0; pending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); pending++) {
-            if (
-                    (this->m_sequenceTracker[pending].seq == cmdSeq) &&
-                    (this->m_sequenceTracker[pending].used)
-                ) {
+        NATIVE_INT_TYPE* link = &this->m_seqSlots[cmdSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE];
+        while (*link != -1) {
+            NATIVE_INT_TYPE pending = *link;
+            if (this->m_sequenceTracker[pending].seq == cmdSeq) {
+                FW_ASSERT(this->m_sequenceTracker[pending].used);
                 portToCall = this->m_sequenceTracker[pending].callerPort;
                 context = this->m_sequenceTracker[pending].context;
                 FW_ASSERT(opCode == this->m_sequenceTracker[pending].opCode);
                 FW_ASSERT(portToCall < this->getNum_seqCmdStatus_OutputPorts());
+                // unlink from sequence slot and return to free list
+                *link = this->m_sequenceTracker[pending].next;
                 this->m_sequenceTracker[pending].used = false;
+                this->m_sequenceTracker[pending].next = this->m_freeTracker;
+                this->m_freeTracker = pending;
                 break;
             }
+            link = &this->m_sequenceTracker[pending].next;
         }
 
         if (portToCall != -1) {
@@ -140,35 +172,29 @@ namespace Svc {
             return;
         }
 
-        // search for opcode in dispatch table
-        U32 entry;
-        bool entryFound = false;
+        // look up opcode in dispatch table
+        NATIVE_INT_TYPE entry = this->findEntry(cmdPkt.getOpCode());
 
-        for (entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable); entry++) {
-            if ((this->m_entryTable[entry].used) and (cmdPkt.getOpCode() == this->m_entryTable[entry].opcode)) {
-                entryFound = true;
-                break;
-            }
-        }
-        if (entryFound and this->isConnected_compCmdSend_OutputPort(this->m_entryTable[entry].port)) {
+        if ((entry != -1) and this->isConnected_compCmdSend_OutputPort(this->m_entryTable[entry].port)) {
             // register command in command tracker only if response port is connect
             if (this->isConnected_seqCmdStatus_OutputPort(portNum)) {
-                bool pendingFound = false;
-
-                for (U32 pending = 0; pending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); pending++) {
-                    if (not this->m_sequenceTracker[pending].used) {
-                        pendingFound = true;
-                        this->m_sequenceTracker[pending].used = true;
-                        this->m_sequenceTracker[pending].opCode = cmdPkt.getOpCode();
-                        this->m_sequenceTracker[pending].seq = this->m_seq;
-                        this->m_sequenceTracker[pending].context = context;
-                        this->m_sequenceTracker[pending].callerPort = portNum;
-                        break;
-                    }
+                NATIVE_INT_TYPE pending = this->m_freeTracker;
+
+                if (pending != -1) {
+                    U32 seq = static_cast<U32>(this->m_seq);
+                    NATIVE_INT_TYPE* link = &this->m_seqSlots[seq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE];
+                    this->m_freeTracker = this->m_sequenceTracker[pending].next;
+                    this->m_sequenceTracker[pending].used = true;
+                    this->m_sequenceTracker[pending].opCode = cmdPkt.getOpCode();
+                    this->m_sequenceTracker[pending].seq = seq;
+                    this->m_sequenceTracker[pending].context = context;
+                    this->m_sequenceTracker[pending].callerPort = portNum;
+                    this->m_sequenceTracker[pending].next = *link;
+                    *link = pending;
                 }
 
                 // if we couldn't find a slot to track the command, quit
-                if (not pendingFound) {
+                if (pending == -1) {
                     this->log_WARNING_HI_TooManyCommands(cmdPkt.getOpCode());
                     if (this->isConnected_seqCmdStatus_OutputPort(portNum)) {
                         this->seqCmdStatus_out(portNum,cmdPkt.getOpCode(),context,Fw::COMMAND_EXECUTION_ERROR);
@@ -220,9 +246,7 @@ namespace Svc {
 
     void CommandDispatcherImpl::CMD_CLEAR_TRACKING_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
         // clear tracking table
-        for (NATIVE_INT_TYPE entry = 0; entry < CMD_DISPATCHER_SEQUENCER_TABLE_SIZE; entry++) {
-            this->m_sequenceTracker[entry].used = false;
-        }
+        this->clearTracking();
         this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
     }
 
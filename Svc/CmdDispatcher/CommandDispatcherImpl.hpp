@@ -137,15 +137,24 @@ namespace Svc {
             //! As each command opcode is registered, a new entry is found
             //! in the table by checking for the "used" flag. The opcode
             //! member is set to the opcode, and the port member set to the
-            //! port to dispatch to. When a new opcode is received for
-            //! execution, the table is traversed until the opcode is located.
+            //! port to dispatch to. Each entry is also linked into a hash slot
+            //! chosen from its opcode, so when a new opcode is received for
+            //! execution only the entries in that slot are checked.
 
             struct DispatchEntry {
                     bool used; //!< if entry has been used yet
                     U32 opcode; //!< opcode of entry
                     NATIVE_INT_TYPE port; //!< which port the entry invokes
+                    NATIVE_INT_TYPE next; //!< next entry in the same hash slot, or -1
             } m_entryTable[CMD_DISPATCHER_DISPATCH_TABLE_SIZE]; //!< table of dispatch entries
 
+            NATIVE_INT_TYPE m_opcodeSlots[CMD_DISPATCHER_OPCODE_HASH_SLOTS]; //!< first entry in each opcode hash slot, or -1
+            NATIVE_INT_TYPE m_numEntries; //!< number of dispatch entries used
+
+            //! Find the dispatch entry for an opcode
+            //! \return the index of the entry, or -1 if the opcode is not registered
+            NATIVE_INT_TYPE findEntry(FwOpcodeType opCode);
+
             //! \struct SequenceTracker
             //! \brief table used to store opcode that are being executed
             //!
@@ -157,7 +166,9 @@ namespace Svc {
             //! assigned sequence number for the command. The "opCode" field is
             //! used for the opcode, and the "callerPort" field is used to store
             //! the port number of the caller so the status can be reported back to
-            //! correct port.
+            //! correct port. Unused entries are kept on a free list, and used entries
+            //! are linked into a slot indexed by the sequence number modulo the table
+            //! size, so neither a dispatch nor a status search the whole table.
 
             struct SequenceTracker {
                     bool used; //!< if this slot is used
@@ -165,8 +176,15 @@ namespace Svc {
                     FwOpcodeType opCode; //!< opcode being tracked
                     U32 context; //!< context passed by user
                     NATIVE_INT_TYPE callerPort; //!< port command source port
+                    NATIVE_INT_TYPE next; //!< next entry in the free list or sequence slot, or -1
             } m_sequenceTracker[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE]; //!< sequence tracking port for command completions;
 
+            NATIVE_INT_TYPE m_seqSlots[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE]; //!< first tracked command in each sequence slot, or -1
+            NATIVE_INT_TYPE m_freeTracker; //!< first unused tracking entry, or -1 if all are used
+
+            //! Mark all tracking entries unused
+            void clearTracking(void);
+
             I32 m_seq; //!< current command sequence number
 
             U32 m_numCmdsDispatched; //!< number of commands dispatched
@@ -848,6 +848,63 @@ namespace Svc {
 
     }
 
+    void CommandDispatcherImplTester::runDispatchThroughput(U32 bursts) {
+
+        // fill the dispatch table with opcodes spread over several components
+        this->m_impl.regCommands();
+        FwOpcodeType opCodes[CMD_DISPATCHER_DISPATCH_TABLE_SIZE];
+        NATIVE_UINT_TYPE numOpCodes = 0;
+        for (NATIVE_INT_TYPE entry = this->m_impl.m_numEntries; entry < CMD_DISPATCHER_DISPATCH_TABLE_SIZE; entry++) {
+            opCodes[numOpCodes] = 0x1000*(numOpCodes%10 + 1) + numOpCodes;
+            this->invoke_to_compCmdReg(0,opCodes[numOpCodes]);
+            numOpCodes++;
+        }
+        ASSERT_EQ(static_cast<NATIVE_INT_TYPE>(CMD_DISPATCHER_DISPATCH_TABLE_SIZE),this->m_impl.m_numEntries);
+
+        Os::IntervalTimer timer;
+        Fw::ComBuffer buff;
+        U32 seqs[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE];
+        U32 numCmds = 0;
+
+        timer.start();
+        for (U32 burst = 0; burst < bursts; burst++) {
+            // dispatch enough commands to fill the tracking table
+            for (NATIVE_UINT_TYPE cmd = 0; cmd < CMD_DISPATCHER_SEQUENCER_TABLE_SIZE; cmd++) {
+                FwOpcodeType opCode = opCodes[(numCmds + cmd*7) % numOpCodes];
+                buff.resetSer();
+                ASSERT_EQ(buff.serialize(FwPacketDescriptorType(Fw::ComPacket::FW_PACKET_COMMAND)),Fw::FW_SERIALIZE_OK);
+                ASSERT_EQ(buff.serialize(opCode),Fw::FW_SERIALIZE_OK);
+                this->m_cmdSendRcvd = false;
+                this->invoke_to_seqCmdBuff(0,buff,cmd);
+                ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
+                ASSERT_TRUE(this->m_cmdSendRcvd);
+                ASSERT_EQ(opCode,this->m_cmdSendOpCode);
+                seqs[cmd] = this->m_cmdSendCmdSeq;
+            }
+            // complete them in reverse order
+            for (NATIVE_INT_TYPE cmd = CMD_DISPATCHER_SEQUENCER_TABLE_SIZE - 1; cmd >= 0; cmd--) {
+                FwOpcodeType opCode = opCodes[(numCmds + cmd*7) % numOpCodes];
+                this->m_seqStatusRcvd = false;
+                this->invoke_to_compCmdStat(0,opCode,seqs[cmd],Fw::COMMAND_OK);
+                ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
+                ASSERT_TRUE(this->m_seqStatusRcvd);
+                ASSERT_EQ(static_cast<U32>(cmd),this->m_seqStatusCmdSeq);
+            }
+            numCmds += CMD_DISPATCHER_SEQUENCER_TABLE_SIZE;
+            this->clearHistory();
+        }
+        timer.stop();
+
+        printf("Dispatched %u commands in %u us (%u commands/sec)\n",
+                numCmds,timer.getDiffUsec(),
+                static_cast<U32>((static_cast<F64>(numCmds)*1000000.0)/(timer.getDiffUsec() + 1)));
+
+        // everything completed
+        for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_impl.m_sequenceTracker); entry++) {
+            ASSERT_TRUE(this->m_impl.m_sequenceTracker[entry].used == false);
+        }
+    }
+
     void CommandDispatcherImplTester::from_pingOut_handler(
               const NATIVE_INT_TYPE portNum, /*!< The port number*/
               U32 key /*!< Value to return to pinger*/
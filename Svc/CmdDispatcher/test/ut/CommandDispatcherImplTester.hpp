@@ -27,6 +27,7 @@ namespace Svc {
             void runOverflowCommands(void);
             void runNopCommands(void);
             void runClearCommandTracking();
+            void runDispatchThroughput(U32 bursts);
 
         private:
             Svc::CommandDispatcherImpl& m_impl;
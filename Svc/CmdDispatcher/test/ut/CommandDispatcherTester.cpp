@@ -183,6 +183,26 @@ TEST(CmdDispTestOffNominal,ClearSequenceTracker) {
 
 }
 
+TEST(CmdDispTestPerformance,DispatchThroughput) {
+
+    TEST_CASE(102.3.1,"Dispatch Throughput");
+    COMMENT("Measure the rate of dispatched and completed commands with a full dispatch table.");
+
+    Svc::CommandDispatcherImpl impl("CmdDispImpl");
+
+    impl.init(10,0);
+
+    Svc::CommandDispatcherImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runDispatchThroughput(1000);
+
+}
+
 #ifndef TGT_OS_TYPE_VXWORKS
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
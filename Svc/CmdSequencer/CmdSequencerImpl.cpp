@@ -254,8 +254,7 @@ namespace Svc {
                 this->commandComplete(opcode);
                 if (not this->m_sequence->hasMoreRecords()) {
                     // No data left
-                    this->m_runMode = STOPPED;
-                    this->sequenceComplete();
+                    this->sequenceEnd();
                 } else {
                     this->performCmd_Step();
                 }
@@ -263,8 +262,7 @@ namespace Svc {
                 // Manual step mode
                 this->commandComplete(opcode);
                 if (not this->m_sequence->hasMoreRecords()) {
-                    this->m_runMode = STOPPED;
-                    this->sequenceComplete();
+                    this->sequenceEnd();
                 }
             }
         }
@@ -392,8 +390,7 @@ namespace Svc {
         Fw::Time currentTime = this->getTime();
         switch (this->m_record.m_descriptor) {
           case Sequence::Record::END_OF_SEQUENCE:
-                this->m_runMode = STOPPED;
-                this->sequenceComplete();
+                this->sequenceEnd();
                 break;
           case Sequence::Record::RELATIVE:
                 this->performCmd_Step_RELATIVE(currentTime);
@@ -419,6 +416,17 @@ namespace Svc {
         }
     }
 
+    void CmdSequencerComponentImpl::sequenceEnd(void) {
+        if (this->m_sequence->hasFailed()) {
+            // The format reported the error when it read the file
+            this->m_sequence->clear();
+            this->performCmd_Cancel();
+        } else {
+            this->m_runMode = STOPPED;
+            this->sequenceComplete();
+        }
+    }
+
     void CmdSequencerComponentImpl::commandComplete(const U32 opcode) {
         this->log_ACTIVITY_LO_CS_CommandComplete(
             this->m_sequence->getLogFileName(),
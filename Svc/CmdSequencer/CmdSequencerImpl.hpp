@@ -290,6 +290,13 @@ namespace Svc {
           //! After calling this, hasMoreRecords should return false
           virtual void clear(void) = 0;
 
+          //! Query whether the sequence ran out of records because
+          //! of an error in its file. Formats that read the file while
+          //! the sequence runs report such errors here; by default
+          //! there are none.
+          //! \return Yes or no
+          virtual bool hasFailed(void) const;
+
         PROTECTED:
 
           //! The enclosing component
@@ -400,15 +407,6 @@ namespace Svc {
           //! \return Success or failure
           bool readOpenFile(void);
 
-          //! Read a binary sequence header from the sequence file
-          //! into the buffer
-          //! \return Success or failure
-          bool readHeader(void);
-
-          //! Deserialize the binary sequence header from the buffer
-          //! \return Success or failure
-          bool deserializeHeader(void);
-
           //! Read records and CRC into buffer
           //! \return Success or failure
           bool readRecordsAndCRC(void);
@@ -456,7 +454,18 @@ namespace Svc {
           //! \return Success or failure
           bool validateRecords(void);
 
-        PRIVATE:
+        PROTECTED:
+
+          //! Read a binary sequence header from the sequence file
+          //! into the buffer
+          //! \return Success or failure
+          bool readHeader(void);
+
+          //! Deserialize the binary sequence header from the buffer
+          //! \return Success or failure
+          bool deserializeHeader(void);
+
+        PROTECTED:
 
           //! The CRC values
           CRC m_crc;
@@ -711,6 +720,10 @@ namespace Svc {
       //! Record a sequence complete event
       void sequenceComplete(void);
 
+      //! Stop a sequence that has no more records: complete it,
+      //! or cancel it if its file failed
+      void sequenceEnd(void);
+
       //! Record an error
       void error(void);
 
@@ -222,10 +222,6 @@ namespace Svc {
       );
       return false;
     }
-    if (header.m_fileSize > buffer.getBuffCapacity()) {
-      this->m_events.fileSizeError(header.m_fileSize);
-      return false;
-    }
     // Number of records
     serializeStatus = buffer.deserialize(header.m_numRecords);
     if (serializeStatus != Fw::FW_SERIALIZE_OK) {
@@ -265,6 +261,11 @@ namespace Svc {
     const NATIVE_UINT_TYPE size = this->m_header.m_fileSize;
     Fw::SerializeBufferBase& buffer = this->m_buffer;
 
+    if (size > buffer.getBuffCapacity()) {
+      this->m_events.fileSizeError(size);
+      return false;
+    }
+
     NATIVE_INT_TYPE readLen = size;
     Os::File::Status fileStatus = file.read(
       buffer.getBuffAddr(),
@@ -106,6 +106,12 @@ namespace Svc {
         this->m_buffer.clear();
     }
 
+    bool CmdSequencerComponentImpl::Sequence ::
+      hasFailed(void) const
+    {
+        return false;
+    }
+
     const CmdSequencerComponentImpl::Sequence::Header& 
       CmdSequencerComponentImpl::Sequence ::
         getHeader(void) const
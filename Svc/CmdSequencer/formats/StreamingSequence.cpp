@@ -0,0 +1,324 @@
+// ======================================================================
+// \title  StreamingSequence.cpp
+// \brief  StreamingSequence implementation
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <string.h>
+
+#include "Fw/Types/Assert.hpp"
+#include "Svc/CmdSequencer/formats/StreamingSequence.hpp"
+
+namespace Svc {
+
+  StreamingSequence ::
+    StreamingSequence(CmdSequencerComponentImpl& component) :
+      FPrimeSequence(component),
+      m_headerCRC(0),
+      m_dataLeft(0),
+      m_recordNumber(0),
+      m_hasRecord(false),
+      m_failed(false)
+  {
+
+  }
+
+  bool StreamingSequence ::
+    loadFile(const Fw::CmdStringArg& fileName)
+  {
+
+    // make sure there is a buffer allocated
+    FW_ASSERT(this->m_buffer.getBuffAddr());
+
+    // close any sequence loaded before
+    this->clear();
+
+    this->setFileName(fileName);
+
+    Os::File::Status status = this->m_sequenceFile.open(
+      this->m_fileName.toChar(),
+      Os::File::OPEN_READ
+    );
+    if (status == Os::File::DOESNT_EXIST) {
+      this->m_events.fileNotFound();
+      return false;
+    }
+    if (status != Os::File::OP_OK) {
+      this->m_events.fileReadError();
+      return false;
+    }
+
+    bool result = this->readHeader();
+    if (result) {
+      this->m_crc.init();
+      this->m_crc.update(
+          this->m_buffer.getBuffAddr(),
+          Sequence::Header::SERIALIZED_SIZE
+      );
+      this->m_headerCRC = this->m_crc.m_computed;
+      result = this->deserializeHeader()
+        and this->m_header.validateTime(this->m_component)
+        and this->rewind()
+        and this->readAhead();
+    }
+
+    if (not result) {
+      this->clear();
+    }
+    return result;
+
+  }
+
+  bool StreamingSequence ::
+    hasMoreRecords(void) const
+  {
+    return this->m_hasRecord;
+  }
+
+  void StreamingSequence ::
+    nextRecord(Record& record)
+  {
+    FW_ASSERT(this->m_hasRecord);
+    record = this->m_record;
+    if (not this->readAhead()) {
+      this->m_failed = true;
+    }
+  }
+
+  void StreamingSequence ::
+    reset(void)
+  {
+    this->m_failed = false;
+    if (this->m_sequenceFile.isOpen()) {
+      this->m_failed = not (this->rewind() and this->readAhead());
+    }
+  }
+
+  void StreamingSequence ::
+    clear(void)
+  {
+    this->m_sequenceFile.close();
+    this->m_buffer.resetSer();
+    this->m_dataLeft = 0;
+    this->m_recordNumber = 0;
+    this->m_hasRecord = false;
+    this->m_failed = false;
+  }
+
+  bool StreamingSequence ::
+    hasFailed(void) const
+  {
+    return this->m_failed;
+  }
+
+  bool StreamingSequence ::
+    rewind(void)
+  {
+    const U32 fileSize = this->m_header.m_fileSize;
+    if (fileSize < sizeof(this->m_crc.m_stored)) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_CRC,
+          fileSize
+      );
+      return false;
+    }
+    Os::File& file = this->m_sequenceFile;
+    const Os::File::Status fileStatus =
+      file.seek(Sequence::Header::SERIALIZED_SIZE);
+    if (fileStatus != Os::File::OP_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA,
+          file.getLastError()
+      );
+      return false;
+    }
+    this->m_crc.m_computed = this->m_headerCRC;
+    this->m_dataLeft = fileSize - sizeof(this->m_crc.m_stored);
+    this->m_recordNumber = 0;
+    this->m_buffer.resetSer();
+    return true;
+  }
+
+  bool StreamingSequence ::
+    readAhead(void)
+  {
+    const U32 numRecords = this->m_header.m_numRecords;
+    this->m_hasRecord = false;
+    if (this->m_recordNumber == numRecords) {
+      // The CRC was checked with the last record, unless there are none
+      return (numRecords > 0) or this->checkCRC();
+    }
+    if (not this->deserializeNext(this->m_record)) {
+      return false;
+    }
+    ++this->m_recordNumber;
+    // Check the file before handing out its last record
+    if (this->m_recordNumber == numRecords and not this->checkCRC()) {
+      return false;
+    }
+    this->m_hasRecord = true;
+    return true;
+  }
+
+  bool StreamingSequence ::
+    fill(const U32 size)
+  {
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+    const NATIVE_UINT_TYPE left = buffer.getBuffLeft();
+    const NATIVE_UINT_TYPE space = buffer.getBuffCapacity() - left;
+    if (left >= size or this->m_dataLeft == 0 or space == 0) {
+      return true;
+    }
+
+    // Move the bytes not yet deserialized to the front of the window,
+    // then read as much of the file as fits after them
+    U8 *const buffAddr = buffer.getBuffAddr();
+    memmove(buffAddr, buffer.getBuffAddrLeft(), left);
+    const NATIVE_INT_TYPE readSize = FW_MIN(space, this->m_dataLeft);
+    NATIVE_INT_TYPE readLen = readSize;
+    Os::File& file = this->m_sequenceFile;
+    const Os::File::Status fileStatus = file.read(&buffAddr[left], readLen);
+    if (fileStatus != Os::File::OP_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA,
+          file.getLastError()
+      );
+      return false;
+    }
+    if (readLen != readSize) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA_SIZE,
+          readLen
+      );
+      return false;
+    }
+    this->m_crc.update(&buffAddr[left], readLen);
+    this->m_dataLeft -= readLen;
+    const Fw::SerializeStatus serializeStatus =
+      buffer.setBuffLen(left + readLen);
+    FW_ASSERT(serializeStatus == Fw::FW_SERIALIZE_OK, serializeStatus);
+    return true;
+  }
+
+  bool StreamingSequence ::
+    deserializeNext(Record& record)
+  {
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+
+    // Descriptor
+    if (not this->fill(sizeof(U8))) {
+      return false;
+    }
+    U8 descEntry = 0;
+    Fw::SerializeStatus status = buffer.deserialize(descEntry);
+    if (status == Fw::FW_SERIALIZE_OK and descEntry > Record::END_OF_SEQUENCE) {
+      status = Fw::FW_DESERIALIZE_FORMAT_ERROR;
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+      record.m_descriptor = static_cast<Record::Descriptor>(descEntry);
+      if (record.m_descriptor == Record::END_OF_SEQUENCE) {
+        return true;
+      }
+    }
+
+    // Time tag and record size
+    U32 seconds = 0;
+    U32 useconds = 0;
+    U32 recordSize = 0;
+    if (status == Fw::FW_SERIALIZE_OK) {
+      if (not this->fill(3 * sizeof(U32))) {
+        return false;
+      }
+      status = buffer.deserialize(seconds);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+      status = buffer.deserialize(useconds);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+      status = buffer.deserialize(recordSize);
+    }
+    if (
+      status == Fw::FW_SERIALIZE_OK and
+      recordSize + sizeof(FwPacketDescriptorType) > Fw::ComBuffer::SERIALIZED_SIZE
+    ) {
+      // Record size is too big for com buffer
+      status = Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+    }
+
+    // Command
+    if (status == Fw::FW_SERIALIZE_OK) {
+      if (not this->fill(recordSize)) {
+        return false;
+      }
+      if (recordSize > buffer.getBuffLeft()) {
+        // Not enough data left, or the record is bigger than the buffer
+        status = Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+      }
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+      record.m_timeTag.set(seconds, useconds);
+      Fw::ComBuffer& comBuffer = record.m_command;
+      comBuffer.resetSer();
+      status = comBuffer.setBuffLen(recordSize);
+      FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+      NATIVE_UINT_TYPE size = recordSize;
+      status = buffer.deserialize(comBuffer.getBuffAddr(), size, true);
+    }
+
+    if (status != Fw::FW_SERIALIZE_OK) {
+      this->m_events.recordInvalid(this->m_recordNumber, status);
+      return false;
+    }
+    return true;
+  }
+
+  bool StreamingSequence ::
+    checkCRC(void)
+  {
+    // Check there is no data left
+    const U32 extraBytes = this->m_buffer.getBuffLeft() + this->m_dataLeft;
+    if (extraBytes > 0) {
+      this->m_events.recordMismatch(this->m_header.m_numRecords, extraBytes);
+      return false;
+    }
+
+    // Read the CRC, which follows the records
+    U32& crc = this->m_crc.m_stored;
+    U8 crcBytes[sizeof(crc)];
+    NATIVE_INT_TYPE readLen = sizeof(crcBytes);
+    Os::File& file = this->m_sequenceFile;
+    const Os::File::Status fileStatus = file.read(crcBytes, readLen);
+    if (fileStatus != Os::File::OP_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA,
+          file.getLastError()
+      );
+      return false;
+    }
+    if (readLen != sizeof(crcBytes)) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_CRC,
+          readLen
+      );
+      return false;
+    }
+    Fw::ExternalSerializeBuffer crcBuff(crcBytes, sizeof(crcBytes));
+    Fw::SerializeStatus status = crcBuff.setBuffLen(sizeof(crcBytes));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    status = crcBuff.deserialize(crc);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+
+    this->m_crc.finalize();
+    if (crc != this->m_crc.m_computed) {
+      this->m_events.fileCRCFailure(crc, this->m_crc.m_computed);
+      return false;
+    }
+    return true;
+  }
+
+}
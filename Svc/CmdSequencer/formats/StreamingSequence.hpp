@@ -0,0 +1,128 @@
+// ======================================================================
+// \title  StreamingSequence.hpp
+// \brief  StreamingSequence interface
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_StreamingSequence_HPP
+#define Svc_StreamingSequence_HPP
+
+#include "Svc/CmdSequencer/CmdSequencerImpl.hpp"
+
+namespace Svc {
+
+  //! \class StreamingSequence
+  //! \brief A sequence in F Prime format, read from its file as it runs
+  //!
+  //! FPrimeSequence reads the whole file into the sequence buffer and
+  //! checks it before the first command goes out, so the buffer bounds
+  //! the size of a sequence and loading takes time in proportion to it.
+  //! StreamingSequence uses the buffer as a window onto the file
+  //! instead. Loading reads the header and the first record; taking a
+  //! record reads the next one ahead, refilling the window from the
+  //! file when it runs dry. The CRC is computed as the file goes through
+  //! the window and checked when the last record is read, before that
+  //! record is handed out.
+  //!
+  //! A sequence may be any size, and the buffer need only hold the
+  //! largest command. The price is that an error in the file shows up
+  //! when the sequence reaches it, after the records before it have
+  //! run; the sequencer then stops the sequence as it does on a failed
+  //! command. Validating a sequence checks its header and first record.
+  class StreamingSequence :
+    public CmdSequencerComponentImpl::FPrimeSequence
+  {
+
+    public:
+
+      //! Construct a StreamingSequence
+      StreamingSequence(
+          CmdSequencerComponentImpl& component //!< The enclosing component
+      );
+
+    public:
+
+      //! Open a sequence file and read its first record
+      //! \return Success or failure
+      bool loadFile(
+          const Fw::CmdStringArg& fileName //!< The file name
+      );
+
+      //! Query whether the sequence has any more records
+      //! \return Yes or no
+      bool hasMoreRecords(void) const;
+
+      //! Get the next record in the sequence and read the one after it.
+      //! Asserts if there is none
+      void nextRecord(
+          Record& record //!< The returned record
+      );
+
+      //! Reset the sequence to the beginning of the file
+      void reset(void);
+
+      //! Clear the sequence records and close the file
+      void clear(void);
+
+      //! Query whether reading the file failed
+      //! \return Yes or no
+      bool hasFailed(void) const;
+
+    PRIVATE:
+
+      //! Go back to the first record
+      //! \return Success or failure
+      bool rewind(void);
+
+      //! Read the next record ahead
+      //! \return Success or failure
+      bool readAhead(void);
+
+      //! Read the file into the window until size bytes are
+      //! waiting or the records run out
+      //! \return Success or failure
+      bool fill(
+          const U32 size //!< The number of bytes needed
+      );
+
+      //! Deserialize a record from the window, filling it as needed
+      //! \return Success or failure
+      bool deserializeNext(
+          Record& record //!< The record
+      );
+
+      //! Check that the records end where the CRC starts, then read
+      //! and check the CRC
+      //! \return Success or failure
+      bool checkCRC(void);
+
+    PRIVATE:
+
+      //! The computed CRC after the header
+      U32 m_headerCRC;
+
+      //! The bytes of records not yet read from the file
+      U32 m_dataLeft;
+
+      //! The number of records read
+      U32 m_recordNumber;
+
+      //! The record read ahead
+      Record m_record;
+
+      //! Whether m_record holds the next record
+      bool m_hasRecord;
+
+      //! Whether reading the file failed
+      bool m_failed;
+
+  };
+
+}
+
+#endif
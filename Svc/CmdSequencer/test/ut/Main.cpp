@@ -12,6 +12,7 @@
 #include "Svc/CmdSequencer/test/ut/InvalidFiles.hpp"
 #include "Svc/CmdSequencer/test/ut/NoFiles.hpp"
 #include "Svc/CmdSequencer/test/ut/Relative.hpp"
+#include "Svc/CmdSequencer/test/ut/Streaming.hpp"
 #include "Svc/CmdSequencer/test/ut/SequenceFiles/SequenceFiles.hpp"
 #include "Svc/CmdSequencer/test/ut/Tester.hpp"
 #include "Svc/CmdSequencer/test/ut/Mixed.hpp"
@@ -376,6 +377,17 @@ TEST(Relative, ValidateAMPCS) {
   Svc::Relative::Tester tester(Svc::SequenceFiles::File::Format::AMPCS);
   tester.Validate();
 }
+
+TEST(Streaming, AutoByCommand) {
+  Svc::Streaming::Tester tester;
+  tester.AutoByCommand();
+}
+
+TEST(Streaming, DataAfterRecords) {
+  Svc::Streaming::Tester tester;
+  tester.DataAfterRecords();
+}
+
 #endif
 
 int main(int argc, char **argv) {
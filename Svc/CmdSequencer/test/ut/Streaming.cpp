@@ -0,0 +1,103 @@
+// ====================================================================== 
+// \title  Streaming.cpp
+// \brief  Tests of StreamingSequence
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include "Svc/CmdSequencer/test/ut/CommandBuffers.hpp"
+#include "Svc/CmdSequencer/test/ut/Streaming.hpp"
+
+namespace Svc {
+
+  namespace Streaming {
+
+    // ----------------------------------------------------------------------
+    // Constructors 
+    // ----------------------------------------------------------------------
+
+    Tester ::
+      Tester(void) :
+        ImmediateBase::Tester(SequenceFiles::File::Format::F_PRIME)
+    {
+      // Replace the default sequence and its buffer
+      this->component.deallocateBuffer(this->mallocator);
+      this->component.setSequenceFormat(this->sequences.streamingSequence);
+      this->component.allocateBuffer(
+          ALLOCATOR_ID,
+          this->mallocator,
+          WINDOW_SIZE
+      );
+    }
+
+    // ----------------------------------------------------------------------
+    // Tests 
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      AutoByCommand(void)
+    {
+      const U32 numRecords = 16;
+      SequenceFiles::ImmediateFile file(numRecords, this->format);
+      this->parameterizedAutoByCommand(file, numRecords, numRecords);
+    }
+
+    void Tester ::
+      DataAfterRecords(void)
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the file
+      const U32 numRecords = 5;
+      SequenceFiles::DataAfterRecordsFile file(numRecords, this->format);
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Run the sequence
+      this->sendCmd_CS_RUN(0, 0, fileName);
+      this->clearAndDispatch();
+      // Assert command response
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_RUN,
+          0,
+          Fw::COMMAND_OK
+      );
+      // The commands before the end of sequence record run
+      const U32 numCommands = numRecords - 1;
+      for (U32 i = 0; i < numCommands; ++i) {
+        // Check command buffer
+        Fw::ComBuffer comBuff;
+        CommandBuffers::create(comBuff, i, i + 1);
+        ASSERT_from_comCmdOut_SIZE(1);
+        ASSERT_from_comCmdOut(0, comBuff, 0U);
+        // Send status back
+        this->invoke_to_cmdResponseIn(0, i, 0, Fw::COMMAND_OK);
+        this->clearAndDispatch();
+        if (i == numCommands - 2) {
+          // Stepping to the last command reads the end of the file
+          ASSERT_EVENTS_SIZE(2);
+          ASSERT_EVENTS_CS_CommandComplete(0, fileName, i, i);
+          ASSERT_EVENTS_CS_RecordMismatch(0, fileName, numRecords, 8);
+        }
+        else {
+          ASSERT_EVENTS_SIZE(1);
+          ASSERT_EVENTS_CS_CommandComplete(0, fileName, i, i);
+        }
+      }
+      // The sequence stops with an error
+      ASSERT_from_comCmdOut_SIZE(0);
+      ASSERT_EVENTS_CS_SequenceComplete_SIZE(0);
+      ASSERT_from_seqDone_SIZE(1);
+      ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_EXECUTION_ERROR);
+      ASSERT_FALSE(this->component.m_sequence->hasMoreRecords());
+    }
+
+  }
+
+}
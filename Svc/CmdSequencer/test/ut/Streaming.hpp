@@ -0,0 +1,56 @@
+// ====================================================================== 
+// \title  Streaming.hpp
+// \brief  Tests of StreamingSequence
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#ifndef Svc_Streaming_HPP
+#define Svc_Streaming_HPP
+
+#include "Svc/CmdSequencer/test/ut/ImmediateBase.hpp"
+
+#define WINDOW_SIZE 32
+
+namespace Svc {
+
+  namespace Streaming {
+
+    //! Test sequences read through a window smaller than the file
+    class Tester :
+      public ImmediateBase::Tester
+    {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constructors
+        // ----------------------------------------------------------------------
+
+        //! Construct object Tester
+        Tester(void);
+
+      public:
+
+        // ---------------------------------------------------------------------- 
+        // Tests
+        // ---------------------------------------------------------------------- 
+
+        //! Run an automatic sequence by command
+        void AutoByCommand(void);
+
+        //! Run a sequence with data after the records, which stops it
+        //! before its last record
+        void DataAfterRecords(void);
+
+    };
+
+  }
+
+}
+
+#endif
@@ -18,6 +18,7 @@
 #include "Os/File.hpp"
 #include "Svc/CmdSequencer/CmdSequencerImpl.hpp"
 #include "Svc/CmdSequencer/formats/AMPCSSequence.hpp"
+#include "Svc/CmdSequencer/formats/StreamingSequence.hpp"
 #include "Svc/CmdSequencer/test/ut/SequenceFiles/SequenceFiles.hpp"
 #include "Svc/CmdSequencer/test/ut/UnitTest.hpp"
 
@@ -67,7 +68,8 @@ namespace Svc {
         Sequences(
             CmdSequencerComponentImpl& component //!< The component under test
         ) :
-          ampcsSequence(component)
+          ampcsSequence(component),
+          streamingSequence(component)
         {
 
         }
@@ -75,6 +77,9 @@ namespace Svc {
         //! The AMPCS sequence
         AMPCSSequence ampcsSequence;
 
+        //! The streaming F Prime sequence
+        StreamingSequence streamingSequence;
+
       };
 
       struct Interceptors {
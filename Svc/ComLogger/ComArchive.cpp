@@ -0,0 +1,625 @@
+// ======================================================================
+// \title  ComArchive.cpp
+// \brief  Implementation for Svc::ComArchive
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Svc/ComLogger/ComArchive.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Utils/Hash/Hash.hpp"
+
+#include <string.h>
+
+namespace Svc {
+
+  namespace ComArchive {
+
+    // Block header field offsets
+    enum {
+      OFFSET_MAGIC = 0,
+      OFFSET_VERSION = 4,
+      OFFSET_BLOCK_SIZE = 8,
+      OFFSET_PACKET_COUNT = 12,
+      OFFSET_DATA_SIZE = 16,
+      OFFSET_TIME_BASE = 20,
+      OFFSET_TIME_CONTEXT = 24,
+      OFFSET_FIRST_SECONDS = 28,
+      OFFSET_FIRST_USECONDS = 32,
+      OFFSET_LAST_SECONDS = 36,
+      OFFSET_LAST_USECONDS = 40,
+      OFFSET_CRC = 44
+    };
+
+    // Index entry field offsets
+    enum {
+      ENTRY_FIRST_SECONDS = 0,
+      ENTRY_FIRST_USECONDS = 4,
+      ENTRY_LAST_SECONDS = 8,
+      ENTRY_LAST_USECONDS = 12,
+      ENTRY_PACKET_COUNT = 16
+    };
+
+    // Trailer field offsets
+    enum {
+      TRAILER_MAGIC_OFFSET = 0,
+      TRAILER_VERSION = 4,
+      TRAILER_BLOCK_SIZE = 8,
+      TRAILER_BLOCK_COUNT = 12,
+      TRAILER_PACKET_COUNT = 16,
+      TRAILER_CRC = 20
+    };
+
+    static void putU32(U8 *const dest, const U32 value)
+    {
+      dest[0] = static_cast<U8>(value >> 24);
+      dest[1] = static_cast<U8>(value >> 16);
+      dest[2] = static_cast<U8>(value >> 8);
+      dest[3] = static_cast<U8>(value);
+    }
+
+    static U32 getU32(const U8 *const source)
+    {
+      return (static_cast<U32>(source[0]) << 24) |
+        (static_cast<U32>(source[1]) << 16) |
+        (static_cast<U32>(source[2]) << 8) |
+        static_cast<U32>(source[3]);
+    }
+
+    static U32 crc(const U8 *const data, const U32 size)
+    {
+      Utils::Hash hash;
+      hash.init();
+      hash.update(data, size);
+      U32 value = 0;
+      hash.final(value);
+      return value;
+    }
+
+    // True if the first time is earlier than the second
+    static bool earlier(
+        const U32 seconds1,
+        const U32 useconds1,
+        const U32 seconds2,
+        const U32 useconds2
+    )
+    {
+      return (seconds1 < seconds2) ||
+        ((seconds1 == seconds2) && (useconds1 < useconds2));
+    }
+
+    // ----------------------------------------------------------------------
+    // Writer
+    // ----------------------------------------------------------------------
+
+    Writer ::
+      Writer(void) :
+        opened(false),
+        block(NULL),
+        index(NULL),
+        blockSize(0),
+        maxBlocks(0),
+        blockNumber(0),
+        blockFill(0),
+        blockPackets(0),
+        blockDirty(false),
+        packetCount(0),
+        writeCalls(0),
+        bytesWritten(0)
+    {
+    }
+
+    Writer ::
+      ~Writer(void)
+    {
+      if (this->isOpen()) {
+        (void) this->close();
+      }
+      delete[] this->block;
+      delete[] this->index;
+    }
+
+    bool Writer ::
+      create(
+          const U32 blockSize,
+          const U32 maxBlocks
+      )
+    {
+      FW_ASSERT(!this->isOpen());
+      if (blockSize <= BLOCK_HEADER_SIZE + RECORD_HEADER_SIZE || maxBlocks == 0) {
+        return false;
+      }
+      delete[] this->block;
+      delete[] this->index;
+      this->block = new U8[blockSize];
+      this->index = new U8[maxBlocks * INDEX_ENTRY_SIZE];
+      this->blockSize = blockSize;
+      this->maxBlocks = maxBlocks;
+      return true;
+    }
+
+    Os::File::Status Writer ::
+      open(const char *const fileName)
+    {
+      FW_ASSERT(!this->isOpen());
+      FW_ASSERT(this->blockSize > 0);
+      const Os::File::Status status =
+        this->file.open(fileName, Os::File::OPEN_CREATE);
+      if (status != Os::File::OP_OK) {
+        return status;
+      }
+      this->opened = true;
+      this->blockNumber = 0;
+      this->blockFill = 0;
+      this->blockPackets = 0;
+      this->blockDirty = false;
+      this->packetCount = 0;
+      memset(this->block, 0, this->blockSize);
+      return Os::File::OP_OK;
+    }
+
+    bool Writer ::
+      isOpen(void) const
+    {
+      return this->opened;
+    }
+
+    bool Writer ::
+      fits(const U32 size) const
+    {
+      if (!this->isOpen()) {
+        return false;
+      }
+      const U32 capacity = this->blockSize - BLOCK_HEADER_SIZE;
+      if (size > capacity - RECORD_HEADER_SIZE) {
+        return false;
+      }
+      const U32 free = capacity - this->blockFill;
+      return (RECORD_HEADER_SIZE + size <= free) ||
+        (this->blockNumber + 1 < this->maxBlocks);
+    }
+
+    Os::File::Status Writer ::
+      append(
+          const Fw::Time& time,
+          const U8 *const data,
+          const U16 size
+      )
+    {
+      if (!this->isOpen()) {
+        return Os::File::NOT_OPENED;
+      }
+      if (!this->fits(size)) {
+        return Os::File::BAD_SIZE;
+      }
+
+      // Start a new block if the packet does not fit in this one. The packet
+      // goes in even if writing the full block failed.
+      Os::File::Status status = Os::File::OP_OK;
+      if (BLOCK_HEADER_SIZE + this->blockFill + RECORD_HEADER_SIZE + size > this->blockSize) {
+        if (this->blockDirty) {
+          status = this->writeBlock();
+        }
+        this->blockNumber++;
+        this->blockFill = 0;
+        this->blockPackets = 0;
+        memset(this->block, 0, this->blockSize);
+      }
+
+      const U32 seconds = time.getSeconds();
+      const U32 useconds = time.getUSeconds();
+      U8 *const entry = &this->index[this->blockNumber * INDEX_ENTRY_SIZE];
+      if (this->blockPackets == 0) {
+        putU32(&this->block[OFFSET_TIME_BASE], time.getTimeBase());
+        putU32(&this->block[OFFSET_TIME_CONTEXT], time.getContext());
+        putU32(&entry[ENTRY_FIRST_SECONDS], seconds);
+        putU32(&entry[ENTRY_FIRST_USECONDS], useconds);
+      }
+      putU32(&entry[ENTRY_LAST_SECONDS], seconds);
+      putU32(&entry[ENTRY_LAST_USECONDS], useconds);
+
+      U8 *const record = &this->block[BLOCK_HEADER_SIZE + this->blockFill];
+      putU32(&record[0], seconds);
+      putU32(&record[4], useconds);
+      record[8] = static_cast<U8>(size >> 8);
+      record[9] = static_cast<U8>(size);
+      if (size > 0) {
+        memcpy(&record[RECORD_HEADER_SIZE], data, size);
+      }
+      this->blockFill += RECORD_HEADER_SIZE + size;
+      this->blockPackets++;
+      putU32(&entry[ENTRY_PACKET_COUNT], this->blockPackets);
+      this->blockDirty = true;
+      this->packetCount++;
+      return status;
+    }
+
+    Os::File::Status Writer ::
+      flush(void)
+    {
+      if (!this->isOpen()) {
+        return Os::File::NOT_OPENED;
+      }
+      if (!this->blockDirty) {
+        return Os::File::OP_OK;
+      }
+      return this->writeBlock();
+    }
+
+    Os::File::Status Writer ::
+      close(void)
+    {
+      if (!this->isOpen()) {
+        return Os::File::NOT_OPENED;
+      }
+      Os::File::Status status = Os::File::OP_OK;
+      if (this->blockDirty) {
+        status = this->writeBlock();
+      }
+
+      // The index and the trailer go after the last block with packets
+      const U32 blockCount = this->blockNumber + ((this->blockPackets > 0) ? 1 : 0);
+      const U32 indexSize = blockCount * INDEX_ENTRY_SIZE;
+      const U32 indexOffset = blockCount * this->blockSize;
+      if (status == Os::File::OP_OK && indexSize > 0) {
+        status = this->writeAt(this->index, indexSize, indexOffset);
+      }
+      if (status == Os::File::OP_OK) {
+        U8 trailer[TRAILER_SIZE];
+        putU32(&trailer[TRAILER_MAGIC_OFFSET], TRAILER_MAGIC);
+        putU32(&trailer[TRAILER_VERSION], VERSION);
+        putU32(&trailer[TRAILER_BLOCK_SIZE], this->blockSize);
+        putU32(&trailer[TRAILER_BLOCK_COUNT], blockCount);
+        putU32(&trailer[TRAILER_PACKET_COUNT], this->packetCount);
+        putU32(&trailer[TRAILER_CRC], crc(this->index, indexSize));
+        status = this->writeAt(trailer, TRAILER_SIZE, indexOffset + indexSize);
+      }
+      this->file.close();
+      this->opened = false;
+      return status;
+    }
+
+    U32 Writer ::
+      getBlockSize(void) const
+    {
+      return this->blockSize;
+    }
+
+    U32 Writer ::
+      getPacketCount(void) const
+    {
+      return this->packetCount;
+    }
+
+    U32 Writer ::
+      getClosedSize(void) const
+    {
+      const U32 blockCount = this->blockNumber + ((this->blockPackets > 0) ? 1 : 0);
+      return blockCount * (this->blockSize + INDEX_ENTRY_SIZE) + TRAILER_SIZE;
+    }
+
+    U32 Writer ::
+      getWriteCalls(void) const
+    {
+      return this->writeCalls;
+    }
+
+    U64 Writer ::
+      getBytesWritten(void) const
+    {
+      return this->bytesWritten;
+    }
+
+    Os::File::Status Writer ::
+      writeBlock(void)
+    {
+      const U8 *const entry = &this->index[this->blockNumber * INDEX_ENTRY_SIZE];
+      putU32(&this->block[OFFSET_MAGIC], BLOCK_MAGIC);
+      putU32(&this->block[OFFSET_VERSION], VERSION);
+      putU32(&this->block[OFFSET_BLOCK_SIZE], this->blockSize);
+      putU32(&this->block[OFFSET_PACKET_COUNT], this->blockPackets);
+      putU32(&this->block[OFFSET_DATA_SIZE], this->blockFill);
+      putU32(&this->block[OFFSET_FIRST_SECONDS], getU32(&entry[ENTRY_FIRST_SECONDS]));
+      putU32(&this->block[OFFSET_FIRST_USECONDS], getU32(&entry[ENTRY_FIRST_USECONDS]));
+      putU32(&this->block[OFFSET_LAST_SECONDS], getU32(&entry[ENTRY_LAST_SECONDS]));
+      putU32(&this->block[OFFSET_LAST_USECONDS], getU32(&entry[ENTRY_LAST_USECONDS]));
+      putU32(&this->block[OFFSET_CRC], crc(&this->block[BLOCK_HEADER_SIZE], this->blockFill));
+      // The whole block is written, so the file always ends on a block boundary
+      const Os::File::Status status =
+        this->writeAt(this->block, this->blockSize, this->blockNumber * this->blockSize);
+      if (status == Os::File::OP_OK) {
+        this->blockDirty = false;
+      }
+      return status;
+    }
+
+    Os::File::Status Writer ::
+      writeAt(
+          const U8 *const data,
+          const U32 size,
+          const U32 offset
+      )
+    {
+      U32 done = 0;
+      while (done < size) {
+        NATIVE_INT_TYPE chunk = size - done;
+        const Os::File::Status status = this->file.writeAt(&data[done], chunk, offset + done);
+        this->writeCalls++;
+        if (status != Os::File::OP_OK) {
+          return status;
+        }
+        if (chunk <= 0) {
+          return Os::File::OTHER_ERROR;
+        }
+        done += chunk;
+        this->bytesWritten += chunk;
+      }
+      return Os::File::OP_OK;
+    }
+
+    // ----------------------------------------------------------------------
+    // Reader
+    // ----------------------------------------------------------------------
+
+    Reader ::
+      Reader(void) :
+        indexed(false),
+        blockSize(0),
+        blockCount(0),
+        packetCount(0),
+        block(0),
+        inBlock(false),
+        blockPackets(0),
+        blockEnd(0),
+        timeBase(0),
+        timeContext(0),
+        position(0),
+        positionPacket(0)
+    {
+    }
+
+    Os::File::Status Reader ::
+      open(const char *const fileName)
+    {
+      FW_ASSERT(!this->file.isOpen());
+      const Os::File::Status status =
+        this->file.open(fileName, Os::MappedFile::OPEN_READ);
+      if (status != Os::File::OP_OK) {
+        return status;
+      }
+      const U32 size = this->file.getSize();
+      const U8 *const base = this->file.getData();
+      this->indexed = false;
+      this->blockCount = 0;
+      this->packetCount = 0;
+
+      // A closed archive: the trailer must describe the file and the index must match its CRC
+      if (size >= TRAILER_SIZE) {
+        const U8 *const trailer = &base[size - TRAILER_SIZE];
+        const U32 blockSize = getU32(&trailer[TRAILER_BLOCK_SIZE]);
+        const U32 blockCount = getU32(&trailer[TRAILER_BLOCK_COUNT]);
+        const U64 expected =
+          static_cast<U64>(blockCount) * (static_cast<U64>(blockSize) + INDEX_ENTRY_SIZE) + TRAILER_SIZE;
+        if (getU32(&trailer[TRAILER_MAGIC_OFFSET]) == TRAILER_MAGIC &&
+            getU32(&trailer[TRAILER_VERSION]) == VERSION &&
+            blockSize > BLOCK_HEADER_SIZE + RECORD_HEADER_SIZE &&
+            expected == size &&
+            crc(&base[blockCount * blockSize], blockCount * INDEX_ENTRY_SIZE) ==
+              getU32(&trailer[TRAILER_CRC])) {
+          this->indexed = true;
+          this->blockSize = blockSize;
+          this->blockCount = blockCount;
+          this->packetCount = getU32(&trailer[TRAILER_PACKET_COUNT]);
+        }
+      }
+
+      // An archive that was not closed: take the block size from the first block,
+      // and the blocks up to the first that was never written
+      if (!this->indexed) {
+        if (size < BLOCK_HEADER_SIZE ||
+            getU32(&base[OFFSET_MAGIC]) != BLOCK_MAGIC ||
+            getU32(&base[OFFSET_VERSION]) != VERSION ||
+            getU32(&base[OFFSET_BLOCK_SIZE]) <= BLOCK_HEADER_SIZE + RECORD_HEADER_SIZE) {
+          this->close();
+          return Os::File::BAD_SIZE;
+        }
+        this->blockSize = getU32(&base[OFFSET_BLOCK_SIZE]);
+        const U32 blocks = size / this->blockSize;
+        while (this->blockCount < blocks) {
+          const U8 *const header = &base[this->blockCount * this->blockSize];
+          if (getU32(&header[OFFSET_MAGIC]) != BLOCK_MAGIC) {
+            break;
+          }
+          this->packetCount += getU32(&header[OFFSET_PACKET_COUNT]);
+          this->blockCount++;
+        }
+      }
+      this->block = 0;
+      this->inBlock = false;
+      return Os::File::OP_OK;
+    }
+
+    void Reader ::
+      close(void)
+    {
+      (void) this->file.close();
+      this->blockCount = 0;
+      this->packetCount = 0;
+      this->inBlock = false;
+    }
+
+    bool Reader ::
+      isIndexed(void) const
+    {
+      return this->indexed;
+    }
+
+    U32 Reader ::
+      getBlockCount(void) const
+    {
+      return this->blockCount;
+    }
+
+    U32 Reader ::
+      getPacketCount(void) const
+    {
+      return this->packetCount;
+    }
+
+    bool Reader ::
+      seekTime(const Fw::Time& time)
+    {
+      const U32 seconds = time.getSeconds();
+      const U32 useconds = time.getUSeconds();
+
+      // Find the first block whose last packet is not earlier than the time
+      U32 low = 0;
+      U32 high = this->blockCount;
+      while (low < high) {
+        const U32 middle = low + (high - low) / 2;
+        U32 packets = 0;
+        U32 lastSeconds = 0;
+        U32 lastUseconds = 0;
+        this->getBlockInfo(middle, packets, lastSeconds, lastUseconds);
+        if (packets == 0 || earlier(lastSeconds, lastUseconds, seconds, useconds)) {
+          low = middle + 1;
+        }
+        else {
+          high = middle;
+        }
+      }
+      if (low >= this->blockCount || !this->enterBlock(low)) {
+        return false;
+      }
+
+      // Then scan that block to the first packet that is not earlier
+      while (this->positionPacket < this->blockPackets) {
+        U32 recordSeconds = 0;
+        U32 recordUseconds = 0;
+        U16 size = 0;
+        if (!this->readRecordHeader(recordSeconds, recordUseconds, size)) {
+          return false;
+        }
+        if (!earlier(recordSeconds, recordUseconds, seconds, useconds)) {
+          return true;
+        }
+        this->position += RECORD_HEADER_SIZE + size;
+        this->positionPacket++;
+      }
+      return false;
+    }
+
+    bool Reader ::
+      next(Record& record)
+    {
+      while (!this->inBlock || this->positionPacket >= this->blockPackets) {
+        const U32 nextBlock = this->inBlock ? this->block + 1 : this->block;
+        if (nextBlock >= this->blockCount || !this->enterBlock(nextBlock)) {
+          return false;
+        }
+      }
+      U32 seconds = 0;
+      U32 useconds = 0;
+      U16 size = 0;
+      if (!this->readRecordHeader(seconds, useconds, size)) {
+        return false;
+      }
+      record.time.set(
+          static_cast<TimeBase>(this->timeBase),
+          static_cast<FwTimeContextStoreType>(this->timeContext),
+          seconds,
+          useconds
+      );
+      record.data = &this->file.getData()[this->position + RECORD_HEADER_SIZE];
+      record.size = size;
+      this->position += RECORD_HEADER_SIZE + size;
+      this->positionPacket++;
+      return true;
+    }
+
+    void Reader ::
+      getBlockInfo(
+          const U32 block,
+          U32& packets,
+          U32& lastSeconds,
+          U32& lastUseconds
+      ) const
+    {
+      FW_ASSERT(block < this->blockCount, block, this->blockCount);
+      const U8 *const base = this->file.getData();
+      if (this->indexed) {
+        const U8 *const entry =
+          &base[this->blockCount * this->blockSize + block * INDEX_ENTRY_SIZE];
+        packets = getU32(&entry[ENTRY_PACKET_COUNT]);
+        lastSeconds = getU32(&entry[ENTRY_LAST_SECONDS]);
+        lastUseconds = getU32(&entry[ENTRY_LAST_USECONDS]);
+      }
+      else {
+        const U8 *const header = &base[block * this->blockSize];
+        packets = getU32(&header[OFFSET_PACKET_COUNT]);
+        lastSeconds = getU32(&header[OFFSET_LAST_SECONDS]);
+        lastUseconds = getU32(&header[OFFSET_LAST_USECONDS]);
+      }
+    }
+
+    bool Reader ::
+      enterBlock(const U32 block)
+    {
+      FW_ASSERT(block < this->blockCount, block, this->blockCount);
+      // A damaged block stays the reader position, so reading stops there
+      this->block = block;
+      this->inBlock = false;
+      const U32 start = block * this->blockSize;
+      const U8 *const header = &this->file.getData()[start];
+      const U32 packets = getU32(&header[OFFSET_PACKET_COUNT]);
+      const U32 dataSize = getU32(&header[OFFSET_DATA_SIZE]);
+      if (getU32(&header[OFFSET_MAGIC]) != BLOCK_MAGIC ||
+          getU32(&header[OFFSET_VERSION]) != VERSION ||
+          getU32(&header[OFFSET_BLOCK_SIZE]) != this->blockSize ||
+          dataSize > this->blockSize - BLOCK_HEADER_SIZE ||
+          crc(&header[BLOCK_HEADER_SIZE], dataSize) != getU32(&header[OFFSET_CRC])) {
+        return false;
+      }
+      if (this->indexed) {
+        U32 indexPackets = 0;
+        U32 lastSeconds = 0;
+        U32 lastUseconds = 0;
+        this->getBlockInfo(block, indexPackets, lastSeconds, lastUseconds);
+        if (indexPackets != packets) {
+          return false;
+        }
+      }
+      this->inBlock = true;
+      this->blockPackets = packets;
+      this->blockEnd = start + BLOCK_HEADER_SIZE + dataSize;
+      this->timeBase = getU32(&header[OFFSET_TIME_BASE]);
+      this->timeContext = getU32(&header[OFFSET_TIME_CONTEXT]);
+      this->position = start + BLOCK_HEADER_SIZE;
+      this->positionPacket = 0;
+      return true;
+    }
+
+    bool Reader ::
+      readRecordHeader(
+          U32& seconds,
+          U32& useconds,
+          U16& size
+      ) const
+    {
+      if (this->position + RECORD_HEADER_SIZE > this->blockEnd) {
+        return false;
+      }
+      const U8 *const record = &this->file.getData()[this->position];
+      seconds = getU32(&record[0]);
+      useconds = getU32(&record[4]);
+      size = static_cast<U16>((record[8] << 8) | record[9]);
+      return this->position + RECORD_HEADER_SIZE + size <= this->blockEnd;
+    }
+
+  }
+
+}
@@ -0,0 +1,289 @@
+// ======================================================================
+// \title  ComArchive.hpp
+// \brief  Time indexed archive files for ComLogger
+//
+// An archive is a file of fixed size blocks, followed by an index of
+// the blocks and a trailer. All fields are big endian. It holds:
+//
+// - Blocks of block size bytes, each with a header of BLOCK_HEADER_SIZE
+//   bytes: magic, version, block size, packet count, record bytes,
+//   time base and time context, seconds and microseconds of the first
+//   and of the last packet, and a CRC32 of the record bytes, each a
+//   U32. The records follow the header: seconds and microseconds, each
+//   a U32, a U16 size, then size bytes of the com buffer. Records do
+//   not cross blocks, and the rest of a block is zero. The time base
+//   and context of the first packet in a block apply to the whole block.
+//
+// - An index with one entry per block: seconds and microseconds of the
+//   first and of the last packet, and the packet count, each a U32.
+//   Block n starts at n times the block size, and the index just after
+//   the last block.
+//
+// - A trailer of TRAILER_SIZE bytes at the end of the file: magic,
+//   version, block size, block count, packet count and a CRC32 of the
+//   index, each a U32.
+//
+// The reader maps an archive and finds the first packet at or after a
+// time with a binary search of the index, touching one block of data.
+// It assumes packet times do not go backwards within an archive. An
+// archive whose writer stopped before closing it has no index; the
+// reader then uses the block headers in its place.
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_ComArchive_HPP
+#define Svc_ComArchive_HPP
+
+#include "Fw/Types/BasicTypes.hpp"
+#include "Fw/Time/Time.hpp"
+#include "Os/File.hpp"
+#include "Os/MappedFile.hpp"
+
+namespace Svc {
+
+  namespace ComArchive {
+
+    enum {
+      BLOCK_MAGIC = 0x434C424B, //!< "CLBK"
+      TRAILER_MAGIC = 0x434C4958, //!< "CLIX"
+      VERSION = 1, //!< Format version
+      BLOCK_HEADER_SIZE = 48, //!< Bytes before the first record of a block
+      RECORD_HEADER_SIZE = 10, //!< Bytes before the data of each record
+      INDEX_ENTRY_SIZE = 20, //!< Bytes in an index entry
+      TRAILER_SIZE = 24 //!< Bytes in the trailer
+    };
+
+    //! Writes an archive
+    class Writer {
+
+      public:
+
+        Writer(void);
+
+        //! Close the archive if still open and free the buffers
+        ~Writer(void);
+
+        //! Allocate the block and index buffers
+        //! \return false if the block is too small for a record or the buffers could not be allocated
+        bool create(
+            const U32 blockSize, //!< The block size
+            const U32 maxBlocks //!< The most blocks in an archive
+        );
+
+        //! Create an archive file
+        //! \return The status of opening the file
+        Os::File::Status open(
+            const char *const fileName //!< The file name
+        );
+
+        //! Whether an archive is open
+        bool isOpen(void) const;
+
+        //! Whether a packet of size bytes fits in the archive
+        bool fits(
+            const U32 size //!< The packet size
+        ) const;
+
+        //! Append a packet, writing the block before it if the packet does not fit there
+        //! \return BAD_SIZE if the packet does not fit in the archive, or the status of writing the block
+        Os::File::Status append(
+            const Fw::Time& time, //!< The packet time
+            const U8 *const data, //!< The packet data
+            const U16 size //!< The packet size
+        );
+
+        //! Write the block being filled, so that the packets in it are on disk
+        //! before the block is full. It is written again when it fills
+        Os::File::Status flush(void);
+
+        //! Write the last block, the index and the trailer, then close the file
+        Os::File::Status close(void);
+
+        //! The size of the archive blocks, or zero before create
+        U32 getBlockSize(void) const;
+
+        //! The number of packets in the archive
+        U32 getPacketCount(void) const;
+
+        //! The number of bytes the archive will take once closed
+        U32 getClosedSize(void) const;
+
+        //! Write calls made to the operating system since construction
+        U32 getWriteCalls(void) const;
+
+        //! Bytes written to disk since construction
+        U64 getBytesWritten(void) const;
+
+      private:
+
+        //! Fill in the block header and write the block at its place in the file
+        Os::File::Status writeBlock(void);
+
+        //! Write bytes at an offset, in as many calls as it takes
+        Os::File::Status writeAt(
+            const U8 *const data, //!< The data
+            const U32 size, //!< The size
+            const U32 offset //!< The file offset
+        );
+
+        //! The archive file
+        Os::File file;
+
+        //! Whether the archive file is open
+        bool opened;
+
+        //! The block being filled
+        U8* block;
+
+        //! The index entries of the blocks written
+        U8* index;
+
+        //! The block size
+        U32 blockSize;
+
+        //! The most blocks in an archive
+        U32 maxBlocks;
+
+        //! The number of the block being filled
+        U32 blockNumber;
+
+        //! The bytes of records in the block being filled
+        U32 blockFill;
+
+        //! The number of packets in the block being filled
+        U32 blockPackets;
+
+        //! Whether the block being filled has packets not yet written
+        bool blockDirty;
+
+        //! The number of packets in the archive
+        U32 packetCount;
+
+        //! Write calls made
+        U32 writeCalls;
+
+        //! Bytes written
+        U64 bytesWritten;
+
+    };
+
+    //! A packet read from an archive
+    struct Record {
+      Fw::Time time; //!< The time the packet was logged
+      const U8* data; //!< The packet data, in the mapping of the archive
+      U16 size; //!< The packet size
+    };
+
+    //! Reads an archive
+    class Reader {
+
+      public:
+
+        Reader(void);
+
+        //! Map an archive and check its layout
+        //! \return The status of mapping the file, or BAD_SIZE if it is not a valid archive
+        Os::File::Status open(
+            const char *const fileName //!< The file name
+        );
+
+        //! Unmap the archive
+        void close(void);
+
+        //! Whether the archive was closed by its writer and has an index
+        bool isIndexed(void) const;
+
+        //! The number of blocks in the archive
+        U32 getBlockCount(void) const;
+
+        //! The number of packets in the archive
+        U32 getPacketCount(void) const;
+
+        //! Position the reader at the first packet at or after a time
+        //! \return false if no packet is that late
+        bool seekTime(
+            const Fw::Time& time //!< The time
+        );
+
+        //! Read the packet at the reader position and move to the next one
+        //! \return false at the end of the archive, or if a block is damaged
+        bool next(
+            Record& record //!< The record
+        );
+
+      private:
+
+        //! Get the packet count and the time of the last packet in a block, from the index
+        //! or from the block header
+        void getBlockInfo(
+            const U32 block, //!< The block number
+            U32& packets, //!< The packet count
+            U32& lastSeconds, //!< The seconds of the last packet time
+            U32& lastUseconds //!< The microseconds of the last packet time
+        ) const;
+
+        //! Move the reader to the start of a block, checking its header and CRC
+        //! \return false if the block is damaged
+        bool enterBlock(
+            const U32 block //!< The block number
+        );
+
+        //! Read the header of the record at the reader position
+        //! \return false if the record does not lie within the block
+        bool readRecordHeader(
+            U32& seconds, //!< The seconds of the packet time
+            U32& useconds, //!< The microseconds of the packet time
+            U16& size //!< The packet size
+        ) const;
+
+        //! The mapped file
+        Os::MappedFile file;
+
+        //! Whether the archive has an index
+        bool indexed;
+
+        //! The block size
+        U32 blockSize;
+
+        //! The number of blocks
+        U32 blockCount;
+
+        //! The number of packets
+        U32 packetCount;
+
+        //! The block at the reader position
+        U32 block;
+
+        //! Whether the reader has entered the block
+        bool inBlock;
+
+        //! The packets in the block at the reader position
+        U32 blockPackets;
+
+        //! The end of the records in the block at the reader position
+        U32 blockEnd;
+
+        //! The time base of the block at the reader position
+        U32 timeBase;
+
+        //! The time context of the block at the reader position
+        U32 timeContext;
+
+        //! The offset of the record at the reader position
+        U32 position;
+
+        //! The number of the packet at the reader position within its block
+        U32 positionPacket;
+
+    };
+
+  }
+
+}
+
+#endif
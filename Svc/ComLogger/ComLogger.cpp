@@ -21,6 +21,8 @@ namespace Svc {
       ComLoggerComponentBase(compName), 
       maxFileSize(maxFileSize),
       fileMode(CLOSED), 
+      useAsyncFile(false),
+      useArchive(false),
       byteCount(0),
       writeErrorOccurred(false),
       openErrorOccurred(false),
@@ -50,6 +52,44 @@ namespace Svc {
     ComLoggerComponentBase::init(queueDepth, instance);
   }
 
+  bool ComLogger ::
+    setAsyncWrites(NATIVE_UINT_TYPE asyncDepth)
+  {
+    FW_ASSERT( CLOSED == this->fileMode );
+    FW_ASSERT( 0 == this->file.getBlockSize() );
+    FW_ASSERT( !this->useArchive );
+    // Each record, with its length, goes into one buffer:
+    Os::AsyncFile::AsyncStatus status = 
+      this->asyncFile.create(asyncDepth, FW_COM_BUFFER_MAX_SIZE + sizeof(U16));
+    this->useAsyncFile = (Os::AsyncFile::ASYNC_OK == status);
+    return this->useAsyncFile;
+  }
+
+  bool ComLogger ::
+    setBufferedWrites(NATIVE_UINT_TYPE blockSize, Os::BufferedFile::SyncPolicy policy)
+  {
+    FW_ASSERT( CLOSED == this->fileMode );
+    FW_ASSERT( !this->useAsyncFile );
+    FW_ASSERT( !this->useArchive );
+    return this->file.create(blockSize, policy);
+  }
+
+  bool ComLogger ::
+    setArchiveFormat(NATIVE_UINT_TYPE blockSize)
+  {
+    FW_ASSERT( CLOSED == this->fileMode );
+    FW_ASSERT( !this->useAsyncFile );
+    FW_ASSERT( 0 == this->file.getBlockSize() );
+    // A block must hold the largest com buffer, and a file at least one block with its index:
+    if( blockSize < ComArchive::BLOCK_HEADER_SIZE + ComArchive::RECORD_HEADER_SIZE + FW_COM_BUFFER_MAX_SIZE ||
+        this->maxFileSize < ComArchive::TRAILER_SIZE ) {
+      return false;
+    }
+    const U32 maxBlocks = (this->maxFileSize - ComArchive::TRAILER_SIZE) / (blockSize + ComArchive::INDEX_ENTRY_SIZE);
+    this->useArchive = this->archive.create(blockSize, maxBlocks);
+    return this->useArchive;
+  }
+
   ComLogger ::
     ~ComLogger(void)
   {
@@ -61,7 +101,15 @@ namespace Svc {
     // So I am copying part of that function here.
     if( OPEN == this->fileMode ) {
       // Close file:
-      this->file.close();
+      if( this->useAsyncFile ) {
+        this->asyncFile.close();
+      }
+      else if( this->useArchive ) {
+        (void) this->archive.close();
+      }
+      else {
+        this->file.close();
+      }
 
       // Write out the hash file to disk:
       this->writeHashFile();
@@ -96,7 +144,12 @@ namespace Svc {
     U16 size = size32 & 0xFFFF;
 
     // Close the file if it will be too big:
-    if( OPEN == this->fileMode ) {
+    if( OPEN == this->fileMode && this->useArchive ) {
+      if( !this->archive.fits(size) ) {
+        this->closeFile();
+      }
+    }
+    else if( OPEN == this->fileMode ) {
       U32 projectedByteCount = this->byteCount + size;
       if( this->storeBufferLength ) {
         projectedByteCount += sizeof(size);
@@ -137,6 +190,43 @@ namespace Svc {
       this->pingOut_out(0,key);
   }
 
+  void ComLogger ::
+    schedIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    U32 writeCalls;
+    U64 bytesWritten;
+    if( this->useAsyncFile ) {
+      // Free the buffers of finished writes, and report any that failed:
+      if( OPEN == this->fileMode ) {
+        (void) this->asyncFile.complete(false);
+        this->checkAsyncWrites();
+      }
+      writeCalls = this->asyncFile.getWriteCalls();
+      bytesWritten = this->asyncFile.getBytesWritten();
+    }
+    else if( this->useArchive ) {
+      if( OPEN == this->fileMode ) {
+        this->checkArchiveWrite(this->archive.flush());
+      }
+      writeCalls = this->archive.getWriteCalls();
+      bytesWritten = this->archive.getBytesWritten();
+    }
+    else {
+      if( OPEN == this->fileMode ) {
+        this->flushFile();
+      }
+      writeCalls = this->file.getWriteCalls();
+      bytesWritten = this->file.getBytesWritten();
+    }
+
+    this->tlmWrite_ComLogger_FileWrites(writeCalls);
+    this->tlmWrite_ComLogger_BytesPerWrite(
+      (writeCalls > 0) ? static_cast<F32>(bytesWritten) / static_cast<F32>(writeCalls) : 0.0f);
+  }
+
   void ComLogger ::
     openFile(
     )
@@ -144,23 +234,33 @@ namespace Svc {
     FW_ASSERT( CLOSED == this->fileMode );
 
     U32 bytesCopied;
+    const char* extension = this->useArchive ? "comarc" : "com";
 
     // Create filename:
     Fw::Time timestamp = getTime();
     memset(this->fileName, 0, sizeof(this->fileName));
-    bytesCopied = snprintf((char*) this->fileName, sizeof(this->fileName), "%s_%d_%d_%06d.com", 
-      this->filePrefix, (U32) timestamp.getTimeBase(), timestamp.getSeconds(), timestamp.getUSeconds());
+    bytesCopied = snprintf((char*) this->fileName, sizeof(this->fileName), "%s_%d_%d_%06d.%s", 
+      this->filePrefix, (U32) timestamp.getTimeBase(), timestamp.getSeconds(), timestamp.getUSeconds(), extension);
 
     // "A return value of size or more means that the output was truncated"
     // See here: http://linux.die.net/man/3/snprintf
     FW_ASSERT( bytesCopied < sizeof(this->fileName) );
 
     // Create sha filename:
-    bytesCopied = snprintf((char*) this->hashFileName, sizeof(this->hashFileName), "%s_%d_%d_%06d.com%s", 
-      this->filePrefix, (U32) timestamp.getTimeBase(), timestamp.getSeconds(), timestamp.getUSeconds(), Utils::Hash::getFileExtensionString());
+    bytesCopied = snprintf((char*) this->hashFileName, sizeof(this->hashFileName), "%s_%d_%d_%06d.%s%s", 
+      this->filePrefix, (U32) timestamp.getTimeBase(), timestamp.getSeconds(), timestamp.getUSeconds(), extension, Utils::Hash::getFileExtensionString());
     FW_ASSERT( bytesCopied < sizeof(this->hashFileName) );
 
-    Os::File::Status ret = file.open((char*) this->fileName, Os::File::OPEN_WRITE);
+    Os::File::Status ret;
+    if( this->useAsyncFile ) {
+      ret = this->asyncFile.open((char*) this->fileName, Os::File::OPEN_WRITE);
+    }
+    else if( this->useArchive ) {
+      ret = this->archive.open((char*) this->fileName);
+    }
+    else {
+      ret = file.open((char*) this->fileName, Os::File::OPEN_WRITE);
+    }
     if( Os::File::OP_OK != ret ) {
       if( !this->openErrorOccurred ) { // throttle this event, otherwise a positive
                                        // feedback event loop can occur!
@@ -185,8 +285,19 @@ namespace Svc {
     )
   {
     if( OPEN == this->fileMode ) {
-      // Close file:
-      this->file.close();
+      // Close file, reporting writes that failed since the last record:
+      if( this->useAsyncFile ) {
+        this->asyncFile.close();
+        this->checkAsyncWrites();
+      }
+      else if( this->useArchive ) {
+        // Writes the last block, the index and the trailer:
+        this->checkArchiveWrite(this->archive.close());
+      }
+      else {
+        this->flushFile();
+        this->file.close();
+      }
 
       // Write out the hash file to disk:
       this->writeHashFile();
@@ -206,6 +317,15 @@ namespace Svc {
       U16 size
     )
   {
+    if( this->useAsyncFile ) {
+      this->writeComBufferToAsyncFile(data, size);
+      return;
+    }
+    if( this->useArchive ) {
+      this->writeComBufferToArchive(data, size);
+      return;
+    }
+
     if( this->storeBufferLength ) {
       U8 buffer[sizeof(size)];
       Fw::SerialBuffer serialLength(&buffer[0], sizeof(size)); 
@@ -225,6 +345,111 @@ namespace Svc {
     }
   }
 
+  void ComLogger ::
+    writeComBufferToAsyncFile(
+      Fw::ComBuffer &data,
+      U16 size
+    )
+  {
+    // Free the buffers of finished writes, and report any that failed:
+    (void) this->asyncFile.complete(false);
+    this->checkAsyncWrites();
+
+    // Copy the record into a buffer. This only waits if every buffer is still being written.
+    U8* buffer = NULL;
+    NATIVE_UINT_TYPE index = 0;
+    Os::AsyncFile::AsyncStatus status = this->asyncFile.getBuffer(buffer, index, true);
+    FW_ASSERT(Os::AsyncFile::ASYNC_OK == status, status);
+    Fw::SerialBuffer record(buffer, this->asyncFile.getBufferSize());
+    Fw::SerializeStatus stat;
+    if( this->storeBufferLength ) {
+      stat = record.serialize(size);
+      FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, stat);
+    }
+    stat = record.serialize(data.getBuffAddr(), size, true);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, stat);
+
+    // Write in the background:
+    const U32 length = record.getBuffLength();
+    status = this->asyncFile.submitWrite(index, length);
+    if( Os::AsyncFile::ASYNC_OK != status ) {
+      if( !this->writeErrorOccurred ) {
+        Fw::LogStringArg logStringArg((char*) this->fileName);
+        this->log_WARNING_HI_FileWriteError(Os::AsyncFile::toFileStatus(status), 0, length, logStringArg);
+      }
+      this->writeErrorOccurred = true;
+      return;
+    }
+    this->byteCount += length;
+  }
+
+  void ComLogger ::
+    writeComBufferToArchive(
+      Fw::ComBuffer &data,
+      U16 size
+    )
+  {
+    // comIn closed the file if the record did not fit, so only a full block that failed to write is
+    // an error here. The record stays in the next block either way.
+    Os::File::Status ret = this->archive.append(getTime(), data.getBuffAddr(), size);
+    this->checkArchiveWrite(ret);
+    this->byteCount += ComArchive::RECORD_HEADER_SIZE + size;
+  }
+
+  void ComLogger ::
+    flushFile(
+    )
+  {
+    const U32 buffered = this->file.getBuffered();
+    Os::File::Status ret = this->file.flush();
+    if( Os::File::OP_OK != ret ) {
+      if( !this->writeErrorOccurred ) { // throttle this event, otherwise a positive
+                                        // feedback event loop can occur!
+        Fw::LogStringArg logStringArg((char*) this->fileName);
+        this->log_WARNING_HI_FileWriteError(ret, 0, buffered, logStringArg);
+      }
+      this->writeErrorOccurred = true;
+    }
+  }
+
+  void ComLogger ::
+    checkAsyncWrites(
+    )
+  {
+    NATIVE_UINT_TYPE written = 0;
+    NATIVE_UINT_TYPE requested = 0;
+    Os::File::Status ret = this->asyncFile.getWriteStatus(written, requested);
+    if( Os::File::OP_OK != ret ) {
+      if( !this->writeErrorOccurred ) { // throttle this event, otherwise a positive
+                                        // feedback event loop can occur!
+        Fw::LogStringArg logStringArg((char*) this->fileName);
+        this->log_WARNING_HI_FileWriteError(ret, written, requested, logStringArg);
+      }
+      this->writeErrorOccurred = true;
+    }
+    else {
+      this->writeErrorOccurred = false;
+    }
+  }
+
+  void ComLogger ::
+    checkArchiveWrite(
+      Os::File::Status status
+    )
+  {
+    if( Os::File::OP_OK != status ) {
+      if( !this->writeErrorOccurred ) { // throttle this event, otherwise a positive
+                                        // feedback event loop can occur!
+        Fw::LogStringArg logStringArg((char*) this->fileName);
+        this->log_WARNING_HI_FileWriteError(status, 0, this->archive.getBlockSize(), logStringArg);
+      }
+      this->writeErrorOccurred = true;
+    }
+    else {
+      this->writeErrorOccurred = false;
+    }
+  }
+
   bool ComLogger ::
     writeToFile(
       void* data, 
@@ -9,6 +9,9 @@
 
 #include "Svc/ComLogger/ComLoggerComponentAc.hpp"
 #include <Os/File.hpp>
+#include <Os/AsyncFile.hpp>
+#include <Os/BufferedFile.hpp>
+#include <Svc/ComLogger/ComArchive.hpp>
 #include <Os/Mutex.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Utils/Hash/Hash.hpp>
@@ -43,6 +46,25 @@ namespace Svc {
           NATIVE_INT_TYPE instance //!< The instance number
       );
 
+      // Write files through an Os::AsyncFile, so that comIn does not wait for the disk. Each com buffer is
+      // copied into one of asyncDepth buffers, and comIn only waits when all of them are being written.
+      // Call before the component is started. Returns false if the buffers could not be created.
+      bool setAsyncWrites(NATIVE_UINT_TYPE asyncDepth);
+
+      // Coalesce writes into blocks of blockSize bytes. A block is written when it fills, on each call
+      // to schedIn, and when the file is closed. policy selects when the file data is synced to disk.
+      // Call before the component is started, and instead of setAsyncWrites. Returns false if the
+      // block could not be allocated.
+      bool setBufferedWrites(NATIVE_UINT_TYPE blockSize, Os::BufferedFile::SyncPolicy policy);
+
+      // Write archive files instead (see ComArchive.hpp): blocks of blockSize bytes that hold com buffers
+      // stamped with the time they arrived, followed by an index of the blocks, so that a reader can seek
+      // to a time. Every record stores its length, whatever storeBufferLength says. A block is written when
+      // it fills, on each call to schedIn, and when the file is closed. Call before the component is started,
+      // and instead of setAsyncWrites or setBufferedWrites. Returns false if a block cannot hold the largest
+      // com buffer or maxFileSize cannot hold a block.
+      bool setArchiveFormat(NATIVE_UINT_TYPE blockSize);
+
       ~ComLogger(void);
 
       // ----------------------------------------------------------------------
@@ -69,6 +91,14 @@ namespace Svc {
           U32 key /*!< Value to return to pinger*/
       );
 
+      //! Handler implementation for schedIn
+      //! Writes out buffered data and reports write telemetry
+      //!
+      void schedIn_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          NATIVE_UINT_TYPE context /*!< The call order*/
+      );
+
       // ----------------------------------------------------------------------
       // Constants:
       // ----------------------------------------------------------------------
@@ -91,7 +121,11 @@ namespace Svc {
       };
 
       FileMode fileMode;
-      Os::File file;
+      Os::BufferedFile file;
+      Os::AsyncFile asyncFile;
+      bool useAsyncFile;
+      ComArchive::Writer archive;
+      bool useArchive;
       U8 fileName[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       U8 hashFileName[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       U32 byteCount;
@@ -113,6 +147,16 @@ namespace Svc {
         U16 size
       );
 
+      void writeComBufferToAsyncFile(
+        Fw::ComBuffer &data,
+        U16 size
+      );
+
+      void writeComBufferToArchive(
+        Fw::ComBuffer &data,
+        U16 size
+      );
+
       // ----------------------------------------------------------------------
       // Helper functions:
       // ---------------------------------------------------------------------- 
@@ -124,6 +168,16 @@ namespace Svc {
 
       void writeHashFile(
       );
+
+      void checkAsyncWrites(
+      );
+
+      void flushFile(
+      );
+
+      void checkArchiveWrite(
+        Os::File::Status status
+      );
   };
 };
 
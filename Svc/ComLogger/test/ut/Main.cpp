@@ -11,6 +11,11 @@ TEST(Test, testLogging) {
   tester.testLogging();
 }
 
+TEST(Test, testLoggingAsync) {
+  Svc::Tester tester("Tester");
+  tester.testLogging(true);
+}
+
 TEST(Test, testLoggingNoLength) {
   Svc::Tester tester("Tester");
   tester.testLoggingNoLength();
@@ -31,6 +36,16 @@ TEST(Test, closeFileCommand) {
   tester.closeFileCommand();
 }
 
+TEST(Test, bufferedWrites) {
+  Svc::Tester tester("Tester");
+  tester.bufferedWrites();
+}
+
+TEST(Test, archiveFormat) {
+  Svc::Tester tester("Tester", ARCHIVE_BYTES_PER_FILE);
+  tester.archiveFormat();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
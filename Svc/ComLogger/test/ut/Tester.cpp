@@ -16,10 +16,11 @@ namespace Svc {
 
   Tester ::
     Tester(
-        const char *const compName
+        const char *const compName,
+        U32 maxFileSize
     ) : 
       ComLoggerGTestBase(compName, 30),
-      comLogger("ComLogger", FILE_STR, MAX_BYTES_PER_FILE)
+      comLogger("ComLogger", FILE_STR, maxFileSize)
   {
       this->connectPorts();
       this->initComponents();
@@ -40,6 +41,8 @@ namespace Svc {
     this->connect_to_comIn(0, comLogger.get_comIn_InputPort(0));
     comLogger.set_timeCaller_OutputPort(0, this->get_from_timeCaller(0));
     comLogger.set_logOut_OutputPort(0, this->get_from_logOut(0));
+    comLogger.set_tlmOut_OutputPort(0, this->get_from_tlmOut(0));
+    this->connect_to_schedIn(0, comLogger.get_schedIn_InputPort(0));
   }
 
   void Tester ::
@@ -66,7 +69,7 @@ namespace Svc {
   // Tests 
   // ----------------------------------------------------------------------
   void Tester ::
-    testLogging(void) 
+    testLogging(bool async) 
   {
       U8 fileName[2048];
       U8 prevFileName[2048];
@@ -81,6 +84,10 @@ namespace Svc {
       ASSERT_TRUE(comLogger.fileMode == ComLogger::CLOSED);
       ASSERT_EVENTS_SIZE(0);
 
+      if( async ) {
+        ASSERT_TRUE(comLogger.setAsyncWrites(2));
+      }
+
       U8 data[COM_BUFFER_LENGTH] = {0xde,0xad,0xbe,0xef};
       Fw::ComBuffer buffer(&data[0], sizeof(data));
 
@@ -141,6 +148,11 @@ namespace Svc {
         ASSERT_EQ(fsStat, Os::FileSystem::OP_OK);
         ASSERT_LE(fileSize, MAX_BYTES_PER_FILE);
 
+        // Wait for the writes still in flight to the open file:
+        if( async ) {
+          comLogger.asyncFile.flush();
+        }
+
         // Open file:
         ret = file.open((char*) fileName, Os::File::OPEN_READ);
         ASSERT_EQ(Os::File::OP_OK,ret);
@@ -553,6 +565,164 @@ namespace Svc {
     file.close();
   }
 
+  void Tester ::
+    bufferedWrites(void)
+  {
+    U8 fileName[2048];
+    Os::FileSystem::Status fsStat;
+    U64 fileSize = 0;
+    const U32 records = MAX_ENTRIES_PER_FILE-1;
+    const U32 recordSize = COM_BUFFER_LENGTH + sizeof(U16);
+
+    Fw::Time testTime(TB_NONE, 7, 9876543);
+    setTestTime(testTime);
+    memset(fileName, 0, sizeof(fileName));
+    snprintf((char*) fileName, sizeof(fileName), "%s_%d_%d_%06d.com", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds());
+
+    // A block larger than the records written:
+    ASSERT_TRUE(comLogger.setBufferedWrites(64, Os::BufferedFile::SYNC_ON_FLUSH));
+
+    const U8 data[COM_BUFFER_LENGTH] = {0xde,0xad,0xbe,0xef};
+    Fw::ComBuffer buffer(data, sizeof(data));
+    for(U32 i = 0; i < records; i++)
+    {
+      invoke_to_comIn(0, buffer, 0);
+      dispatchAll();
+      ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
+    }
+
+    // Nothing has reached the file yet:
+    fsStat = Os::FileSystem::getFileSize((char*) fileName, fileSize);
+    ASSERT_EQ(fsStat, Os::FileSystem::OP_OK);
+    ASSERT_EQ(fileSize, 0U);
+
+    // The timer writes the block out, in a single call:
+    invoke_to_schedIn(0, 0);
+    dispatchAll();
+    fsStat = Os::FileSystem::getFileSize((char*) fileName, fileSize);
+    ASSERT_EQ(fsStat, Os::FileSystem::OP_OK);
+    ASSERT_EQ(fileSize, records*recordSize);
+
+    ASSERT_TLM_SIZE(2);
+    ASSERT_TLM_ComLogger_FileWrites_SIZE(1);
+    ASSERT_TLM_ComLogger_FileWrites(0, 1);
+    ASSERT_TLM_ComLogger_BytesPerWrite_SIZE(1);
+    ASSERT_TLM_ComLogger_BytesPerWrite(0, static_cast<F32>(records*recordSize));
+
+    // Records after the timer are written when the file is closed:
+    invoke_to_comIn(0, buffer, 0);
+    dispatchAll();
+    sendCmd_CloseFile(0, 1);
+    dispatchAll();
+    ASSERT_TRUE(comLogger.fileMode == ComLogger::CLOSED);
+    fsStat = Os::FileSystem::getFileSize((char*) fileName, fileSize);
+    ASSERT_EQ(fsStat, Os::FileSystem::OP_OK);
+    ASSERT_EQ(fileSize, (records+1)*recordSize);
+    ASSERT_EQ(comLogger.file.getWriteCalls(), 2U);
+
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileClosed_SIZE(1);
+    ASSERT_EVENTS_FileClosed(0, (char*) fileName);
+  }
+
+  void Tester ::
+    archiveFormat(void)
+  {
+    U8 fileName[2048];
+    U8 hashFileName[2048];
+    Os::FileSystem::Status fsStat;
+    U64 fileSize = 0;
+    const U32 recordsPerBlock =
+      (ARCHIVE_BLOCK_SIZE - ComArchive::BLOCK_HEADER_SIZE) / (ComArchive::RECORD_HEADER_SIZE + COM_BUFFER_LENGTH);
+    const U32 records = ARCHIVE_BLOCKS*recordsPerBlock;
+
+    Fw::Time testTime(TB_NONE, 100, 0);
+    setTestTime(testTime);
+    memset(fileName, 0, sizeof(fileName));
+    snprintf((char*) fileName, sizeof(fileName), "%s_%d_%d_%06d.comarc", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds());
+    memset(hashFileName, 0, sizeof(hashFileName));
+    snprintf((char*) hashFileName, sizeof(hashFileName), "%s_%d_%d_%06d.comarc%s", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds(), Utils::Hash::getFileExtensionString());
+
+    // A block must hold the largest com buffer:
+    ASSERT_FALSE(comLogger.setArchiveFormat(
+      ComArchive::BLOCK_HEADER_SIZE + ComArchive::RECORD_HEADER_SIZE + FW_COM_BUFFER_MAX_SIZE - 1));
+    ASSERT_TRUE(comLogger.setArchiveFormat(ARCHIVE_BLOCK_SIZE));
+
+    // Fill both blocks of the file, one com buffer a second:
+    U8 data[COM_BUFFER_LENGTH] = {0xde,0xad,0xbe,0xef};
+    for(U32 i = 0; i < records; i++)
+    {
+      setTestTime(Fw::Time(TB_NONE, 100 + i, 0));
+      data[0] = static_cast<U8>(i);
+      Fw::ComBuffer buffer(data, sizeof(data));
+      invoke_to_comIn(0, buffer, 0);
+      dispatchAll();
+      ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
+      ASSERT_STREQ((char*) comLogger.fileName, (char*) fileName);
+
+      // The timer writes the first block out before it is full, and a reader
+      // can use its header until the file is closed:
+      if( i == 2 ) {
+        invoke_to_schedIn(0, 0);
+        dispatchAll();
+        fsStat = Os::FileSystem::getFileSize((char*) fileName, fileSize);
+        ASSERT_EQ(fsStat, Os::FileSystem::OP_OK);
+        ASSERT_EQ(fileSize, static_cast<U64>(ARCHIVE_BLOCK_SIZE));
+        ASSERT_TLM_ComLogger_FileWrites_SIZE(1);
+        ASSERT_TLM_ComLogger_FileWrites(0, 1);
+
+        ComArchive::Reader reader;
+        ASSERT_EQ(reader.open((char*) fileName), Os::File::OP_OK);
+        ASSERT_FALSE(reader.isIndexed());
+        ASSERT_EQ(reader.getPacketCount(), i + 1);
+        reader.close();
+      }
+    }
+
+    // The next com buffer does not fit, so it goes in a new file:
+    setTestTime(Fw::Time(TB_NONE, 100 + records, 0));
+    Fw::ComBuffer buffer(data, sizeof(data));
+    invoke_to_comIn(0, buffer, 0);
+    dispatchAll();
+    ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
+    ASSERT_STRNE((char*) comLogger.fileName, (char*) fileName);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileClosed_SIZE(1);
+    ASSERT_EVENTS_FileClosed(0, (char*) fileName);
+
+    fsStat = Os::FileSystem::getFileSize((char*) fileName, fileSize);
+    ASSERT_EQ(fsStat, Os::FileSystem::OP_OK);
+    ASSERT_EQ(fileSize, static_cast<U64>(ARCHIVE_BYTES_PER_FILE));
+    ASSERT_EQ(Os::ValidateFile::VALIDATION_OK,
+      Os::ValidateFile::validate((char*) fileName, (char*) hashFileName));
+
+    // The closed file has an index to seek by time:
+    ComArchive::Reader reader;
+    ComArchive::Record record;
+    ASSERT_EQ(reader.open((char*) fileName), Os::File::OP_OK);
+    ASSERT_TRUE(reader.isIndexed());
+    ASSERT_EQ(reader.getBlockCount(), static_cast<U32>(ARCHIVE_BLOCKS));
+    ASSERT_EQ(reader.getPacketCount(), records);
+
+    ASSERT_TRUE(reader.seekTime(Fw::Time(TB_NONE, 100 + recordsPerBlock + 2, 1)));
+    for(U32 i = recordsPerBlock + 3; i < records; i++)
+    {
+      ASSERT_TRUE(reader.next(record));
+      ASSERT_EQ(record.time, Fw::Time(TB_NONE, 100 + i, 0));
+      ASSERT_EQ(record.size, COM_BUFFER_LENGTH);
+      ASSERT_EQ(record.data[0], static_cast<U8>(i));
+      ASSERT_EQ(memcmp(&record.data[1], &data[1], COM_BUFFER_LENGTH - 1), 0);
+    }
+    ASSERT_FALSE(reader.next(record));
+    ASSERT_FALSE(reader.seekTime(Fw::Time(TB_NONE, 100 + records, 0)));
+
+    // Seeking before the first packet starts at the beginning:
+    ASSERT_TRUE(reader.seekTime(Fw::Time(TB_NONE, 0, 0)));
+    ASSERT_TRUE(reader.next(record));
+    ASSERT_EQ(record.time, Fw::Time(TB_NONE, 100, 0));
+    reader.close();
+  }
+
   void Tester ::
     from_pingOut_handler(
         const NATIVE_INT_TYPE portNum,
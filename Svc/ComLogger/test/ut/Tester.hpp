@@ -16,6 +16,9 @@
 #define COM_BUFFER_LENGTH 4
 #define MAX_BYTES_PER_FILE (MAX_ENTRIES_PER_FILE*COM_BUFFER_LENGTH + MAX_ENTRIES_PER_FILE*sizeof(U16))
 #define MAX_BYTES_PER_FILE_NO_LENGTH (MAX_ENTRIES_PER_FILE*COM_BUFFER_LENGTH)
+#define ARCHIVE_BLOCK_SIZE 256
+#define ARCHIVE_BLOCKS 2
+#define ARCHIVE_BYTES_PER_FILE (ARCHIVE_BLOCKS*(ARCHIVE_BLOCK_SIZE + Svc::ComArchive::INDEX_ENTRY_SIZE) + Svc::ComArchive::TRAILER_SIZE)
 
 namespace Svc {
   class Tester :
@@ -23,14 +26,16 @@ namespace Svc {
   {
 
     public:
-      Tester(const char *const compName);
+      Tester(const char *const compName, U32 maxFileSize = MAX_BYTES_PER_FILE);
       ~Tester(void);
 
-      void testLogging(void);
+      void testLogging(bool async = false);
       void testLoggingNoLength(void);
       void openError(void);
       void writeError(void);
       void closeFileCommand(void);
+      void bufferedWrites(void);
+      void archiveFormat(void);
     private:
       void connectPorts(void);
       void initComponents(void);
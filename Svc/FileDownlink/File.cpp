@@ -14,6 +14,7 @@
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Types/BasicTypes.hpp>
 #include <Os/FileSystem.hpp>
+#include <string.h>
 
 namespace Svc {
 
@@ -44,6 +45,10 @@ namespace Svc {
     CFDP::Checksum checksum;
     this->checksum = checksum;
 
+    // Empty the read ahead
+    this->aheadOffset = 0;
+    this->aheadSize = 0;
+
     // Open osFile for reading
     return this->osFile.open(sourceFileName, Os::File::OPEN_READ);
 
@@ -57,16 +62,33 @@ namespace Svc {
     )
   {
 
-    Os::File::Status status;
-    status = this->osFile.seek(byteOffset);
-    if (status != Os::File::OP_OK)
-      return status;
+    // Read ahead when the bytes are not already held and fit in it
+    const bool held = byteOffset >= this->aheadOffset &&
+      byteOffset - this->aheadOffset + size <= this->aheadSize;
+    if (not held) {
+      const bool useAhead = size <= sizeof(this->readAhead);
+      this->aheadSize = 0;
+
+      Os::File::Status status;
+      status = this->osFile.seek(byteOffset);
+      if (status != Os::File::OP_OK)
+        return status;
+
+      NATIVE_INT_TYPE intSize = useAhead ? sizeof(this->readAhead) : size;
+      status = this->osFile.read(useAhead ? this->readAhead : data, intSize);
+      if (status != Os::File::OP_OK)
+        return status;
+      // The read ahead may stop at the end of the file, but not before these bytes
+      FW_ASSERT(static_cast<U32>(intSize) >= size, intSize, size);
 
-    NATIVE_INT_TYPE intSize = size;
-    status = this->osFile.read(data, intSize);
-    if (status != Os::File::OP_OK)
-      return status;
-    FW_ASSERT(static_cast<U32>(intSize) == size);
+      if (useAhead) {
+        this->aheadOffset = byteOffset;
+        this->aheadSize = intSize;
+      }
+    }
+    if (this->aheadSize > 0) {
+      ::memcpy(data, &this->readAhead[byteOffset - this->aheadOffset], size);
+    }
 
     this->checksum.update(data, byteOffset, size);
 
@@ -27,6 +27,10 @@ namespace Svc {
     ) :
       FileDownlinkComponentBase(name),
       configured(false),
+      outstanding(0),
+      windowSize(1),
+      packetsPerRun(FILEDOWNLINK_PACKETS_BY_RUN ? 1 : 0),
+      credits(0),
       filesSent(this),
       packetsSent(this),
       warnings(this),
@@ -40,6 +44,10 @@ namespace Svc {
       curEntry(),
       cntxId(0)
   {
+    for (U32 i = 0; i < BUFFER_COUNT; i++) {
+      this->bufferBusy[i] = false;
+      this->bufferContext[i] = 0;
+    }
   }
 
   void FileDownlink ::
@@ -72,6 +80,18 @@ namespace Svc {
     FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
   }
 
+  void FileDownlink ::
+    setWindow(
+        const U32 windowSize,
+        const U32 packetsPerRun
+    )
+  {
+    FW_ASSERT(windowSize > 0 && windowSize <= FILEDOWNLINK_MAX_WINDOW, windowSize);
+    FW_ASSERT(this->mode.get() == Mode::IDLE, this->mode.get());
+    this->windowSize = windowSize;
+    this->packetsPerRun = packetsPerRun;
+  }
+
   void FileDownlink ::
     start(
       NATIVE_INT_TYPE identifier,
@@ -100,6 +120,8 @@ namespace Svc {
         NATIVE_UINT_TYPE context
     )
   {
+    this->credits = this->packetsPerRun;
+
     switch(this->mode.get())
     {
       case Mode::IDLE: {
@@ -134,7 +156,22 @@ namespace Svc {
         }
         break;
       }
+      case Mode::CANCEL: {
+        //With nothing in flight no buffer return will send the cancel packet, so send it here
+        if (this->outstanding == 0 && this->packetPending()) {
+          this->downlinkPackets();
+        }
+        break;
+      }
       case Mode::WAIT: {
+        //A paced downlink sends the packets held back for want of credits
+        if (this->packetsPerRun > 0 && this->packetPending()) {
+          this->mode.set(Mode::DOWNLINK);
+          this->downlinkPackets();
+          if (this->mode.get() != Mode::WAIT) {
+            break;
+          }
+        }
         //If current timeout is too-high and we are waiting for a packet, issue a timeout
         if (this->curTimer >= this->timeout) {
           this->curTimer = 0;
@@ -200,17 +237,20 @@ namespace Svc {
     )
   {
 	  //If this is a stale buffer (old, timed-out, or both), then ignore its return.
-	  //File downlink actions only respond to the return of the most-recently-sent buffer.
-	  if (this->lastBufferId != fwBuffer.getContext() + 1 ||
-	      this->mode.get() == Mode::IDLE) {
+	  //File downlink actions only respond to the return of buffers sent for the current file.
+	  if (this->mode.get() == Mode::IDLE ||
+	      not this->releaseBuffer(fwBuffer)) {
 		  return;
 	  }
 	  //Non-ignored buffers cannot be returned in "DOWNLINK" and "IDLE" state.  Only in "WAIT", "CANCEL" state.
 	  FW_ASSERT(this->mode.get() == Mode::WAIT || this->mode.get() == Mode::CANCEL, this->mode.get());
-      //If the last packet has been sent (and is returning now) then finish the file
+	  this->curTimer = 0;
+      //If the last packet has been sent (and all packets have returned) then finish the file
 	  if (this->lastCompletedType == Fw::FilePacket::T_END ||
           this->lastCompletedType == Fw::FilePacket::T_CANCEL) {
-          finishHelper(this->lastCompletedType == Fw::FilePacket::T_CANCEL);
+          if (this->outstanding == 0) {
+              finishHelper(this->lastCompletedType == Fw::FilePacket::T_CANCEL);
+          }
           return;
       }
       //If waiting and a buffer is in-bound, then switch to downlink mode
@@ -218,7 +258,7 @@ namespace Svc {
           this->mode.set(Mode::DOWNLINK);
       }
 
-      this->downlinkPacket();
+      this->downlinkPackets();
   }
 
   // ----------------------------------------------------------------------
@@ -379,15 +419,6 @@ namespace Svc {
         length = this->file.size - startOffset;
     }
 
-    // Send file and switch to WAIT mode
-    this->getBuffer(this->buffer, FILE_PACKET);
-    this->sendStartPacket();
-    this->mode.set(Mode::WAIT);
-    this->sequenceIndex = 1;
-    this->curTimer = 0;
-    this->byteOffset = startOffset;
-    this->lastCompletedType = Fw::FilePacket::T_START;
-
     // zero length means read until end of file
     if (length > 0) {
         this->log_ACTIVITY_HI_SendStarted(length, this->file.sourceName, this->file.destName);
@@ -397,6 +428,15 @@ namespace Svc {
         this->log_ACTIVITY_HI_SendStarted(this->file.size - startOffset, this->file.sourceName, this->file.destName);
         this->endOffset = this->file.size;
     }
+
+    // Send file, fill the rest of the window and switch to WAIT mode
+    this->sendStartPacket();
+    this->sequenceIndex = 1;
+    this->byteOffset = startOffset;
+    this->lastCompletedType = Fw::FilePacket::T_START;
+    this->mode.set(Mode::DOWNLINK);
+    this->downlinkPackets();
+    this->curTimer = 0;
   }
 
   Os::File::Status FileDownlink ::
@@ -490,17 +530,19 @@ namespace Svc {
   void FileDownlink ::
     sendFilePacket(const Fw::FilePacket& filePacket)
   {
+    Fw::Buffer buffer;
+    this->getBuffer(buffer, FILE_PACKET);
     const U32 bufferSize = filePacket.bufferSize();
-    FW_ASSERT(this->buffer.getData() != 0);
-    FW_ASSERT(this->buffer.getSize() >= bufferSize, bufferSize, this->buffer.getSize());
-    const Fw::SerializeStatus status = filePacket.toBuffer(this->buffer);
+    FW_ASSERT(buffer.getSize() >= bufferSize, bufferSize, buffer.getSize());
+    const Fw::SerializeStatus status = filePacket.toBuffer(buffer);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK);
     // set the buffer size to the packet size
-    this->buffer.setSize(bufferSize);
-    this->bufferSendOut_out(0, this->buffer);
-    // restore buffer size to max
-    this->buffer.setSize(FILEDOWNLINK_INTERNAL_BUFFER_SIZE);
+    buffer.setSize(bufferSize);
+    this->bufferSendOut_out(0, buffer);
     this->packetsSent.packetSent();
+    if (this->credits > 0) {
+      --this->credits;
+    }
   }
 
   void FileDownlink ::
@@ -510,37 +552,69 @@ namespace Svc {
     this->mode.set(Mode::COOLDOWN);
     this->lastCompletedType = Fw::FilePacket::T_NONE;
     this->curTimer = 0;
+    // Buffers still in flight are stale from here on
+    for (U32 i = 0; i < BUFFER_COUNT; i++) {
+      this->bufferBusy[i] = false;
+    }
+    this->outstanding = 0;
+  }
+
+  bool FileDownlink ::
+    windowOpen(void) const
+  {
+      //Window buffers are taken by the start, data and end packets
+      const U32 inFlight = this->outstanding - (this->bufferBusy[CANCEL_BUFFER] ? 1 : 0);
+      return inFlight < this->windowSize && (this->packetsPerRun == 0 || this->credits > 0);
+  }
+
+  bool FileDownlink ::
+    packetPending(void)
+  {
+      //A cancel packet goes out regardless of the window
+      if (this->mode.get() == Mode::CANCEL && this->lastCompletedType == Fw::FilePacket::T_START) {
+          return true;
+      }
+      return this->windowOpen() &&
+          (this->lastCompletedType == Fw::FilePacket::T_START ||
+           this->lastCompletedType == Fw::FilePacket::T_DATA);
   }
 
   void FileDownlink ::
-    downlinkPacket()
+    downlinkPackets()
   {
       FW_ASSERT(this->lastCompletedType != Fw::FilePacket::T_NONE, this->lastCompletedType);
       FW_ASSERT(this->mode.get() == Mode::CANCEL || this->mode.get() == Mode::DOWNLINK, this->mode.get());
-      //If canceled mode and currently downlinking data then send a cancel packet
-      if (this->mode.get() == Mode::CANCEL && this->lastCompletedType == Fw::FilePacket::T_START) {
-          this->sendCancelPacket();
-          this->lastCompletedType = Fw::FilePacket::T_CANCEL;
-      }
-      //If in downlink mode and currently downlinking data then continue with the next packer
-      else if (this->mode.get() == Mode::DOWNLINK && this->lastCompletedType == Fw::FilePacket::T_START) {
-          //Send the next packet, or fail doing so
-          const Os::File::Status status = this->sendDataPacket(this->byteOffset);
-          if (status != Os::File::OP_OK) {
-              this->log_WARNING_HI_SendDataFail(this->file.sourceName, this->byteOffset);
-              this->enterCooldown();
-              sendResponse(SendFileStatus::ERROR);
-              //Don't go to wait state
-              return;
+      bool sent = false;
+      while (this->packetPending()) {
+          //If canceled mode and currently downlinking data then send a cancel packet
+          if (this->mode.get() == Mode::CANCEL && this->lastCompletedType == Fw::FilePacket::T_START) {
+              this->sendCancelPacket();
+              this->lastCompletedType = Fw::FilePacket::T_CANCEL;
           }
-      }
-      //If in downlink mode or cancel and finished downlinking data then send the last packet
-      else if (this->lastCompletedType == Fw::FilePacket::T_DATA) {
-          this->sendEndPacket();
-          this->lastCompletedType = Fw::FilePacket::T_END;
+          //If in downlink mode and currently downlinking data then continue with the next packet
+          else if (this->mode.get() == Mode::DOWNLINK && this->lastCompletedType == Fw::FilePacket::T_START) {
+              //Send the next packet, or fail doing so
+              const Os::File::Status status = this->sendDataPacket(this->byteOffset);
+              if (status != Os::File::OP_OK) {
+                  this->log_WARNING_HI_SendDataFail(this->file.sourceName, this->byteOffset);
+                  this->enterCooldown();
+                  sendResponse(SendFileStatus::ERROR);
+                  //Don't go to wait state
+                  return;
+              }
+          }
+          //If in downlink mode or cancel and finished downlinking data then send the last packet
+          else {
+              FW_ASSERT(this->lastCompletedType == Fw::FilePacket::T_DATA, this->lastCompletedType);
+              this->sendEndPacket();
+              this->lastCompletedType = Fw::FilePacket::T_END;
+          }
+          sent = true;
       }
       this->mode.set(Mode::WAIT);
-      this->curTimer = 0;
+      if (sent) {
+          this->curTimer = 0;
+      }
   }
 
   void FileDownlink ::
@@ -560,13 +634,43 @@ namespace Svc {
   void FileDownlink ::
     getBuffer(Fw::Buffer& buffer, PacketType type)
   {
-      //Check type is correct
-      FW_ASSERT(type < COUNT_PACKET_TYPE && type >= 0, type);
+      //Check type is correct and pick a free buffer for it
+      U32 index = CANCEL_BUFFER;
+      if (type == FILE_PACKET) {
+          for (index = 0; index < this->windowSize; index++) {
+              if (not this->bufferBusy[index]) {
+                  break;
+              }
+          }
+          FW_ASSERT(index < this->windowSize, index);
+      } else {
+          FW_ASSERT(type == CANCEL_PACKET, type);
+      }
+      FW_ASSERT(not this->bufferBusy[index], index);
       // Wrap the buffer around our indexed memory.
-      buffer.setData(this->memoryStore[type]);
+      buffer.setData(this->memoryStore[index]);
       buffer.setSize(FILEDOWNLINK_INTERNAL_BUFFER_SIZE);
       //Set a known ID to look for later
       buffer.setContext(lastBufferId);
+      this->bufferBusy[index] = true;
+      this->bufferContext[index] = lastBufferId;
+      this->outstanding++;
       lastBufferId++;
   }
+
+  bool FileDownlink ::
+    releaseBuffer(const Fw::Buffer& buffer)
+  {
+      for (U32 index = 0; index < BUFFER_COUNT; index++) {
+          if (this->bufferBusy[index] &&
+              this->bufferContext[index] == buffer.getContext() &&
+              this->memoryStore[index] == buffer.getData()) {
+              this->bufferBusy[index] = false;
+              FW_ASSERT(this->outstanding > 0);
+              this->outstanding--;
+              return true;
+          }
+      }
+      return false;
+  }
 } // end namespace Svc
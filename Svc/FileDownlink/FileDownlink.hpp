@@ -77,7 +77,7 @@ namespace Svc {
         public:
 
           //! Constructor
-          File() : size(0) { }
+          File() : size(0), aheadOffset(0), aheadSize(0) { }
 
         public:
 
@@ -98,6 +98,15 @@ namespace Svc {
           //! The checksum for the file
           CFDP::Checksum checksum;
 
+          //! Bytes read ahead of the data packets
+          U8 readAhead[FILEDOWNLINK_READ_AHEAD_SIZE];
+
+          //! The file offset of the read ahead
+          U32 aheadOffset;
+
+          //! The number of bytes held in the read ahead
+          U32 aheadSize;
+
         public:
 
           //! Open the OS file for reading and initialize the checksum
@@ -106,7 +115,7 @@ namespace Svc {
               const char *const destFileName //!< The destination file name
           );
 
-          //! Read bytes from the OS file and update the checksum
+          //! Read bytes from the OS file, through the read ahead, and update the checksum
           Os::File::Status read(
               U8 *const data,
               const U32 byteOffset,
@@ -229,11 +238,16 @@ namespace Svc {
       };
 
       //! Enumeration for packet types
-      //! Each type has a buffer to store it.
+      //! Each in flight file packet has a window buffer to store it;
+      //! the cancel packet has its own.
       enum PacketType {
           FILE_PACKET,
-          CANCEL_PACKET,
-          COUNT_PACKET_TYPE
+          CANCEL_PACKET
+      };
+
+      enum {
+          CANCEL_BUFFER = FILEDOWNLINK_MAX_WINDOW, //!< Index of the cancel packet buffer
+          BUFFER_COUNT //!< Number of internal buffers
       };
 
     public:
@@ -264,6 +278,18 @@ namespace Svc {
           U32 fileQueueDepth //! Max number of items in file downlink queue
       );
 
+      //! Set the number of file packets that may be in flight and how fast
+      //! they are sent. Data packets are sent as long as fewer than
+      //! windowSize buffers are waiting to be returned; with packetsPerRun
+      //! set, no more than that many are sent per call to Run. The default,
+      //! a window of one and no pacing, waits for each buffer before sending
+      //! the next packet. Call before start.
+      //!
+      void setWindow(
+          const U32 windowSize, //!< Buffers in flight, 1 to FILEDOWNLINK_MAX_WINDOW
+          const U32 packetsPerRun //!< Packets sent per Run, or 0 for no limit
+      );
+
       //! Start FileDownlink component
       //! The component must be configured with configure() before starting.
       //!
@@ -379,8 +405,14 @@ namespace Svc {
 
       //Function to acquire a buffer internally
       void getBuffer(Fw::Buffer& buffer, PacketType type);
-      //Downlink the "next" packet
-      void downlinkPacket();
+      //Release a returned buffer, false if it is not in flight
+      bool releaseBuffer(const Fw::Buffer& buffer);
+      //Whether the window and pacing allow another file packet
+      bool windowOpen(void) const;
+      //Whether downlinkPackets would send a packet now
+      bool packetPending(void);
+      //Downlink the "next" packets, as many as the window allows
+      void downlinkPackets();
       //Finish the file transfer
       void finishHelper(bool is_cancel);
       // Convert internal status enum to a command response;
@@ -401,7 +433,25 @@ namespace Svc {
       Os::Queue fileQueue;
 
       //!Buffer's memory backing
-      U8 memoryStore[COUNT_PACKET_TYPE][FILEDOWNLINK_INTERNAL_BUFFER_SIZE];
+      U8 memoryStore[BUFFER_COUNT][FILEDOWNLINK_INTERNAL_BUFFER_SIZE];
+
+      //! Whether each buffer is in flight
+      bool bufferBusy[BUFFER_COUNT];
+
+      //! Context of each buffer in flight
+      U32 bufferContext[BUFFER_COUNT];
+
+      //! Number of buffers in flight
+      U32 outstanding;
+
+      //! Number of file packet buffers that may be in flight
+      U32 windowSize;
+
+      //! Packets sent per Run, or 0 for no limit
+      U32 packetsPerRun;
+
+      //! Packets left to send in this Run
+      U32 credits;
 
       //! The mode
       Mode mode;
@@ -433,9 +483,6 @@ namespace Svc {
       //! rate (milliseconds) at which we are running
       U32 cycleTime;
 
-      ////! Buffer for sending file data
-      Fw::Buffer buffer;
-
       //! Buffer size for file data
       U32 bufferSize;
 
@@ -448,7 +495,7 @@ namespace Svc {
       //! Set to true when all data packets have been sent
       Fw::FilePacket::Type lastCompletedType;
 
-      //! Last buffer used
+      //! Context of the next buffer
       U32 lastBufferId;
 
       //! Current in progress file entry from queue
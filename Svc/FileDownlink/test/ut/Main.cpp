@@ -39,6 +39,16 @@ TEST(FileDownlink, SendFilePort) {
     tester.sendFilePort();
 }
 
+TEST(FileDownlink, DownlinkWindow) {
+    Svc::Tester tester;
+    tester.downlinkWindow();
+}
+
+TEST(FileDownlink, DownlinkPaced) {
+    Svc::Tester tester;
+    tester.downlinkPaced();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
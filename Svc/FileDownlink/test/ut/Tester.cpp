@@ -380,6 +380,139 @@ namespace Svc {
     this->removeFile(sourceFileName);
   }
 
+  void Tester ::
+    downlinkWindow(void)
+  {
+    // Create a file of three data packets
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[3 * (FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE)];
+    for (U32 i = 0; i < sizeof(data); i++) {
+      data[i] = static_cast<U8>(i);
+    }
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    this->component.setWindow(4, 0);
+
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_SendFile(
+        INSTANCE,
+        CMD_SEQ,
+        sourceCmdStringArg,
+        destCmdStringArg
+    );
+    this->component.doDispatch(); // Dispatch sendfile command
+    this->component.Run_handler(0,0); // Pull file from queue
+
+    // Start and data packets fill the window before any buffer returns
+    ASSERT_from_bufferSendOut_SIZE(4);
+    ASSERT_EQ(FileDownlink::Mode::WAIT, this->component.mode.get());
+
+    // The first return sends the end packet, the rest finish the file
+    while (this->component.mode.get() != FileDownlink::Mode::IDLE) {
+      if(this->component.mode.get() != FileDownlink::Mode::COOLDOWN) {
+        this->component.doDispatch();
+      }
+      this->component.Run_handler(0,0);
+    }
+
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILE, CMD_SEQ, Fw::COMMAND_OK);
+    ASSERT_TLM_FilesSent_SIZE(1);
+    ASSERT_EVENTS_FileSent_SIZE(1);
+
+    // Validate the packet history
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        5,
+        checksum,
+        0
+    );
+
+    // Compare the outgoing and incoming files
+    FileBuffer fileBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+    this->removeFile(sourceFileName);
+  }
+
+  void Tester ::
+    downlinkPaced(void)
+  {
+    // Create a file of three data packets
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[3 * (FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE)];
+    for (U32 i = 0; i < sizeof(data); i++) {
+      data[i] = static_cast<U8>(3 * i);
+    }
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    this->component.setWindow(4, 2);
+
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_SendFile(
+        INSTANCE,
+        CMD_SEQ,
+        sourceCmdStringArg,
+        destCmdStringArg
+    );
+    this->component.doDispatch(); // Dispatch sendfile command
+
+    // Two packets per Run: start and data, then the other two data packets
+    this->component.Run_handler(0,0);
+    ASSERT_from_bufferSendOut_SIZE(2);
+    this->component.Run_handler(0,0);
+    ASSERT_from_bufferSendOut_SIZE(4);
+
+    // Returns open the window, but the end packet waits for the next Run
+    for (U32 i = 0; i < 4; i++) {
+      this->component.doDispatch();
+    }
+    ASSERT_from_bufferSendOut_SIZE(4);
+    this->component.Run_handler(0,0);
+    ASSERT_from_bufferSendOut_SIZE(5);
+
+    while (this->component.mode.get() != FileDownlink::Mode::IDLE) {
+      if(this->component.mode.get() != FileDownlink::Mode::COOLDOWN) {
+        this->component.doDispatch();
+      }
+      this->component.Run_handler(0,0);
+    }
+
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILE, CMD_SEQ, Fw::COMMAND_OK);
+    ASSERT_EVENTS_DownlinkTimeout_SIZE(0);
+
+    // Validate the packet history
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        5,
+        checksum,
+        0
+    );
+
+    // Compare the outgoing and incoming files
+    FileBuffer fileBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+    this->removeFile(sourceFileName);
+  }
+
   // ----------------------------------------------------------------------
   // Handlers for from ports
   // ----------------------------------------------------------------------
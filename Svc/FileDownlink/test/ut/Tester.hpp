@@ -18,7 +18,7 @@
 #include "GTestBase.hpp"
 
 #define MAX_HISTORY_SIZE 10
-#define FILE_BUFFER_CAPACITY 100
+#define FILE_BUFFER_CAPACITY 1000
 
 namespace Svc {
 
@@ -135,6 +135,15 @@ namespace Svc {
       //!
       void sendFilePort(void);
 
+      //! Downlink a file of several data packets with a window of buffers
+      //! Verify that the window fills before any buffer returns
+      //!
+      void downlinkWindow(void);
+
+      //! Downlink a file with a window and a limit of packets per Run
+      //!
+      void downlinkPaced(void);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -57,4 +57,29 @@ namespace Svc {
 
   }
 
+  Os::File::Status FileUplink::File ::
+    writeAt(
+        const U8 *const data,
+        const U32 byteOffset,
+        const U32 length
+    )
+  {
+
+    U32 written = 0;
+    while (written < length) {
+      NATIVE_INT_TYPE intLength = length - written;
+      const Os::File::Status status =
+        this->osFile.writeAt(&data[written], intLength, byteOffset + written);
+      if (status != Os::File::OP_OK) {
+        return status;
+      }
+      if (intLength == 0) {
+        return Os::File::OTHER_ERROR;
+      }
+      written += intLength;
+    }
+    return Os::File::OP_OK;
+
+  }
+
 }
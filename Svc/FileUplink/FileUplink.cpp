@@ -13,6 +13,7 @@
 #include <Svc/FileUplink/FileUplink.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Types/BasicTypes.hpp>
+#include <string.h>
 
 namespace Svc {
 
@@ -25,11 +26,15 @@ namespace Svc {
       FileUplinkComponentBase(name),
       receiveMode(START),
       lastSequenceIndex(0),
+      reassembly(false),
+      activity(0),
       filesReceived(this),
       packetsReceived(this),
       warnings(this)
   {
-
+    for (U32 i = 0; i < NUM_BUFFERSENDIN_INPUT_PORTS; ++i) {
+      this->portTransfer[i] = FILEUPLINK_MAX_TRANSFERS;
+    }
   }
 
   void FileUplink ::
@@ -41,10 +46,20 @@ namespace Svc {
     FileUplinkComponentBase::init(queueDepth, instance);
   }
 
+  void FileUplink ::
+    setReassembly(const bool reassembly)
+  {
+    this->reassembly = reassembly;
+  }
+
   FileUplink ::
     ~FileUplink(void)
   {
-
+    for (U32 i = 0; i < FILEUPLINK_MAX_TRANSFERS; ++i) {
+      if (this->transfers[i].active) {
+        (void) this->transfers[i].close();
+      }
+    }
   }
 
   // ----------------------------------------------------------------------
@@ -61,6 +76,25 @@ namespace Svc {
     const Fw::SerializeStatus status = filePacket.fromBuffer(buffer);
     if (status != Fw::FW_SERIALIZE_OK) {
         this->log_WARNING_HI_DecodeError(status);
+    } else if (this->reassembly) {
+        const Fw::FilePacket::Header& header = filePacket.asHeader();
+        switch (header.type) {
+          case Fw::FilePacket::T_START:
+            this->reassembleStartPacket(portNum, filePacket.asStartPacket());
+            break;
+          case Fw::FilePacket::T_DATA:
+            this->reassembleDataPacket(portNum, filePacket.asDataPacket());
+            break;
+          case Fw::FilePacket::T_END:
+            this->reassembleEndPacket(portNum, filePacket.asEndPacket());
+            break;
+          case Fw::FilePacket::T_CANCEL:
+            this->reassembleCancelPacket(portNum);
+            break;
+          default:
+            FW_ASSERT(0);
+            break;
+        }
     } else {
         const Fw::FilePacket::Header& header = filePacket.asHeader();
         switch (header.type) {
@@ -81,7 +115,7 @@ namespace Svc {
             break;
         }
     }
-    this->bufferSendOut_out(0, buffer);
+    this->bufferSendOut_out(portNum, buffer);
   }
 
   void FileUplink ::
@@ -133,7 +167,8 @@ namespace Svc {
     this->checkSequenceIndex(sequenceIndex);
     const U32 byteOffset = dataPacket.byteOffset;
     const U32 dataSize = dataPacket.dataSize;
-    if (byteOffset + dataSize > this->file.size) {
+    // Checked without adding, so that an offset near the top of the range cannot wrap
+    if (byteOffset > this->file.size || dataSize > this->file.size - byteOffset) {
       this->warnings.packetOutOfBounds(sequenceIndex, this->file.name);
       return;
     }
@@ -154,7 +189,7 @@ namespace Svc {
     if (this->receiveMode == DATA) {
       this->filesReceived.fileReceived();
       this->checkSequenceIndex(endPacket.header.sequenceIndex);
-      this->compareChecksums(endPacket);
+      this->compareChecksums(this->file, endPacket);
       this->log_ACTIVITY_HI_FileReceived(this->file.name);
     }
     else {
@@ -184,19 +219,202 @@ namespace Svc {
   }
 
   void FileUplink ::
-    compareChecksums(const Fw::FilePacket::EndPacket& endPacket)
+    compareChecksums(
+        File& file,
+        const Fw::FilePacket::EndPacket& endPacket
+    )
   {
     CFDP::Checksum computed, stored;
-    this->file.getChecksum(computed);
+    file.getChecksum(computed);
     endPacket.getChecksum(stored);
     if (computed != stored) {
       this->warnings.badChecksum(
+          file.name,
           computed.getValue(), 
           stored.getValue()
       );
     }
   }
 
+  void FileUplink ::
+    reassembleStartPacket(
+        const NATIVE_INT_TYPE portNum,
+        const Fw::FilePacket::StartPacket& startPacket
+    )
+  {
+    // Clear all event throttles in preparation for new start packet
+    this->log_WARNING_HI_FileWriteError_ThrottleClear();
+    this->log_WARNING_HI_InvalidReceiveMode_ThrottleClear();
+    this->log_WARNING_HI_PacketOutOfBounds_ThrottleClear();
+    this->packetsReceived.packetReceived();
+    this->portTransfer[portNum] = FILEUPLINK_MAX_TRANSFERS;
+
+    const U32 index = this->findTransfer(startPacket);
+    Transfer& transfer = this->transfers[index];
+    if (transfer.active) {
+      // Same source: carry on with the data received so far, unless the file changed
+      const U32 length = startPacket.destinationPath.length;
+      char path[length + 1];
+      memcpy(path, startPacket.destinationPath.value, length);
+      path[length] = 0;
+      const Fw::LogStringArg destName(path);
+      if (not transfer.failed &&
+          startPacket.fileSize == transfer.file.size &&
+          destName == transfer.file.name) {
+        transfer.lastActive = ++this->activity;
+        this->portTransfer[portNum] = index;
+        this->log_ACTIVITY_LO_FileResumed(transfer.file.name, transfer.received.getReceived());
+        return;
+      }
+      this->closeTransfer(index);
+    }
+
+    const Os::File::Status status = transfer.open(startPacket);
+    if (status != Os::File::OP_OK) {
+      this->warnings.fileOpen(transfer.file.name);
+      return;
+    }
+    transfer.lastActive = ++this->activity;
+    this->portTransfer[portNum] = index;
+  }
+
+  void FileUplink ::
+    reassembleDataPacket(
+        const NATIVE_INT_TYPE portNum,
+        const Fw::FilePacket::DataPacket& dataPacket
+    )
+  {
+    this->packetsReceived.packetReceived();
+    const U32 index = this->portTransfer[portNum];
+    if (index == FILEUPLINK_MAX_TRANSFERS) {
+      this->warnings.invalidReceiveMode(Fw::FilePacket::T_DATA);
+      return;
+    }
+    Transfer& transfer = this->transfers[index];
+    transfer.lastActive = ++this->activity;
+    const U32 byteOffset = dataPacket.byteOffset;
+    const U32 dataSize = dataPacket.dataSize;
+    // Checked without adding, so that an offset near the top of the range cannot wrap
+    if (byteOffset > transfer.file.size || dataSize > transfer.file.size - byteOffset) {
+      this->warnings.packetOutOfBounds(dataPacket.header.sequenceIndex, transfer.file.name);
+      return;
+    }
+    const Os::File::Status status = transfer.write(
+        dataPacket.data,
+        byteOffset,
+        dataSize
+    );
+    if (status != Os::File::OP_OK) {
+      this->warnings.fileWrite(transfer.file.name);
+    }
+  }
+
+  void FileUplink ::
+    reassembleEndPacket(
+        const NATIVE_INT_TYPE portNum,
+        const Fw::FilePacket::EndPacket& endPacket
+    )
+  {
+    this->packetsReceived.packetReceived();
+    const U32 index = this->portTransfer[portNum];
+    if (index == FILEUPLINK_MAX_TRANSFERS) {
+      this->warnings.invalidReceiveMode(Fw::FilePacket::T_END);
+      return;
+    }
+    Transfer& transfer = this->transfers[index];
+    transfer.lastActive = ++this->activity;
+    if (transfer.flush() != Os::File::OP_OK) {
+      this->warnings.fileWrite(transfer.file.name);
+    }
+    // The file lacks data counted as received, so it cannot be complete
+    if (transfer.failed) {
+      this->closeTransfer(index);
+      return;
+    }
+    // Keep the file open for the missing data
+    if (transfer.received.getReceived() < transfer.file.size) {
+      this->reportMissing(transfer);
+      return;
+    }
+    this->filesReceived.fileReceived();
+    this->compareChecksums(transfer.file, endPacket);
+    this->log_ACTIVITY_HI_FileReceived(transfer.file.name);
+    this->closeTransfer(index);
+  }
+
+  void FileUplink ::
+    reassembleCancelPacket(const NATIVE_INT_TYPE portNum)
+  {
+    this->packetsReceived.packetReceived();
+    this->log_ACTIVITY_HI_UplinkCanceled();
+    const U32 index = this->portTransfer[portNum];
+    if (index != FILEUPLINK_MAX_TRANSFERS) {
+      this->closeTransfer(index);
+    }
+  }
+
+  U32 FileUplink ::
+    findTransfer(const Fw::FilePacket::StartPacket& startPacket)
+  {
+    U32 free = FILEUPLINK_MAX_TRANSFERS;
+    U32 oldest = 0;
+    for (U32 i = 0; i < FILEUPLINK_MAX_TRANSFERS; ++i) {
+      const Transfer& transfer = this->transfers[i];
+      if (transfer.hasSource(startPacket)) {
+        return i;
+      }
+      if (not transfer.active) {
+        free = (free == FILEUPLINK_MAX_TRANSFERS) ? i : free;
+      } else if (transfer.lastActive - this->transfers[oldest].lastActive >= 0x80000000) {
+        // Wrapping compare: transfer i was active before transfer oldest
+        oldest = i;
+      }
+    }
+    if (free != FILEUPLINK_MAX_TRANSFERS) {
+      return free;
+    }
+    this->log_WARNING_HI_TransferDropped(this->transfers[oldest].file.name);
+    this->closeTransfer(oldest);
+    return oldest;
+  }
+
+  void FileUplink ::
+    closeTransfer(const U32 index)
+  {
+    FW_ASSERT(index < FILEUPLINK_MAX_TRANSFERS, index);
+    if (this->transfers[index].close() != Os::File::OP_OK) {
+      this->warnings.fileWrite(this->transfers[index].file.name);
+    }
+    for (U32 i = 0; i < NUM_BUFFERSENDIN_INPUT_PORTS; ++i) {
+      if (this->portTransfer[i] == index) {
+        this->portTransfer[i] = FILEUPLINK_MAX_TRANSFERS;
+      }
+    }
+  }
+
+  void FileUplink ::
+    reportMissing(Transfer& transfer)
+  {
+    const U32 size = transfer.file.size;
+    U32 ranges = 0;
+    U32 gapStart = 0;
+    U32 gapEnd = 0;
+    while (transfer.received.nextGap(gapEnd, size, gapStart, gapEnd)) {
+      ++ranges;
+    }
+    this->log_WARNING_HI_FileIncomplete(
+        transfer.file.name,
+        size - transfer.received.getReceived(),
+        ranges
+    );
+    // Then the first ranges, for the sender to fill in
+    gapEnd = 0;
+    for (U32 i = 0; i < FILEUPLINK_MAX_REPORTED_RANGES &&
+        transfer.received.nextGap(gapEnd, size, gapStart, gapEnd); ++i) {
+      this->log_WARNING_LO_MissingRange(transfer.file.name, gapEnd - gapStart, gapStart);
+    }
+  }
+
   void FileUplink ::
     goToStartMode(void)
   {
@@ -13,6 +13,7 @@
 #ifndef Svc_FileUplink_HPP
 #define Svc_FileUplink_HPP
 
+#include <FileUplinkCfg.hpp>
 #include <Svc/FileUplink/FileUplinkComponentAc.hpp>
 #include <Fw/FilePacket/FilePacket.hpp>
 #include <Os/File.hpp>
@@ -65,6 +66,22 @@ namespace Svc {
               const U32 length
           );
 
+          //! Write bytes into the OS file at an offset, without updating the checksum
+          Os::File::Status writeAt(
+              const U8 *const data,
+              const U32 byteOffset,
+              const U32 length
+          );
+
+          //! Update the checksum with bytes of the file
+          void updateChecksum(
+              const U8 *const data,
+              const U32 byteOffset,
+              const U32 length
+          ) {
+            this->checksum.update(data, byteOffset, length);
+          }
+
           //! Get the checksum
           void getChecksum(::CFDP::Checksum& checksum) {
             checksum = this->checksum;
@@ -72,6 +89,151 @@ namespace Svc {
 
       };
 
+      //! The byte ranges received for a file being reassembled. The first
+      //! range always starts at byte 0, empty until byte 0 arrives, so that
+      //! a full map still takes data sent in order from the start of any
+      //! missing run.
+      class RangeMap {
+
+        public:
+
+          //! Construct an empty RangeMap
+          RangeMap(void) {
+            this->clear();
+          }
+
+        public:
+
+          //! Forget all ranges
+          void clear(void) {
+            this->starts[0] = 0;
+            this->ends[0] = 0;
+            this->count = 1;
+          }
+
+          //! Whether the map has room to record bytes start to end
+          bool fits(
+              const U32 start, //!< The first byte
+              const U32 end //!< One past the last byte
+          ) const;
+
+          //! Record bytes start to end as received
+          //! \return false, recording nothing, if the map has no room or end is before start
+          bool add(
+              const U32 start, //!< The first byte
+              const U32 end //!< One past the last byte
+          );
+
+          //! Find the first run of bytes not received between start and end
+          //! \return false if every byte from start to end was received
+          bool nextGap(
+              const U32 start, //!< The first byte
+              const U32 end, //!< One past the last byte
+              U32& gapStart, //!< The first byte of the run
+              U32& gapEnd //!< One past the last byte of the run
+          ) const;
+
+          //! The number of bytes received
+          U32 getReceived(void) const;
+
+        PRIVATE:
+
+          //! The first byte of each range, in order
+          U32 starts[FILEUPLINK_MAX_RANGES];
+
+          //! One past the last byte of each range
+          U32 ends[FILEUPLINK_MAX_RANGES];
+
+          //! The number of ranges
+          U32 count;
+
+      };
+
+      //! A file being reassembled from data packets that may arrive out of
+      //! order, more than once or not at all
+      class Transfer {
+
+        public:
+
+          //! Construct an inactive Transfer
+          Transfer(void) :
+            active(false), failed(false), lastActive(0), sourceLength(0),
+            bufferOffset(0), bufferSize(0)
+          { }
+
+        public:
+
+          //! Whether the transfer is in progress
+          bool active;
+
+          //! Whether a write failed, so that the file does not hold all
+          //! the data received
+          bool failed;
+
+          //! When a packet was last received for the transfer
+          U32 lastActive;
+
+          //! The file
+          File file;
+
+          //! The bytes received
+          RangeMap received;
+
+        PRIVATE:
+
+          //! The source path, which identifies the transfer
+          char sourcePath[Fw::FilePacket::PathName::MAX_LENGTH];
+
+          //! The length of the source path
+          U8 sourceLength;
+
+          //! Data waiting to be written
+          U8 writeBuffer[FILEUPLINK_WRITE_BUFFER_SIZE];
+
+          //! The file offset of the data waiting to be written
+          U32 bufferOffset;
+
+          //! The number of bytes waiting to be written
+          U32 bufferSize;
+
+          //! Record a range as received and add the bytes not received
+          //! before to the checksum
+          void record(
+              const U8 *const data,
+              const U32 byteOffset,
+              const U32 end
+          );
+
+        public:
+
+          //! Whether a start packet names this transfer's source path
+          bool hasSource(const Fw::FilePacket::StartPacket& startPacket) const;
+
+          //! Open the file named by a start packet and start the transfer
+          Os::File::Status open(const Fw::FilePacket::StartPacket& startPacket);
+
+          //! Take in a data packet: write it, then record its range and add
+          //! the bytes not received before to the checksum. Consecutive
+          //! packets are gathered and written together, and count as
+          //! received once gathered. A packet that does not fit in the range
+          //! map is dropped and stays missing. A range that runs past the
+          //! largest offset returns BAD_SIZE. A failed write marks the
+          //! transfer failed.
+          Os::File::Status write(
+              const U8 *const data,
+              const U32 byteOffset,
+              const U32 length
+          );
+
+          //! Write the data waiting to be written. A failed write marks the
+          //! transfer failed
+          Os::File::Status flush(void);
+
+          //! Flush and close the file and end the transfer
+          Os::File::Status close(void);
+
+      };
+
       //! Object to record files received
       class FilesReceived {
 
@@ -163,6 +325,7 @@ namespace Svc {
 
           //! Record a Bad Checksum warning
           void badChecksum(
+              Fw::LogStringArg& fileName,
               const U32 computed,
               const U32 read
           );
@@ -204,6 +367,18 @@ namespace Svc {
           const NATIVE_INT_TYPE instance //!< The instance number
       );
 
+      //! Reassemble files instead of writing packets as they come. Data
+      //! packets may then arrive in any order or more than once. An END
+      //! packet for a file with data missing reports the missing ranges and
+      //! leaves the file open, so that they can be sent again, after a START
+      //! packet for the same source path if other files were sent meanwhile.
+      //! Each bufferSendIn port has its own file in progress, and up to
+      //! FILEUPLINK_MAX_TRANSFERS files may be in progress in all.
+      //!
+      void setReassembly(
+          const bool reassembly //!< Whether to reassemble files
+      );
+
       //! Destroy object FileUplink
       //!
       ~FileUplink(void);
@@ -251,7 +426,41 @@ namespace Svc {
       void checkSequenceIndex(const U32 sequenceIndex);
 
       //! Compare checksums
-      void compareChecksums(const Fw::FilePacket::EndPacket& endPacket);
+      void compareChecksums(
+          File& file,
+          const Fw::FilePacket::EndPacket& endPacket
+      );
+
+      //! Handle a start packet when reassembling
+      void reassembleStartPacket(
+          const NATIVE_INT_TYPE portNum,
+          const Fw::FilePacket::StartPacket& startPacket
+      );
+
+      //! Handle a data packet when reassembling
+      void reassembleDataPacket(
+          const NATIVE_INT_TYPE portNum,
+          const Fw::FilePacket::DataPacket& dataPacket
+      );
+
+      //! Handle an end packet when reassembling
+      void reassembleEndPacket(
+          const NATIVE_INT_TYPE portNum,
+          const Fw::FilePacket::EndPacket& endPacket
+      );
+
+      //! Handle a cancel packet when reassembling
+      void reassembleCancelPacket(const NATIVE_INT_TYPE portNum);
+
+      //! Find a transfer for a start packet: the one with its source path,
+      //! else a free one, else the least recently active, which is dropped
+      U32 findTransfer(const Fw::FilePacket::StartPacket& startPacket);
+
+      //! End a transfer and detach it from the ports
+      void closeTransfer(const U32 index);
+
+      //! Report the ranges missing from a transfer
+      void reportMissing(Transfer& transfer);
 
       //! Go to START mode
       void goToStartMode(void);
@@ -274,6 +483,18 @@ namespace Svc {
       //! The file being assembled
       File file;
 
+      //! Whether files are reassembled
+      bool reassembly;
+
+      //! The files being reassembled
+      Transfer transfers[FILEUPLINK_MAX_TRANSFERS];
+
+      //! The transfer in progress on each port, or FILEUPLINK_MAX_TRANSFERS
+      U32 portTransfer[NUM_BUFFERSENDIN_INPUT_PORTS];
+
+      //! Count of packets received while reassembling, to order transfers by activity
+      U32 activity;
+
       //! The total number of files received
       FilesReceived filesReceived;
 
@@ -0,0 +1,123 @@
+// ====================================================================== 
+// \title  RangeMap.cpp
+// \brief  cpp file for FileUplink::RangeMap
+//
+// \copyright
+// Copyright 2009-2016, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <Svc/FileUplink/FileUplink.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Svc {
+
+  bool FileUplink::RangeMap ::
+    fits(
+        const U32 start,
+        const U32 end
+    ) const
+  {
+    // The new range merges with every range it overlaps or touches
+    U32 merged = 0;
+    for (U32 i = 0; i < this->count; ++i) {
+      if (this->starts[i] <= end && this->ends[i] >= start) {
+        ++merged;
+      }
+    }
+    return merged > 0 || this->count < FILEUPLINK_MAX_RANGES;
+  }
+
+  bool FileUplink::RangeMap ::
+    add(
+        const U32 start,
+        const U32 end
+    )
+  {
+    if (start > end) {
+      return false;
+    }
+    FW_ASSERT(this->count > 0 && this->starts[0] == 0, this->count);
+    if (start == end) {
+      return true;
+    }
+    if (not this->fits(start, end)) {
+      return false;
+    }
+
+    // Ranges first..last overlap or touch the new one
+    U32 first = 0;
+    while (first < this->count && this->ends[first] < start) {
+      ++first;
+    }
+    U32 last = first;
+    while (last < this->count && this->starts[last] <= end) {
+      ++last;
+    }
+
+    if (first == last) {
+      // Insert a range
+      for (U32 i = this->count; i > first; --i) {
+        this->starts[i] = this->starts[i - 1];
+        this->ends[i] = this->ends[i - 1];
+      }
+      this->starts[first] = start;
+      this->ends[first] = end;
+      ++this->count;
+    } else {
+      // Merge ranges first..last into one
+      if (this->starts[first] > start) {
+        this->starts[first] = start;
+      }
+      this->ends[first] = (this->ends[last - 1] > end) ? this->ends[last - 1] : end;
+      const U32 removed = last - first - 1;
+      for (U32 i = first + 1; i + removed < this->count; ++i) {
+        this->starts[i] = this->starts[i + removed];
+        this->ends[i] = this->ends[i + removed];
+      }
+      this->count -= removed;
+    }
+    return true;
+  }
+
+  bool FileUplink::RangeMap ::
+    nextGap(
+        const U32 start,
+        const U32 end,
+        U32& gapStart,
+        U32& gapEnd
+    ) const
+  {
+    U32 cursor = start;
+    for (U32 i = 0; i < this->count && cursor < end; ++i) {
+      if (this->ends[i] <= cursor) {
+        continue;
+      }
+      if (this->starts[i] > cursor) {
+        gapStart = cursor;
+        gapEnd = (this->starts[i] < end) ? this->starts[i] : end;
+        return true;
+      }
+      cursor = this->ends[i];
+    }
+    if (cursor < end) {
+      gapStart = cursor;
+      gapEnd = end;
+      return true;
+    }
+    return false;
+  }
+
+  U32 FileUplink::RangeMap ::
+    getReceived(void) const
+  {
+    U32 received = 0;
+    for (U32 i = 0; i < this->count; ++i) {
+      received += this->ends[i] - this->starts[i];
+    }
+    return received;
+  }
+
+}
@@ -0,0 +1,133 @@
+// ====================================================================== 
+// \title  Transfer.cpp
+// \brief  cpp file for FileUplink::Transfer
+//
+// \copyright
+// Copyright 2009-2016, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <Svc/FileUplink/FileUplink.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <string.h>
+
+namespace Svc {
+
+  bool FileUplink::Transfer ::
+    hasSource(const Fw::FilePacket::StartPacket& startPacket) const
+  {
+    const U8 length = startPacket.sourcePath.length;
+    return this->active &&
+      length == this->sourceLength &&
+      memcmp(startPacket.sourcePath.value, this->sourcePath, length) == 0;
+  }
+
+  Os::File::Status FileUplink::Transfer ::
+    open(const Fw::FilePacket::StartPacket& startPacket)
+  {
+    FW_ASSERT(not this->active);
+    this->sourceLength = startPacket.sourcePath.length;
+    memcpy(this->sourcePath, startPacket.sourcePath.value, this->sourceLength);
+    this->received.clear();
+    this->bufferSize = 0;
+    this->failed = false;
+    const Os::File::Status status = this->file.open(startPacket);
+    this->active = (status == Os::File::OP_OK);
+    return status;
+  }
+
+  Os::File::Status FileUplink::Transfer ::
+    write(
+        const U8 *const data,
+        const U32 byteOffset,
+        const U32 length
+    )
+  {
+    FW_ASSERT(this->active);
+    if (length == 0) {
+      return Os::File::OP_OK;
+    }
+    const U32 end = byteOffset + length;
+    if (end < byteOffset) {
+      return Os::File::BAD_SIZE;
+    }
+    if (not this->received.fits(byteOffset, end)) {
+      return Os::File::OP_OK;
+    }
+
+    // Gather data that follows on from the data waiting
+    if (this->bufferSize > 0 &&
+        byteOffset == this->bufferOffset + this->bufferSize &&
+        length <= sizeof(this->writeBuffer) - this->bufferSize) {
+      memcpy(&this->writeBuffer[this->bufferSize], data, length);
+      this->bufferSize += length;
+      this->record(data, byteOffset, end);
+      return Os::File::OP_OK;
+    }
+
+    Os::File::Status status = this->flush();
+    if (status != Os::File::OP_OK) {
+      return status;
+    }
+    if (length >= sizeof(this->writeBuffer)) {
+      status = this->file.writeAt(data, byteOffset, length);
+      if (status != Os::File::OP_OK) {
+        this->failed = true;
+        return status;
+      }
+    }
+    else {
+      memcpy(this->writeBuffer, data, length);
+      this->bufferOffset = byteOffset;
+      this->bufferSize = length;
+    }
+    this->record(data, byteOffset, end);
+    return Os::File::OP_OK;
+  }
+
+  void FileUplink::Transfer ::
+    record(
+        const U8 *const data,
+        const U32 byteOffset,
+        const U32 end
+    )
+  {
+    // Only bytes not received before go into the checksum
+    U32 gapStart = 0;
+    U32 gapEnd = byteOffset;
+    while (this->received.nextGap(gapEnd, end, gapStart, gapEnd)) {
+      this->file.updateChecksum(&data[gapStart - byteOffset], gapStart, gapEnd - gapStart);
+    }
+    const bool added = this->received.add(byteOffset, end);
+    FW_ASSERT(added);
+  }
+
+  Os::File::Status FileUplink::Transfer ::
+    flush(void)
+  {
+    if (this->bufferSize == 0) {
+      return Os::File::OP_OK;
+    }
+    const U32 size = this->bufferSize;
+    this->bufferSize = 0;
+    // The data waiting already counts as received, so losing it spoils the file
+    const Os::File::Status status = this->file.writeAt(this->writeBuffer, this->bufferOffset, size);
+    if (status != Os::File::OP_OK) {
+      this->failed = true;
+    }
+    return status;
+  }
+
+  Os::File::Status FileUplink::Transfer ::
+    close(void)
+  {
+    const Os::File::Status status = this->flush();
+    this->file.osFile.close();
+    this->received.clear();
+    this->active = false;
+    return status;
+  }
+
+}
@@ -66,12 +66,13 @@ namespace Svc {
 
   void FileUplink::Warnings ::
     badChecksum(
+        Fw::LogStringArg& fileName,
         const U32 computed,
         const U32 read
     )
   {
     this->fileUplink->log_WARNING_HI_BadChecksum(
-        this->fileUplink->file.name,
+        fileName,
         computed,
         read
     );
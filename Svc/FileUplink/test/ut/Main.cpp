@@ -44,6 +44,16 @@ TEST(FileUplink, PacketOutOfBounds) {
   tester.packetOutOfBounds();
 }
 
+TEST(FileUplink, PacketOffsetOverflow) {
+  Svc::Tester tester;
+  tester.packetOffsetOverflow(false);
+}
+
+TEST(FileUplink, ReassembleOffsetOverflow) {
+  Svc::Tester tester;
+  tester.packetOffsetOverflow(true);
+}
+
 TEST(FileUplink, PacketOutOfOrder) {
   Svc::Tester tester;
   tester.packetOutOfOrder();
@@ -59,6 +69,21 @@ TEST(FileUplink, CancelPacketInDataMode) {
   tester.cancelPacketInDataMode();
 }
 
+TEST(FileUplink, ReassembleOutOfOrder) {
+  Svc::Tester tester;
+  tester.reassembleOutOfOrder();
+}
+
+TEST(FileUplink, ReassembleMissingData) {
+  Svc::Tester tester;
+  tester.reassembleMissingData();
+}
+
+TEST(FileUplink, ReassembleWriteError) {
+  Svc::Tester tester;
+  tester.reassembleWriteError();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
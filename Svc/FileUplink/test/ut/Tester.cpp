@@ -339,6 +339,46 @@ namespace Svc {
 
   }
 
+  void Tester ::
+    packetOffsetOverflow(const bool reassembly) 
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const size_t fileSize = 2 * PACKET_SIZE;
+
+    this->component.setReassembly(reassembly);
+
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    ASSERT_TLM_SIZE(1);
+    ASSERT_TLM_PacketsReceived(
+        0, 
+        ++this->expectedPacketsReceived
+    );
+    ASSERT_EVENTS_SIZE(0);
+
+    // The offset plus the size wraps to 4, inside the file
+    const size_t byteOffset = 0xFFFFFFF0;
+    U8 packetData[4 * PACKET_SIZE];
+    memset(packetData, 0, sizeof(packetData));
+    this->sendDataPacket(byteOffset, packetData, sizeof(packetData));
+
+    ASSERT_TLM_SIZE(2);
+    ASSERT_TLM_PacketsReceived(
+        0, 
+        ++this->expectedPacketsReceived
+    );
+    ASSERT_TLM_Warnings(0, 1);
+
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_PacketOutOfBounds(
+        0, 1, destPath
+    );
+
+    this->removeFile(destPath);
+
+  }
+
   void Tester ::
     packetOutOfOrder(void) 
   {
@@ -460,6 +500,175 @@ namespace Svc {
 
   }
     
+  void Tester ::
+    reassembleOutOfOrder(void)
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const U32 numPackets = 4;
+    U8 packetData[numPackets][PACKET_SIZE] = {
+      { 0, 1, 2, 3, 4 },
+      { 5, 6, 7, 8, 9 },
+      { 10, 11, 12, 13, 14 },
+      { 15, 16, 17, 18, 19 }
+    };
+    const U8 *const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+
+    this->component.setReassembly(true);
+
+    // Send the start packet
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    ASSERT_TLM_PacketsReceived(
+        0,
+        ++this->expectedPacketsReceived
+    );
+    ASSERT_EVENTS_SIZE(0);
+
+    // Send the data packets out of order, one of them twice
+    const U32 order[] = { 2, 0, 3, 0, 1 };
+    for (size_t i = 0; i < FW_NUM_ARRAY_ELEMENTS(order); ++i) {
+      this->sendDataPacket(order[i] * PACKET_SIZE, packetData[order[i]]);
+      ASSERT_TLM_PacketsReceived(
+          0,
+          ++this->expectedPacketsReceived
+      );
+      ASSERT_EVENTS_SIZE(0);
+    }
+
+    // Send the end packet
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+    ASSERT_TLM_FilesReceived(0, 1);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileReceived(0, destPath);
+
+    // Verify the file data
+    this->verifyFileData(destPath, linearPacketData, fileSize);
+
+    // Remove the file
+    this->removeFile(destPath);
+
+  }
+
+  void Tester ::
+    reassembleMissingData(void)
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const char *const otherSourcePath = "other.bin";
+    const char *const otherDestPath = "dest2.bin";
+    const U32 numPackets = 3;
+    U8 packetData[numPackets][PACKET_SIZE] = {
+      { 0, 1, 2, 3, 4 },
+      { 5, 6, 7, 8, 9 },
+      { 10, 11, 12, 13, 14 }
+    };
+    const U8 *const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+
+    this->component.setReassembly(true);
+
+    // Send the file without its middle packet
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    this->sendDataPacket(0, packetData[0]);
+    this->sendDataPacket(2 * PACKET_SIZE, packetData[2]);
+    this->sendEndPacket(checksum);
+
+    // The missing range is reported and the file is not done
+    ASSERT_TLM_SIZE(1);
+    ASSERT_EVENTS_SIZE(2);
+    ASSERT_EVENTS_FileIncomplete(0, destPath, PACKET_SIZE, 1);
+    ASSERT_EVENTS_MissingRange(0, destPath, PACKET_SIZE, PACKET_SIZE);
+
+    // Send a whole other file meanwhile
+    this->sendStartPacket(otherSourcePath, otherDestPath, PACKET_SIZE);
+    this->sendDataPacket(0, packetData[1]);
+    CFDP::Checksum otherChecksum;
+    otherChecksum.update(packetData[1], 0, PACKET_SIZE);
+    this->sendEndPacket(otherChecksum);
+    ASSERT_TLM_FilesReceived(0, 1);
+    ASSERT_EVENTS_FileReceived(0, otherDestPath);
+
+    // Resume the first file and send the missing packet
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileResumed(0, destPath, 2 * PACKET_SIZE);
+    this->sendDataPacket(PACKET_SIZE, packetData[1]);
+    this->sendEndPacket(checksum);
+    ASSERT_TLM_FilesReceived(0, 2);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileReceived(0, destPath);
+
+    // Verify the file data
+    this->verifyFileData(destPath, linearPacketData, fileSize);
+    this->verifyFileData(otherDestPath, packetData[1], PACKET_SIZE);
+
+    // Remove the files
+    this->removeFile(destPath);
+    this->removeFile(otherDestPath);
+
+  }
+
+  void Tester ::
+    reassembleWriteError(void)
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const U32 numPackets = 3;
+    U8 packetData[numPackets][PACKET_SIZE] = {
+      { 0, 1, 2, 3, 4 },
+      { 5, 6, 7, 8, 9 },
+      { 10, 11, 12, 13, 14 }
+    };
+    const U8 *const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+
+    this->component.setReassembly(true);
+
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    const U32 index = this->component.portTransfer[0];
+    ASSERT_LT(index, static_cast<U32>(FILEUPLINK_MAX_TRANSFERS));
+    FileUplink::Transfer& transfer = this->component.transfers[index];
+
+    // Close the file so writing will fail
+    transfer.file.osFile.close();
+
+    // The first packet waits in the write buffer, and the second one,
+    // which does not follow on, fails to write it out
+    this->sendDataPacket(0, packetData[0]);
+    ASSERT_EVENTS_SIZE(0);
+    this->sendDataPacket(2 * PACKET_SIZE, packetData[2]);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileWriteError(0, destPath);
+    ASSERT_TRUE(transfer.failed);
+    ASSERT_EQ(static_cast<U32>(PACKET_SIZE), transfer.received.getReceived());
+
+    // Once all bytes count as received, the file is still not done
+    this->sendDataPacket(PACKET_SIZE, packetData[1]);
+    this->sendDataPacket(2 * PACKET_SIZE, packetData[2]);
+    ASSERT_EQ(static_cast<U32>(fileSize), transfer.received.getReceived());
+    this->clearHistory();
+    this->sendEndPacket(checksum);
+    ASSERT_TLM_FilesReceived_SIZE(0);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileWriteError(0, destPath);
+    ASSERT_EVENTS_FileReceived_SIZE(0);
+    ASSERT_FALSE(transfer.active);
+    ASSERT_EQ(FILEUPLINK_MAX_TRANSFERS, this->component.portTransfer[0]);
+
+    this->removeFile(destPath);
+
+  }
+
   // ----------------------------------------------------------------------
   // Handlers for from ports
   // ----------------------------------------------------------------------
@@ -586,13 +795,14 @@ namespace Svc {
   void Tester ::
     sendDataPacket(
         const size_t byteOffset,
-        U8 *const packetData
+        U8 *const packetData,
+        const U32 dataSize
     )
   {
     const Fw::FilePacket::DataPacket dataPacket = {
       { Fw::FilePacket::T_DATA, this->sequenceIndex++ },
       static_cast<U32>(byteOffset),
-      PACKET_SIZE,
+      static_cast<U16>(dataSize),
       packetData
     };
     Fw::FilePacket filePacket;
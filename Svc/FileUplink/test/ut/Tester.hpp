@@ -76,6 +76,12 @@ namespace Svc {
       //!
       void packetOutOfBounds(void);
 
+      //! Send a packet whose offset plus size wraps past the largest offset
+      //!
+      void packetOffsetOverflow(
+          const bool reassembly //!< Whether to reassemble the file
+      );
+
       //! Send a file with an out-of-order packet
       //!
       void packetOutOfOrder(void);
@@ -88,6 +94,20 @@ namespace Svc {
       //!
       void cancelPacketInDataMode(void);
 
+      //! Reassemble a file from data packets out of order and repeated
+      //!
+      void reassembleOutOfOrder(void);
+
+      //! Reassemble a file with a packet missing, then resume it after
+      //! another file and send the missing packet
+      //!
+      void reassembleMissingData(void);
+
+      //! Fail the writes of a transfer and check that the file is not
+      //! reported received
+      //!
+      void reassembleWriteError(void);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -140,7 +160,8 @@ namespace Svc {
       //!
       void sendDataPacket(
           const size_t byteOffset,
-          U8 *const packetData
+          U8 *const packetData,
+          const U32 dataSize = PACKET_SIZE
       );
 
       //! Send an EndPacket
@@ -12,6 +12,7 @@
 
 #include "FprimeProtocol.hpp"
 #include "Utils/Hash/Hash.hpp"
+#include <string.h>
 
 namespace Svc {
 
@@ -51,24 +52,24 @@ void FprimeFraming::frame(const U8* const data, const U32 size, Fw::ComPacket::C
 bool FprimeDeframing::validate(Types::CircularBuffer& ring, U32 size) {
     Utils::Hash hash;
     Utils::HashBuffer hashBuffer;
-    // Initialize the checksum and loop through all bytes calculating it
+    const U8* first = NULL;
+    const U8* second = NULL;
+    NATIVE_UINT_TYPE firstSize = 0;
+    NATIVE_UINT_TYPE secondSize = 0;
+    // Checksum the frame in place, one contiguous span at a time
+    Fw::SerializeStatus status = ring.peek_spans(size, 0, first, firstSize, second, secondSize);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
     hash.init();
-    for (U32 i = 0; i < size; i++) {
-        char byte;
-        ring.peek(byte, i);
-        hash.update(&byte, 1);
+    hash.update(first, firstSize);
+    if (secondSize > 0) {
+        hash.update(second, secondSize);
     }
     hash.final(hashBuffer);
-    // Now loop through the hash digest bytes and check for equality
-    for (U32 i = 0; i < HASH_DIGEST_LENGTH; i++) {
-        char calc = static_cast<char>(hashBuffer.getBuffAddr()[i]);
-        char sent = 0;
-        ring.peek(sent, size + i);
-        if (calc != sent) {
-            return false;
-        }
-    }
-    return true;
+    // Now compare the sent hash digest against the calculated one
+    U8 sent[HASH_DIGEST_LENGTH];
+    status = ring.peek(sent, HASH_DIGEST_LENGTH, size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    return memcmp(hashBuffer.getBuffAddr(), sent, HASH_DIGEST_LENGTH) == 0;
 }
 
 DeframingProtocol::DeframingStatus FprimeDeframing::deframe(Types::CircularBuffer& ring, U32& needed) {
@@ -98,8 +99,10 @@ DeframingProtocol::DeframingStatus FprimeDeframing::deframe(Types::CircularBuffe
     if (not this->validate(ring, needed - HASH_DIGEST_LENGTH)) {
         return DeframingProtocol::DEFRAMING_INVALID_CHECKSUM;
     }
+    // Copy the payload spans out of the ring, as the routed buffer outlives the ring data
     Fw::Buffer buffer = m_interface->allocate(size);
-    ring.peek(buffer.getData(), size, FP_FRAME_HEADER_SIZE);
+    status = ring.peek(buffer.getData(), size, FP_FRAME_HEADER_SIZE);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
     m_interface->route(buffer);
     return DeframingProtocol::DEFRAMING_STATUS_SUCCESS;
 }
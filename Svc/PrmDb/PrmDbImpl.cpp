@@ -8,6 +8,7 @@
 #include <Svc/PrmDb/PrmDbImpl.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Types/EightyCharString.hpp>
+#include <Fw/Types/IdTable.hpp>
 
 #include <Os/File.hpp>
 
@@ -52,7 +53,36 @@ namespace Svc {
         for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
             this->m_db[entry].used = false;
             this->m_db[entry].id = 0;
+            this->m_db[entry].next = -1;
         }
+        for (I32 slot = 0; slot < PRMDB_NUM_HASH_SLOTS; slot++) {
+            this->m_idSlots[slot] = -1;
+        }
+        this->m_numEntries = 0;
+    }
+
+    NATIVE_INT_TYPE PrmDbImpl::findEntry(FwPrmIdType id) {
+        NATIVE_INT_TYPE entry = this->m_idSlots[Fw::IdTableUtils::hash(id,0) % PRMDB_NUM_HASH_SLOTS];
+        while (entry != -1) {
+            if (this->m_db[entry].id == id) {
+                break;
+            }
+            entry = this->m_db[entry].next;
+        }
+        return entry;
+    }
+
+    NATIVE_INT_TYPE PrmDbImpl::addEntry(FwPrmIdType id) {
+        if (this->m_numEntries >= PRMDB_NUM_DB_ENTRIES) {
+            return -1;
+        }
+        NATIVE_INT_TYPE entry = this->m_numEntries++;
+        NATIVE_UINT_TYPE slot = Fw::IdTableUtils::hash(id,0) % PRMDB_NUM_HASH_SLOTS;
+        this->m_db[entry].used = true;
+        this->m_db[entry].id = id;
+        this->m_db[entry].next = this->m_idSlots[slot];
+        this->m_idSlots[slot] = entry;
+        return entry;
     }
 
     // If ports are no longer guarded, these accesses need to be protected from each other
@@ -62,14 +92,10 @@ namespace Svc {
         // search for entry
         Fw::ParamValid stat = Fw::PARAM_INVALID;
 
-        for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-            if (this->m_db[entry].used) {
-                if (this->m_db[entry].id == id) {
-                    val = this->m_db[entry].val;
-                    stat = Fw::PARAM_VALID;
-                    break;
-                }
-            }
+        NATIVE_INT_TYPE entry = this->findEntry(id);
+        if (entry != -1) {
+            val = this->m_db[entry].val;
+            stat = Fw::PARAM_VALID;
         }
 
         // if unable to find parameter, send error message
@@ -89,24 +115,16 @@ namespace Svc {
         bool existingEntry = false;
         bool noSlots = true;
 
-        for (NATIVE_INT_TYPE entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-            if ((this->m_db[entry].used) && (id == this->m_db[entry].id)) {
+        NATIVE_INT_TYPE entry = this->findEntry(id);
+        if (entry != -1) {
+            this->m_db[entry].val = val;
+            existingEntry = true;
+        } else {
+            // if there is no existing entry, add one
+            entry = this->addEntry(id);
+            if (entry != -1) {
                 this->m_db[entry].val = val;
-                existingEntry = true;
-                break;
-            }
-        }
-
-        // if there is no existing entry, add one
-        if (!existingEntry) {
-            for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-                if (!(this->m_db[entry].used)) {
-                    this->m_db[entry].val = val;
-                    this->m_db[entry].id = id;
-                    this->m_db[entry].used = true;
-                    noSlots = false;
-                    break;
-                }
+                noSlots = false;
             }
         }
 
@@ -125,7 +143,7 @@ namespace Svc {
     void PrmDbImpl::PRM_SAVE_FILE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
 
         Os::File paramFile;
-        WorkingBuffer buff;
+        Fw::ExternalSerializeBuffer image(this->m_fileImage,sizeof(this->m_fileImage));
 
         Os::File::Status stat = paramFile.open(this->m_fileName.toChar(),Os::File::OPEN_WRITE);
         if (stat != Os::File::OP_OK) {
@@ -136,102 +154,81 @@ namespace Svc {
 
         this->lock();
 
-        // Traverse the parameter list, saving each entry
+        // Traverse the parameter list, serializing each entry into the file image.
+        // Entries are claimed in order, so the used entries are the first m_numEntries.
 
         U32 numRecords = 0;
 
-        for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_db); entry++) {
-            if (this->m_db[entry].used) {
-                // write delimeter
-                static const U8 delim = PRMDB_ENTRY_DELIMETER;
-                NATIVE_INT_TYPE writeSize = sizeof(delim);
-                stat = paramFile.write(&delim,writeSize,true);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_DELIMETER,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != sizeof(delim)) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_DELIMETER_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                // serialize record size = id field + data
-                U32 recordSize = sizeof(FwPrmIdType) + this->m_db[entry].val.getBuffLength();
-
-                // reset buffer
-                buff.resetSer();
-                Fw::SerializeStatus serStat = buff.serialize(recordSize);
-                // should always work
-                FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
-
-                // write record size
-                writeSize = buff.getBuffLength();
-                stat = paramFile.write(buff.getBuffAddr(),writeSize,true);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_RECORD_SIZE,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != sizeof(writeSize)) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_RECORD_SIZE_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
+        for (NATIVE_INT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            FW_ASSERT(this->m_db[entry].used,entry);
+            // serialize delimeter
+            Fw::SerializeStatus serStat = image.serialize(static_cast<U8>(PRMDB_ENTRY_DELIMETER));
+            // should always work
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+            // serialize record size = id field + data
+            U32 recordSize = sizeof(FwPrmIdType) + this->m_db[entry].val.getBuffLength();
+            serStat = image.serialize(recordSize);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+            // serialize parameter id
+            serStat = image.serialize(this->m_db[entry].id);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+            // serialize parameter value
+            serStat = image.serialize(this->m_db[entry].val.getBuffAddr(),this->m_db[entry].val.getBuffLength(),true);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+            numRecords++;
+        } // end for each record
 
-                // reset buffer
-                buff.resetSer();
+        this->unLock();
 
-                // serialize parameter id
+        // write the image with a single write. An empty database leaves an empty file.
+        if (image.getBuffLength() > 0) {
+            NATIVE_INT_TYPE writeSize = image.getBuffLength();
+            stat = paramFile.write(image.getBuffAddr(),writeSize,true);
+            // a failed write writes nothing, so no one record is to blame
+            if (stat != Os::File::OP_OK) {
+                this->log_WARNING_HI_PrmFileImageWriteError(numRecords,stat);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+                return;
+            }
+            if (writeSize != (NATIVE_INT_TYPE)image.getBuffLength()) {
+                this->reportWriteError(writeSize,writeSize);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+                return;
+            }
+        }
 
-                serStat = buff.serialize(this->m_db[entry].id);
-                // should always work
-                FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+        this->log_ACTIVITY_HI_PrmFileSaveComplete(numRecords);
+        this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
 
-                // write parameter ID
-                writeSize = buff.getBuffLength();
-                stat = paramFile.write(buff.getBuffAddr(),writeSize,true);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_PARAMETER_ID,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != (NATIVE_INT_TYPE)buff.getBuffLength()) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_PARAMETER_ID_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
+    }
 
-                // write serialized parameter value
+    void PrmDbImpl::reportWriteError(NATIVE_UINT_TYPE written, I32 error) {
 
-                writeSize = this->m_db[entry].val.getBuffLength();
-                stat = paramFile.write(this->m_db[entry].val.getBuffAddr(),writeSize,true);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_PARAMETER_VALUE,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != (NATIVE_INT_TYPE)this->m_db[entry].val.getBuffLength()) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_PARAMETER_VALUE_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                numRecords++;
-            } // end if record in use
-        } // end for each record
+        // find the record holding the first byte that was not written
+        NATIVE_UINT_TYPE offset = written;
+        I32 record = 0;
+        for (NATIVE_INT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            NATIVE_UINT_TYPE recordSize = sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType) + this->m_db[entry].val.getBuffLength();
+            if (offset < recordSize) {
+                break;
+            }
+            offset -= recordSize;
+            record++;
+        }
 
-        this->unLock();
-        this->log_ACTIVITY_HI_PrmFileSaveComplete(numRecords);
-        this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+        // find the field within the record
+        PrmWriteError stage;
+        if (offset < sizeof(U8)) {
+            stage = PRM_WRITE_DELIMETER_SIZE;
+        } else if (offset < sizeof(U8) + sizeof(U32)) {
+            stage = PRM_WRITE_RECORD_SIZE_SIZE;
+        } else if (offset < sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType)) {
+            stage = PRM_WRITE_PARAMETER_ID_SIZE;
+        } else {
+            stage = PRM_WRITE_PARAMETER_VALUE_SIZE;
+        }
 
+        this->log_WARNING_HI_PrmFileWriteError(stage,record,error);
     }
 
     PrmDbImpl::~PrmDbImpl() {
@@ -333,12 +330,18 @@ namespace Svc {
             // deserialize, since parameter ID is serialized in file
             FW_ASSERT(Fw::FW_SERIALIZE_OK == buff.deserialize(parameterId));
 
+            // find or add the entry for the parameter. A repeated ID replaces the earlier value.
+            NATIVE_INT_TYPE dbEntry = this->findEntry(parameterId);
+            if (-1 == dbEntry) {
+                dbEntry = this->addEntry(parameterId);
+            }
+            // can't run out, since there are no more records than entries
+            FW_ASSERT(dbEntry != -1,parameterId);
+
             // copy parameter
-            this->m_db[entry].used = true;
-            this->m_db[entry].id = parameterId;
             readSize = recordSize-sizeof(parameterId);
 
-            fStat = paramFile.read(this->m_db[entry].val.getBuffAddr(),readSize);
+            fStat = paramFile.read(this->m_db[dbEntry].val.getBuffAddr(),readSize);
 
             if (fStat != Os::File::OP_OK) {
                 this->log_WARNING_HI_PrmFileReadError(PRM_READ_PARAMETER_VALUE,recordNum,fStat);
@@ -350,7 +353,7 @@ namespace Svc {
             }
 
             // set serialized size to read size
-            desStat = this->m_db[entry].val.setBuffLen(readSize);
+            desStat = this->m_db[dbEntry].val.setBuffLen(readSize);
             // should never fail
             FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,(NATIVE_INT_TYPE)desStat);
             recordNum++;
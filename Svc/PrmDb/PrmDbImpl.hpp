@@ -110,14 +110,51 @@ namespace Svc {
 
             void clearDb(void); //!< clear the parameter database
 
+            //!  \brief PrmDb find entry function
+            //!
+            //!  This function looks up a parameter ID in the hash slots
+            //!
+            //!  \param id identifier of parameter
+            //!  \return index of entry in m_db, or -1 if the parameter is not stored
+            NATIVE_INT_TYPE findEntry(FwPrmIdType id);
+
+            //!  \brief PrmDb add entry function
+            //!
+            //!  This function claims the next unused entry for a parameter ID
+            //!  and adds it to the hash slots. The ID must not already be stored.
+            //!
+            //!  \param id identifier of parameter
+            //!  \return index of entry in m_db, or -1 if the database is full
+            NATIVE_INT_TYPE addEntry(FwPrmIdType id);
+
+            //!  \brief PrmDb write error function
+            //!
+            //!  This function reports a short write of the file image. The record
+            //!  and field are found from the number of bytes that were written.
+            //!
+            //!  \param written number of bytes of the image that were written
+            //!  \param error value reported with the event
+            void reportWriteError(NATIVE_UINT_TYPE written, I32 error);
+
             Fw::EightyCharString m_fileName; //!< filename for parameter storage
 
             struct t_dbStruct {
                 bool used; //!< whether slot is being used
                 FwPrmIdType id; //!< the id being stored in the slot
                 Fw::ParamBuffer val; //!< the serialized value of the parameter
+                NATIVE_INT_TYPE next; //!< next entry in the same hash slot, or -1
             } m_db[PRMDB_NUM_DB_ENTRIES];
 
+            NATIVE_INT_TYPE m_idSlots[PRMDB_NUM_HASH_SLOTS]; //!< first entry in each hash slot, or -1
+            NATIVE_INT_TYPE m_numEntries; //!< number of entries used. Entries are only released by clearDb().
+
+            enum {
+                //! maximum size of one record in the file: delimiter, record size, id and value
+                RECORD_MAX_SIZE = sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType) + FW_PARAM_BUFFER_MAX_SIZE
+            };
+
+            U8 m_fileImage[PRMDB_NUM_DB_ENTRIES*RECORD_MAX_SIZE]; //!< file image built by PRM_SAVE_FILE
+
     };
 }
 
@@ -585,7 +585,7 @@ void PrmDbImplTester::runFileReadError(void) {
 
         Os::clearOpenInterceptor();
 
-        // Test delimiter write error
+        // Test image write error
 
         // populate file again
         this->runNominalPopulate();
@@ -593,213 +593,73 @@ void PrmDbImplTester::runFileReadError(void) {
         this->clearEvents();
         this->clearHistory();
         Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
-        // delimiter is first read
-        this->m_writesToWait = 0;
-        // set read status to bad
-        this->m_testWriteStatus = Os::File::NOT_OPENED;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_WRITE_ERROR;
-
-        // send command to save file
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_DELIMETER,0,Os::File::NOT_OPENED);
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-        Os::clearWriteInterceptor();
-
-        // Test delimiter write size error
-
-        // populate file again
-        this->runNominalPopulate();
-
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
-        // delimiter is first read
+        // image is written with a single write
         this->m_writesToWait = 0;
-        // set write status to okay
-        this->m_testWriteStatus = Os::File::OP_OK;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_SIZE_ERROR;
-        // set size to size of byte + 1
-        this->m_writeSize = sizeof(U8)+1;
-        // send command to save file
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_DELIMETER_SIZE,0,sizeof(U8)+1);
-
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-
-        Os::clearWriteInterceptor();
-
-        // Test record size write error
-
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
-        // size is second write
-        this->m_writesToWait = 1;
         // set write status to bad
         this->m_testWriteStatus = Os::File::NOT_OPENED;
         // set test type to write error
         this->m_writeTestType = FILE_WRITE_WRITE_ERROR;
-        // send command to save file
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_RECORD_SIZE,0,Os::File::NOT_OPENED);
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-        Os::clearWriteInterceptor();
-
-        // Test record size write size error
 
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
-        // size is second read
-        this->m_writesToWait = 1;
-        // set read status to okay
-        this->m_testWriteStatus = Os::File::OP_OK;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_SIZE_ERROR;
-        // set size to size of U32 + 1
-        this->m_writeSize = sizeof(U32)+1;
         // send command to save file
         this->sendCmd_PRM_SAVE_FILE(0,12);
         stat = this->m_impl.doDispatch();
         EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_RECORD_SIZE_SIZE,0,sizeof(U32)+1);
-
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-
-        Os::clearWriteInterceptor();
-
-        // Test parameter ID write error
-
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
-        // ID is third read
-        this->m_writesToWait = 2;
-        // set write status to bad
-        this->m_testWriteStatus = Os::File::NOT_OPENED;
-        // set test type to write error
-        this->m_writeTestType = FILE_WRITE_WRITE_ERROR;
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
+        // check for failed event. Nothing was written, so the whole image failed
         ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_PARAMETER_ID,0,Os::File::NOT_OPENED);
-
+        ASSERT_EVENTS_PrmFileImageWriteError_SIZE(1);
+        // runNominalPopulate() leaves two records
+        ASSERT_EVENTS_PrmFileImageWriteError(0,2,Os::File::NOT_OPENED);
         // check command status
         ASSERT_CMD_RESPONSE_SIZE(1);
         ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-
         Os::clearWriteInterceptor();
 
-        // Test parameter ID write size error
-
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
-        // size is second read
-        this->m_writesToWait = 2;
-        // set read status to okay
-        this->m_testWriteStatus = Os::File::OP_OK;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_SIZE_ERROR;
-        // set size to size of byte + 1
-        this->m_writeSize = sizeof(FwPrmIdType)+1;
-        // send command to save file
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_PARAMETER_ID_SIZE,0,sizeof(FwPrmIdType)+1);
+        // Test short image writes. The stage and record of the error are
+        // found from where the write stopped. Records from runNominalPopulate()
+        // are a delimiter, a record size, an ID and a U32 value.
 
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
+        const NATIVE_INT_TYPE recordSize = sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType) + sizeof(U32);
 
-        Os::clearWriteInterceptor();
+        struct {
+            NATIVE_INT_TYPE writeSize; // bytes written before the write stopped
+            PrmDbImpl::PrmWriteError stage; // expected stage
+            I32 record; // expected record
+        } shortWrites[] = {
+            {0,PrmDbImpl::PRM_WRITE_DELIMETER_SIZE,0},
+            {sizeof(U8)+1,PrmDbImpl::PRM_WRITE_RECORD_SIZE_SIZE,0},
+            {sizeof(U8)+sizeof(U32)+1,PrmDbImpl::PRM_WRITE_PARAMETER_ID_SIZE,0},
+            {sizeof(U8)+sizeof(U32)+sizeof(FwPrmIdType)+1,PrmDbImpl::PRM_WRITE_PARAMETER_VALUE_SIZE,0},
+            {recordSize,PrmDbImpl::PRM_WRITE_DELIMETER_SIZE,1},
+            {recordSize+sizeof(U8),PrmDbImpl::PRM_WRITE_RECORD_SIZE_SIZE,1},
+            {2*recordSize-1,PrmDbImpl::PRM_WRITE_PARAMETER_VALUE_SIZE,1},
+        };
 
-        // Test parameter value write error
+        for (NATIVE_UINT_TYPE test = 0; test < FW_NUM_ARRAY_ELEMENTS(shortWrites); test++) {
 
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
-        // record is fourth read
-        this->m_writesToWait = 3;
-        // set read status to bad
-        this->m_testWriteStatus = Os::File::NOT_OPENED;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_WRITE_ERROR;
-        // send write command
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_PARAMETER_VALUE,0,Os::File::NOT_OPENED);
-
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-        Os::clearWriteInterceptor();
+            this->clearEvents();
+            this->clearHistory();
+            Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
+            this->m_writesToWait = 0;
+            // set write status to okay
+            this->m_testWriteStatus = Os::File::OP_OK;
+            // set test type to size error
+            this->m_writeTestType = FILE_WRITE_SIZE_ERROR;
+            this->m_writeSize = shortWrites[test].writeSize;
+            // send command to save file
+            this->sendCmd_PRM_SAVE_FILE(0,12);
+            stat = this->m_impl.doDispatch();
+            EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+            // check for failed event
+            ASSERT_EVENTS_SIZE(1);
+            ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
+            ASSERT_EVENTS_PrmFileWriteError(0,shortWrites[test].stage,shortWrites[test].record,shortWrites[test].writeSize);
 
-        // Test parameter value write size error
+            // check command status
+            ASSERT_CMD_RESPONSE_SIZE(1);
+            ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
 
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
-        // record is fourth read
-        this->m_writesToWait = 3;
-        // set read status to okay
-        this->m_testWriteStatus = Os::File::OP_OK;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_SIZE_ERROR;
-        // set size to size of U32 + 1, which is nominal populate test value
-        this->m_writeSize = sizeof(U32)+1;
-        // send command
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_PARAMETER_VALUE_SIZE,0,sizeof(U32)+1);
-
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-        Os::clearWriteInterceptor();
+            Os::clearWriteInterceptor();
+        }
 
     }
 
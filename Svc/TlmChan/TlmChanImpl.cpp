@@ -44,7 +44,14 @@ namespace Svc {
         // clear free index
         this->m_tlmEntries[0].free = 0;
         this->m_tlmEntries[1].free = 0;
-
+        // clear updated lists
+        this->m_tlmEntries[0].numUpdated = 0;
+        this->m_tlmEntries[1].numUpdated = 0;
+        // no id table until set
+        this->m_idTable = 0;
+        // not packetized until a packet list is set
+        this->m_numPacketLocations = 0;
+        this->m_numPackets = 0;
 
     }
 
@@ -58,6 +65,63 @@ namespace Svc {
         TlmChanComponentBase::init(queueDepth,instance);
     }
 
+    void TlmChanImpl::setPacketList(const TlmChanPacketList& packetList) {
+
+        FW_ASSERT(packetList.list);
+        FW_ASSERT(packetList.numEntries <= TLMCHAN_MAX_PACKETS,packetList.numEntries);
+
+        const NATIVE_UINT_TYPE headerSize = sizeof(FwPacketDescriptorType) + sizeof(U16) + Fw::Time::SERIALIZED_SIZE;
+
+        this->m_numPacketLocations = 0;
+        for (NATIVE_UINT_TYPE packet = 0; packet < packetList.numEntries; packet++) {
+            const TlmChanPacketDef* def = packetList.list[packet];
+            FW_ASSERT(def);
+            FW_ASSERT(def->list);
+            PacketImage& image = this->m_packets[packet];
+            image.id = def->id;
+            image.updated = false;
+            image.length = 0;
+            for (NATIVE_UINT_TYPE channel = 0; channel < def->numEntries; channel++) {
+                FW_ASSERT(this->m_numPacketLocations < TLMCHAN_MAX_PACKET_ENTRIES,this->m_numPacketLocations);
+                const TlmChanChannelEntry& entry = def->list[channel];
+                // packet must fit in a single Com buffer
+                FW_ASSERT(headerSize + image.length + entry.size <= FW_COM_BUFFER_MAX_SIZE,
+                        def->id,image.length,entry.size);
+                // insert sorted by id so lookups can use a binary search
+                NATIVE_UINT_TYPE loc = this->m_numPacketLocations++;
+                while ((loc > 0) && (this->m_packetLocations[loc-1].id > entry.id)) {
+                    this->m_packetLocations[loc] = this->m_packetLocations[loc-1];
+                    loc--;
+                }
+                this->m_packetLocations[loc].id = entry.id;
+                this->m_packetLocations[loc].packet = packet;
+                this->m_packetLocations[loc].offset = image.length;
+                this->m_packetLocations[loc].size = entry.size;
+                image.length += entry.size;
+            }
+            // channels that have not been written are sent as zero
+            memset(image.data,0,sizeof(image.data));
+        }
+        this->m_numPackets = packetList.numEntries;
+    }
+
+    void TlmChanImpl::setIdTable(const Fw::IdTable& idTable) {
+
+        // reserved buckets must come off the front of the free list
+        FW_ASSERT(0 == this->m_tlmEntries[0].free,this->m_tlmEntries[0].free);
+        FW_ASSERT(0 == this->m_tlmEntries[1].free,this->m_tlmEntries[1].free);
+        // Make sure that there are enough buckets for the table
+        FW_ASSERT(idTable.numSlots <= TLMCHAN_HASH_BUCKETS,idTable.numSlots);
+
+        for (NATIVE_UINT_TYPE slot = 0; slot < idTable.numSlots; slot++) {
+            this->m_tlmEntries[0].buckets[slot].id = idTable.ids[slot];
+            this->m_tlmEntries[1].buckets[slot].id = idTable.ids[slot];
+        }
+        this->m_tlmEntries[0].free = idTable.numSlots;
+        this->m_tlmEntries[1].free = idTable.numSlots;
+        this->m_idTable = &idTable;
+    }
+
     NATIVE_UINT_TYPE TlmChanImpl::doHash(FwChanIdType id) {
         return (id % TLMCHAN_HASH_MOD_VALUE)%TLMCHAN_NUM_TLM_HASH_SLOTS;
     }
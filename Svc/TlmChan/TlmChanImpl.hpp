@@ -14,9 +14,11 @@
 #define TELEMCHANIMPL_HPP_
 
 #include <Svc/TlmChan/TlmChanComponentAc.hpp>
+#include <Svc/TlmChan/TlmChanPacketDefs.hpp>
 #include <TlmChanImplCfg.hpp>
 #include <Os/Mutex.hpp>
 #include <Fw/Tlm/TlmPacket.hpp>
+#include <Fw/Types/IdTable.hpp>
 
 namespace Svc {
 
@@ -29,6 +31,21 @@ namespace Svc {
                     NATIVE_INT_TYPE queueDepth, /*!< The queue depth*/
                     NATIVE_INT_TYPE instance /*!< The instance number*/
                     );
+            //! Set packet definitions and switch to packetized mode.
+            //! Channels in a packet definition are downlinked together in a
+            //! single packetized telemetry packet. Channels not in any packet
+            //! are still sent as individual telemetry packets.
+            //! Call before the component thread is started.
+            void setPacketList(
+                    const TlmChanPacketList& packetList /*!< list of packet definitions*/
+                    );
+            //! Set the generated channel id table. Each channel in the table
+            //! gets a reserved bucket found with a perfect hash instead of a
+            //! hash chain. Channels not in the table use the hash chains.
+            //! Call before any telemetry is written.
+            void setIdTable(
+                    const Fw::IdTable& idTable /*!< generated channel id table*/
+                    );
         PROTECTED:
 
             // can be overridden for alternate algorithms
@@ -61,10 +78,39 @@ namespace Svc {
                 TlmEntry* slots[TLMCHAN_NUM_TLM_HASH_SLOTS]; //!< set of hash slots in hash table
                 TlmEntry buckets[TLMCHAN_HASH_BUCKETS]; //!< set of buckets used in hash table
                 NATIVE_INT_TYPE free; //!< next free bucket
+                TlmEntry* updatedList[TLMCHAN_HASH_BUCKETS]; //!< entries updated since last write, in update order
+                NATIVE_UINT_TYPE numUpdated; //!< number of entries in updated list
             } m_tlmEntries[2];
 
             U32 m_activeBuffer; // !< which buffer is active for storing telemetry
 
+            const Fw::IdTable* m_idTable; //!< generated channel id table, or NULL
+
+            // packetized mode
+
+            struct PacketLocation {
+                FwChanIdType id; //!< channel id
+                NATIVE_UINT_TYPE packet; //!< index of packet holding channel
+                NATIVE_UINT_TYPE offset; //!< offset of value in packet data
+                NATIVE_UINT_TYPE size; //!< size of value in packet data
+            } m_packetLocations[TLMCHAN_MAX_PACKET_ENTRIES]; //!< channel locations, sorted by id
+            NATIVE_UINT_TYPE m_numPacketLocations; //!< number of channel locations
+
+            struct PacketImage {
+                U16 id; //!< packet id
+                bool updated; //!< set when a channel in the packet was written this cycle
+                Fw::Time timeTag; //!< time tag of last channel packed this cycle
+                NATIVE_UINT_TYPE length; //!< length of packet data
+                U8 data[FW_COM_BUFFER_MAX_SIZE]; //!< channel values laid out per packet definition
+            } m_packets[TLMCHAN_MAX_PACKETS]; //!< packet images
+            NATIVE_UINT_TYPE m_numPackets; //!< number of packets defined. Zero when not packetized.
+
+            //! Copy a channel value into every packet that holds it
+            //! \return true if the channel is in at least one packet
+            bool packChannel(TlmEntry* entry);
+            //! Send packets updated this cycle
+            void sendPackets(void);
+
             // work variables
             Fw::ComBuffer m_comBuffer;
             Fw::TlmPacket m_tlmPacket;
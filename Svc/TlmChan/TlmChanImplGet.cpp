@@ -16,21 +16,29 @@ namespace Svc {
 
     void TlmChanImpl::TlmGet_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val) {
 
-        // Compute index for entry
-
-        NATIVE_UINT_TYPE index = this->doHash(id);
-
-        // Search to see if channel has been stored
-        TlmEntry *entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
-        for (NATIVE_UINT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-            if (entryToUse) { // If bucket exists, check id
-                if (entryToUse->id == id) {
+        TlmEntry* entryToUse = 0;
+        NATIVE_UINT_TYPE slot = 0;
+
+        // Channels in the id table have a reserved bucket
+        if (this->m_idTable and Fw::IdTableUtils::lookup(*this->m_idTable,id,slot)) {
+            entryToUse = &this->m_tlmEntries[this->m_activeBuffer].buckets[slot];
+        } else {
+            // Compute index for entry
+
+            NATIVE_UINT_TYPE index = this->doHash(id);
+
+            // Search to see if channel has been stored
+            entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
+            for (NATIVE_UINT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
+                if (entryToUse) { // If bucket exists, check id
+                    if (entryToUse->id == id) {
+                        break;
+                    } else { // otherwise go to next bucket
+                        entryToUse = entryToUse->next;
+                    }
+                } else { // no buckets left to search
                     break;
-                } else { // otherwise go to next bucket
-                    entryToUse = entryToUse->next;
                 }
-            } else { // no buckets left to search
-                break;
             }
         }
 
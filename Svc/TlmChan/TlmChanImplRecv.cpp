@@ -16,45 +16,60 @@ namespace Svc {
 
     void TlmChanImpl::TlmRecv_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val) {
 
-        // Compute index for entry
-
-        NATIVE_UINT_TYPE index = this->doHash(id);
         TlmEntry* entryToUse = 0;
         TlmEntry* prevEntry = 0;
+        NATIVE_UINT_TYPE slot = 0;
+
+        // Channels in the id table have a reserved bucket
+        if (this->m_idTable and Fw::IdTableUtils::lookup(*this->m_idTable,id,slot)) {
+            entryToUse = &this->m_tlmEntries[this->m_activeBuffer].buckets[slot];
+        } else {
+            // Compute index for entry
+
+            NATIVE_UINT_TYPE index = this->doHash(id);
 
-        // Search to see if channel has already been stored or a bucket needs to be added
-        if (this->m_tlmEntries[this->m_activeBuffer].slots[index]) {
-            entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
-            for (NATIVE_UINT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-                if (entryToUse) {
-                    if (entryToUse->id == id) { // found the matching entry
+            // Search to see if channel has already been stored or a bucket needs to be added
+            if (this->m_tlmEntries[this->m_activeBuffer].slots[index]) {
+                entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
+                for (NATIVE_UINT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
+                    if (entryToUse) {
+                        if (entryToUse->id == id) { // found the matching entry
+                            break;
+                        } else { // try next entry
+                            prevEntry = entryToUse;
+                            entryToUse = entryToUse->next;
+                        }
+                    } else {
+                        // Make sure that we haven't run out of buckets
+                        FW_ASSERT(this->m_tlmEntries[this->m_activeBuffer].free < TLMCHAN_HASH_BUCKETS);
+                        // add new bucket from free list
+                        entryToUse = &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
+                        prevEntry->next = entryToUse;
+                        // clear next pointer
+                        entryToUse->next = 0;
                         break;
-                    } else { // try next entry
-                        prevEntry = entryToUse;
-                        entryToUse = entryToUse->next;
                     }
-                } else {
-                    // Make sure that we haven't run out of buckets
-                    FW_ASSERT(this->m_tlmEntries[this->m_activeBuffer].free < TLMCHAN_HASH_BUCKETS);
-                    // add new bucket from free list
-                    entryToUse = &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
-                    prevEntry->next = entryToUse;
-                    // clear next pointer
-                    entryToUse->next = 0;
-                    break;
                 }
+            } else {
+                // Make sure that we haven't run out of buckets
+                FW_ASSERT(this->m_tlmEntries[this->m_activeBuffer].free < TLMCHAN_HASH_BUCKETS);
+                // create new entry at slot head
+                this->m_tlmEntries[this->m_activeBuffer].slots[index] = &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
+                entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
+                entryToUse->next = 0;
             }
-        } else {
-            // Make sure that we haven't run out of buckets
-            FW_ASSERT(this->m_tlmEntries[this->m_activeBuffer].free < TLMCHAN_HASH_BUCKETS);
-            // create new entry at slot head
-            this->m_tlmEntries[this->m_activeBuffer].slots[index] = &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
-            entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
-            entryToUse->next = 0;
         }
 
         // copy into entry
         FW_ASSERT(entryToUse);
+
+        // add to updated list the first time the entry is written this cycle
+        if (not entryToUse->updated) {
+            TlmSet& set = this->m_tlmEntries[this->m_activeBuffer];
+            FW_ASSERT(set.numUpdated < TLMCHAN_HASH_BUCKETS,set.numUpdated);
+            set.updatedList[set.numUpdated++] = entryToUse;
+        }
+
         entryToUse->used = true;
         entryToUse->id = id;
         entryToUse->updated = true;
@@ -31,27 +31,95 @@ namespace Svc {
         // so the data can be read without worrying about updates
         this->lock();
         this->m_activeBuffer = 1 - this->m_activeBuffer;
-        // set activeBuffer to not updated
-        for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-            this->m_tlmEntries[this->m_activeBuffer].buckets[entry].updated = false;
+        // set activeBuffer to not updated. Only entries on the updated list
+        // can have the flag set, so the cost scales with channels written.
+        TlmSet& active = this->m_tlmEntries[this->m_activeBuffer];
+        for (NATIVE_UINT_TYPE entry = 0; entry < active.numUpdated; entry++) {
+            active.updatedList[entry]->updated = false;
         }
+        active.numUpdated = 0;
         this->unLock();
 
-        // go through each entry and send a packet if it has been updated
+        // go through each updated entry in update order and either pack it
+        // into its packets or send a packet for it
 
-        for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-            TlmEntry* p_entry = &this->m_tlmEntries[1-this->m_activeBuffer].buckets[entry];
+        TlmSet& inactive = this->m_tlmEntries[1-this->m_activeBuffer];
+        for (NATIVE_UINT_TYPE entry = 0; entry < inactive.numUpdated; entry++) {
+            TlmEntry* p_entry = inactive.updatedList[entry];
+            FW_ASSERT(p_entry);
             if ((p_entry->updated) && (p_entry->used)) {
+                p_entry->updated = false;
+                if (this->packChannel(p_entry)) {
+                    continue;
+                }
                 this->m_tlmPacket.setId(p_entry->id);
                 this->m_tlmPacket.setTimeTag(p_entry->lastUpdate);
                 this->m_tlmPacket.setTlmBuffer(p_entry->buffer);
                 this->m_comBuffer.resetSer();
                 Fw::SerializeStatus stat = this->m_tlmPacket.serialize(this->m_comBuffer);
                 FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
-                p_entry->updated = false;
                 this->PktSend_out(0,this->m_comBuffer,0);
             }
         }
+        inactive.numUpdated = 0;
+
+        this->sendPackets();
+    }
+
+    bool TlmChanImpl::packChannel(TlmEntry* entry) {
+
+        // find first location for the channel
+        NATIVE_UINT_TYPE low = 0;
+        NATIVE_UINT_TYPE high = this->m_numPacketLocations;
+        while (low < high) {
+            NATIVE_UINT_TYPE mid = low + (high - low)/2;
+            if (this->m_packetLocations[mid].id < entry->id) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+
+        bool packed = false;
+        NATIVE_UINT_TYPE length = entry->buffer.getBuffLength();
+        for (NATIVE_UINT_TYPE loc = low;
+                (loc < this->m_numPacketLocations) && (this->m_packetLocations[loc].id == entry->id);
+                loc++) {
+            const PacketLocation& location = this->m_packetLocations[loc];
+            PacketImage& image = this->m_packets[location.packet];
+            FW_ASSERT(length <= location.size,entry->id,length,location.size);
+            memcpy(&image.data[location.offset],entry->buffer.getBuffAddr(),length);
+            // zero unused part of a variable length value
+            memset(&image.data[location.offset+length],0,location.size-length);
+            // packet takes the time tag of the last channel packed. Comparing
+            // time tags is avoided since channels may use different time bases.
+            image.timeTag = entry->lastUpdate;
+            image.updated = true;
+            packed = true;
+        }
+        return packed;
+    }
+
+    void TlmChanImpl::sendPackets(void) {
+
+        for (NATIVE_UINT_TYPE packet = 0; packet < this->m_numPackets; packet++) {
+            PacketImage& image = this->m_packets[packet];
+            if (not image.updated) {
+                continue;
+            }
+            this->m_comBuffer.resetSer();
+            Fw::SerializeStatus stat = this->m_comBuffer.serialize(
+                    static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_PACKETIZED_TLM));
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            stat = this->m_comBuffer.serialize(image.id);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            stat = this->m_comBuffer.serialize(image.timeTag);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            stat = this->m_comBuffer.serialize(image.data,image.length,true);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            image.updated = false;
+            this->PktSend_out(0,this->m_comBuffer,0);
+        }
     }
 
 }
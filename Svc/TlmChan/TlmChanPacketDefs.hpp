@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief Packet definition types for packetized TlmChan telemetry
+ *
+ * A packet definition lists the channels that are downlinked together in a
+ * single FW_PACKET_PACKETIZED_TLM packet. The packet layout matches the ground
+ * packet specification: a packet descriptor, a 16-bit packet ID, a time tag,
+ * then the channel values in the order given in the definition.
+ *
+ * \copyright
+ * Copyright 2009-2015, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ * <br /><br />
+ */
+
+#ifndef TLMCHANPACKETDEFS_HPP_
+#define TLMCHANPACKETDEFS_HPP_
+
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Svc {
+
+    struct TlmChanChannelEntry {
+        FwChanIdType id; //!< channel id
+        NATIVE_UINT_TYPE size; //!< serialized size of channel value in the packet
+    };
+
+    struct TlmChanPacketDef {
+        const TlmChanChannelEntry* list; //!< channels in packet, in packet order
+        NATIVE_UINT_TYPE numEntries; //!< number of channels in packet
+        U16 id; //!< packet id
+    };
+
+    struct TlmChanPacketList {
+        const TlmChanPacketDef* const * list; //!< packet definitions
+        NATIVE_UINT_TYPE numEntries; //!< number of packet definitions
+    };
+
+}
+
+#endif /* TLMCHANPACKETDEFS_HPP_ */
@@ -197,6 +197,151 @@ namespace Svc {
 
     }
 
+    void TlmChanImplTester::runUpdateOrder(void) {
+
+        FwChanIdType IDs[] = {0x105,0x1000,0x300,0x101,0x1103};
+
+        this->clearBuffs();
+        // send all updates, then update the first one again
+        for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+            this->sendBuff(IDs[n],n,0);
+        }
+        this->sendBuff(IDs[0],100,0);
+
+        // do a run, and one packet per channel should be sent in update order
+        this->doRun(true);
+        ASSERT_EQ(this->m_numBuffs,FW_NUM_ARRAY_ELEMENTS(IDs));
+
+        for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+            FwPacketDescriptorType desc;
+            FwChanIdType sentId;
+            this->m_rcvdBuffer[n].resetDeser();
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_rcvdBuffer[n].deserialize(desc));
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_rcvdBuffer[n].deserialize(sentId));
+            ASSERT_EQ(IDs[n],sentId);
+        }
+        this->checkBuff(IDs[0],100,0);
+
+        // no updates, so nothing should be sent
+        this->clearBuffs();
+        ASSERT_FALSE(this->doRun(false));
+        ASSERT_EQ(0u,this->m_numBuffs);
+
+        // update one channel in each buffer and verify only it is sent
+        for (NATIVE_UINT_TYPE cycle = 0; cycle < 2; cycle++) {
+            this->clearBuffs();
+            this->sendBuff(IDs[2],200+cycle,0);
+            this->doRun(true);
+            ASSERT_EQ(1u,this->m_numBuffs);
+            this->checkBuff(IDs[2],200+cycle,0);
+        }
+
+    }
+
+    void TlmChanImplTester::runPacketized(void) {
+
+        static const TlmChanChannelEntry packet1List[] = {
+                {0x100,sizeof(U32)},
+                {0x101,sizeof(U32)}
+        };
+        static const TlmChanChannelEntry packet2List[] = {
+                {0x200,sizeof(U32)},
+                {0x100,sizeof(U32)}
+        };
+        static const TlmChanPacketDef packet1 = {packet1List,FW_NUM_ARRAY_ELEMENTS(packet1List),1};
+        static const TlmChanPacketDef packet2 = {packet2List,FW_NUM_ARRAY_ELEMENTS(packet2List),2};
+        static const TlmChanPacketDef* const packets[] = {&packet1,&packet2};
+        static const TlmChanPacketList packetList = {packets,FW_NUM_ARRAY_ELEMENTS(packets)};
+
+        this->m_impl.setPacketList(packetList);
+
+        // write a channel in both packets and a channel in no packet
+        this->clearBuffs();
+        this->sendBuff(0x100,10,0);
+        this->sendBuff(0x300,30,0);
+        this->doRun(true);
+
+        // unpacketized channel is sent individually, then one buffer per updated packet
+        ASSERT_EQ(3u,this->m_numBuffs);
+        this->checkBuff(0x300,30,0);
+
+        const U16 expId[] = {1,2};
+        const U32 expVals[][2] = {{10,0},{0,10}};
+        for (NATIVE_UINT_TYPE packet = 0; packet < 2; packet++) {
+            Fw::ComBuffer& buff = this->m_rcvdBuffer[packet+1];
+            buff.resetDeser();
+            FwPacketDescriptorType desc;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(desc));
+            ASSERT_EQ(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_PACKETIZED_TLM),desc);
+            U16 id;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(id));
+            ASSERT_EQ(expId[packet],id);
+            Fw::Time timeTag;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(timeTag));
+            for (NATIVE_UINT_TYPE val = 0; val < 2; val++) {
+                U32 readVal;
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(readVal));
+                ASSERT_EQ(expVals[packet][val],readVal);
+            }
+            ASSERT_EQ(0u,buff.getBuffLeft());
+        }
+
+        // update a channel in only the first packet; packet keeps earlier values
+        this->clearBuffs();
+        this->sendBuff(0x101,11,0);
+        this->doRun(true);
+        ASSERT_EQ(1u,this->m_numBuffs);
+        Fw::ComBuffer& buff = this->m_rcvdBuffer[0];
+        buff.resetDeser();
+        FwPacketDescriptorType desc;
+        U16 id;
+        Fw::Time timeTag;
+        U32 val1, val2;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(desc));
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(id));
+        ASSERT_EQ(1u,id);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(timeTag));
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(val1));
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(val2));
+        ASSERT_EQ(10u,val1);
+        ASSERT_EQ(11u,val2);
+
+    }
+
+    void TlmChanImplTester::runIdTable(void) {
+
+        // Table generated by the autocoder for ids 0x1000,0x1001,0x1002,0x300,0x301
+        static const U32 ids[] = {0x1000,0x1001,0x301,0x300,0x1002};
+        static const U32 seeds[] = {7,4};
+        static const Fw::IdTable table = {ids,seeds,FW_NUM_ARRAY_ELEMENTS(ids),FW_NUM_ARRAY_ELEMENTS(seeds)};
+
+        this->m_impl.setIdTable(table);
+
+        // channels in the table and one that is not
+        FwChanIdType IDs[] = {0x300,0x1002,0x105,0x1000,0x301,0x1001};
+
+        for (NATIVE_UINT_TYPE cycle = 0; cycle < 2; cycle++) {
+            this->clearBuffs();
+            for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+                this->sendBuff(IDs[n],n+cycle,0);
+            }
+            this->doRun(true);
+            ASSERT_EQ(this->m_numBuffs,FW_NUM_ARRAY_ELEMENTS(IDs));
+            for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+                this->checkBuff(IDs[n],n+cycle,0);
+            }
+        }
+
+        // table channels are in their reserved buckets, others come after
+        for (NATIVE_UINT_TYPE slot = 0; slot < FW_NUM_ARRAY_ELEMENTS(ids); slot++) {
+            ASSERT_EQ(ids[slot],this->m_impl.m_tlmEntries[0].buckets[slot].id);
+            ASSERT_TRUE(this->m_impl.m_tlmEntries[0].buckets[slot].used);
+        }
+        ASSERT_EQ(static_cast<FwChanIdType>(0x105),
+                this->m_impl.m_tlmEntries[0].buckets[FW_NUM_ARRAY_ELEMENTS(ids)].id);
+
+    }
+
     void TlmChanImplTester::runTooManyChannels(void) {
 
         // This will assert, so disable after testing
@@ -24,6 +24,9 @@ namespace Svc {
             void runMultiChannel(void);
             void runOffNominal(void);
             void runTooManyChannels(void);
+            void runUpdateOrder(void);
+            void runPacketized(void);
+            void runIdTable(void);
 
         private:
             Svc::TlmChanImpl& m_impl;
@@ -73,6 +73,66 @@ TEST(TlmChanTest,MultiChannelTest) {
 
 }
 
+TEST(TlmChanTest,UpdateOrderTest) {
+
+    COMMENT("Write channels and verify only updated channels are pushed, in update order.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runUpdateOrder();
+
+}
+
+TEST(TlmChanTest,PacketizedTest) {
+
+    COMMENT("Write channels in packetized mode and verify packets are pushed with packed values.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runPacketized();
+
+}
+
+TEST(TlmChanTest,IdTableTest) {
+
+    COMMENT("Write channels with a generated id table and verify they are read back and pushed correctly.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runIdTable();
+
+}
+
 
 TEST(TlmChanTest,OffNominal) {
 
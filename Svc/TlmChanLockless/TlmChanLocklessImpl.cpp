@@ -0,0 +1,178 @@
+/**
+ * \file
+ * \brief Implementation file for lockless channelized telemetry storage component
+ *
+ * \copyright
+ * Copyright 2009-2015, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ * <br /><br />
+ */
+#include <Svc/TlmChanLockless/TlmChanLocklessImpl.hpp>
+#include <cstring>
+#include <Fw/Types/BasicTypes.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Com/ComBuffer.hpp>
+
+#define CAS(a_ptr, a_oldVal, a_newVal) __sync_bool_compare_and_swap(a_ptr, a_oldVal, a_newVal)
+
+namespace Svc {
+
+    TlmChanLocklessImpl::TlmChanLocklessImpl(const char* name) : TlmChanLocklessComponentBase(name)
+    {
+        // table size must be a power of two so the hash can be masked
+        FW_ASSERT((TLMCHAN_LOCKLESS_TABLE_SIZE & (TLMCHAN_LOCKLESS_TABLE_SIZE - 1)) == 0,
+                TLMCHAN_LOCKLESS_TABLE_SIZE);
+        // clear entries
+        for (NATIVE_UINT_TYPE entry = 0; entry < TLMCHAN_LOCKLESS_TABLE_SIZE; entry++) {
+            this->m_entries[entry].d.id = EMPTY_ID;
+            this->m_entries[entry].d.sequence = 0;
+            this->m_entries[entry].d.updated = 0;
+            this->m_entries[entry].d.length = 0;
+        }
+    }
+
+    TlmChanLocklessImpl::~TlmChanLocklessImpl() {
+    }
+
+    void TlmChanLocklessImpl::init(
+            NATIVE_INT_TYPE queueDepth, /*!< The queue depth*/
+            NATIVE_INT_TYPE instance /*!< The instance number*/
+            ) {
+        TlmChanLocklessComponentBase::init(queueDepth,instance);
+    }
+
+    void TlmChanLocklessImpl::setChannelList(const FwChanIdType* ids, NATIVE_UINT_TYPE numIds) {
+        FW_ASSERT(ids);
+        for (NATIVE_UINT_TYPE id = 0; id < numIds; id++) {
+            FW_ASSERT(ids[id] != static_cast<FwChanIdType>(EMPTY_ID));
+            // make sure that we haven't run out of entries
+            FW_ASSERT(this->findEntry(ids[id],true),ids[id]);
+        }
+    }
+
+    TlmChanLocklessImpl::TlmEntry* TlmChanLocklessImpl::findEntry(FwChanIdType id, bool claim) {
+
+        // multiplicative hash spreads clustered ids across the table
+        NATIVE_UINT_TYPE index = (static_cast<U32>(id) * 2654435761U) & (TLMCHAN_LOCKLESS_TABLE_SIZE - 1);
+
+        for (NATIVE_UINT_TYPE probe = 0; probe < TLMCHAN_LOCKLESS_TABLE_SIZE; probe++) {
+            TlmEntry* entry = &this->m_entries[index];
+            FwChanIdType entryId = entry->d.id;
+            if (entryId == id) {
+                return entry;
+            }
+            if (entryId == static_cast<FwChanIdType>(EMPTY_ID)) {
+                if (not claim) {
+                    // ids are never removed, so the channel is not in the table
+                    return NULL;
+                }
+                // claim the entry. Another writer may have claimed it first for
+                // the same id or a different one.
+                if (CAS(&entry->d.id,static_cast<FwChanIdType>(EMPTY_ID),id) or (entry->d.id == id)) {
+                    return entry;
+                }
+            }
+            index = (index + 1) & (TLMCHAN_LOCKLESS_TABLE_SIZE - 1);
+        }
+
+        return NULL;
+    }
+
+    void TlmChanLocklessImpl::readEntry(TlmEntry& entry, Fw::Time& timeTag, Fw::TlmBuffer& val) {
+
+        U32 sequence;
+        do {
+            sequence = entry.d.sequence;
+            if (sequence & 1) {
+                // write in progress
+                continue;
+            }
+            __sync_synchronize();
+            NATIVE_UINT_TYPE length = entry.d.length;
+            // a torn length is discarded below, but must not overrun the copy
+            if (length > FW_TLM_BUFFER_MAX_SIZE) {
+                continue;
+            }
+            memcpy(val.getBuffAddr(),entry.d.data,length);
+            Fw::SerializeStatus stat = val.setBuffLen(length);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            timeTag = entry.d.lastUpdate;
+            __sync_synchronize();
+        } while ((sequence & 1) or (sequence != entry.d.sequence));
+    }
+
+    void TlmChanLocklessImpl::TlmRecv_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val) {
+
+        FW_ASSERT(id != static_cast<FwChanIdType>(EMPTY_ID));
+        TlmEntry* entry = this->findEntry(id,true);
+        // Make sure that we haven't run out of entries
+        FW_ASSERT(entry,id);
+
+        NATIVE_UINT_TYPE length = val.getBuffLength();
+        FW_ASSERT(length <= FW_TLM_BUFFER_MAX_SIZE,length);
+
+        // start write. Writers of the same channel take turns; the sequence is
+        // odd while the value is being copied so readers retry.
+        U32 sequence;
+        do {
+            sequence = entry->d.sequence;
+        } while ((sequence & 1) or not CAS(&entry->d.sequence,sequence,sequence + 1));
+
+        entry->d.lastUpdate = timeTag;
+        entry->d.length = length;
+        memcpy(entry->d.data,val.getBuffAddr(),length);
+        entry->d.updated = 1;
+
+        // end write
+        __sync_synchronize();
+        entry->d.sequence = sequence + 2;
+    }
+
+    void TlmChanLocklessImpl::TlmGet_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val) {
+
+        TlmEntry* entry = this->findEntry(id,false);
+
+        if (entry) {
+            this->readEntry(*entry,timeTag,val);
+        } else { // requested entry may not be written yet; empty buffer
+            val.resetSer();
+        }
+    }
+
+    void TlmChanLocklessImpl::Run_handler(NATIVE_INT_TYPE portNum, NATIVE_UINT_TYPE context) {
+        // Only write packets if connected
+        if (not this->isConnected_PktSend_OutputPort(0)) {
+            return;
+        }
+
+        // go through each entry and send a packet if it has been updated.
+        // The flag is cleared before the read, so a write that races with the
+        // read is sent again on the next cycle rather than lost.
+        for (NATIVE_UINT_TYPE index = 0; index < TLMCHAN_LOCKLESS_TABLE_SIZE; index++) {
+            TlmEntry& entry = this->m_entries[index];
+            if (not CAS(&entry.d.updated,1,0)) {
+                continue;
+            }
+            Fw::Time timeTag;
+            this->readEntry(entry,timeTag,this->m_tlmBuffer);
+            this->m_tlmPacket.setId(entry.d.id);
+            this->m_tlmPacket.setTimeTag(timeTag);
+            this->m_tlmPacket.setTlmBuffer(this->m_tlmBuffer);
+            this->m_comBuffer.resetSer();
+            Fw::SerializeStatus stat = this->m_tlmPacket.serialize(this->m_comBuffer);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            this->PktSend_out(0,this->m_comBuffer,0);
+        }
+    }
+
+    void TlmChanLocklessImpl::pingIn_handler(
+          const NATIVE_INT_TYPE portNum,
+          U32 key
+      )
+    {
+        // return key
+        this->pingOut_out(0,key);
+    }
+
+}
@@ -0,0 +1,93 @@
+/**
+ * \file
+ * \brief Component that stores telemetry channel values without a component lock
+ *
+ * Channel values are stored in an open-addressed table keyed by channel ID.
+ * Each entry is guarded by its own sequence lock, so reads never block
+ * writes and writes of different channels never contend.
+ *
+ * \copyright
+ * Copyright 2009-2015, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ * <br /><br />
+ */
+
+#ifndef TLMCHANLOCKLESSIMPL_HPP_
+#define TLMCHANLOCKLESSIMPL_HPP_
+
+#include <Svc/TlmChanLockless/TlmChanLocklessComponentAc.hpp>
+#include <TlmChanLocklessImplCfg.hpp>
+#include <Fw/Tlm/TlmPacket.hpp>
+
+namespace Svc {
+
+    class TlmChanLocklessImpl: public TlmChanLocklessComponentBase {
+        public:
+            friend class TlmChanLocklessImplTester;
+            TlmChanLocklessImpl(const char* compName);
+            virtual ~TlmChanLocklessImpl();
+            void init(
+                    NATIVE_INT_TYPE queueDepth, /*!< The queue depth*/
+                    NATIVE_INT_TYPE instance /*!< The instance number*/
+                    );
+            //! Reserve table entries for a list of channels. Channels that
+            //! are not reserved claim an entry on their first write.
+            //! Call before any telemetry is written.
+            void setChannelList(
+                    const FwChanIdType* ids, /*!< channel ids*/
+                    NATIVE_UINT_TYPE numIds /*!< number of channel ids*/
+                    );
+
+            enum {
+                EMPTY_ID = 0xFFFFFFFF //!< id marking an unclaimed entry. Not a valid channel id.
+            };
+
+        PRIVATE:
+
+            // Port functions
+            void TlmRecv_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val);
+            void TlmGet_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val);
+            void Run_handler(NATIVE_INT_TYPE portNum, NATIVE_UINT_TYPE context);
+            //! Handler implementation for pingIn
+            //!
+            void pingIn_handler(
+                const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                U32 key /*!< Value to return to pinger*/
+            );
+
+            struct EntryData {
+                volatile FwChanIdType id; //!< telemetry id stored in entry, or EMPTY_ID
+                volatile U32 sequence; //!< sequence lock. Odd while a write is in progress.
+                volatile U32 updated; //!< set when a value has been written since the last downlink
+                Fw::Time lastUpdate; //!< last updated time
+                NATIVE_UINT_TYPE length; //!< length of stored value
+                U8 data[FW_TLM_BUFFER_MAX_SIZE]; //!< serialized telemetry value
+            };
+
+            //! Entries are aligned to the cache line, which also rounds their size
+            //! up to a multiple of it, so writers of neighboring entries never
+            //! share a line. The component instance must be statically allocated
+            //! (or otherwise suitably aligned) for this to hold.
+            typedef struct tlmEntry {
+                EntryData d; //!< entry contents
+            } __attribute__((aligned(TLMCHAN_LOCKLESS_CACHE_LINE))) TlmEntry;
+
+            TlmEntry m_entries[TLMCHAN_LOCKLESS_TABLE_SIZE]; //!< open-addressed table
+
+            //! Find the entry for a channel
+            //! \return the entry, or NULL if the channel has no entry
+            TlmEntry* findEntry(FwChanIdType id, bool claim);
+            //! Read a consistent copy of an entry
+            void readEntry(TlmEntry& entry, Fw::Time& timeTag, Fw::TlmBuffer& val);
+
+            // work variables
+            Fw::ComBuffer m_comBuffer;
+            Fw::TlmPacket m_tlmPacket;
+            Fw::TlmBuffer m_tlmBuffer;
+
+    };
+
+}
+
+#endif /* TLMCHANLOCKLESSIMPL_HPP_ */
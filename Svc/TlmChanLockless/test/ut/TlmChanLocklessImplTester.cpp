@@ -0,0 +1,238 @@
+/*
+ * TlmChanLocklessImplTester.cpp
+ *
+ */
+
+#include <Svc/TlmChanLockless/test/ut/TlmChanLocklessImplTester.hpp>
+#include <Fw/Com/ComBuffer.hpp>
+#include <Fw/Com/ComPacket.hpp>
+#include <Fw/Types/EightyCharString.hpp>
+#include <Os/Task.hpp>
+
+#include <gtest/gtest.h>
+
+
+namespace Svc {
+
+    namespace {
+        enum {
+            CONCURRENT_ID = 0x200, //!< channel written by the writer task
+            CONCURRENT_WRITES = 100000 //!< number of writes made by the writer task
+        };
+    }
+
+    void TlmChanLocklessImplTester::init(NATIVE_INT_TYPE instance) {
+        TlmChanLocklessGTestBase::init();
+    }
+
+    void TlmChanLocklessImplTester::from_PktSend_handler(NATIVE_INT_TYPE portNum, Fw::ComBuffer &data, U32 context) {
+        this->m_bufferRecv = true;
+        this->m_rcvdBuffer[this->m_numBuffs] = data;
+        this->m_numBuffs++;
+    }
+
+    TlmChanLocklessImplTester::TlmChanLocklessImplTester(Svc::TlmChanLocklessImpl& inst) :
+        TlmChanLocklessGTestBase("testerbase",100),
+            m_impl(inst),
+            m_numBuffs(0),
+            m_bufferRecv(false) {
+    }
+
+    TlmChanLocklessImplTester::~TlmChanLocklessImplTester() {
+    }
+
+    bool TlmChanLocklessImplTester::doRun(bool check) {
+        // execute run port to send packet
+        this->invoke_to_Run(0,0);
+        // dispatch run message
+        this->m_bufferRecv = false;
+        this->m_impl.doDispatch();
+        if (check) {
+            EXPECT_TRUE(this->m_bufferRecv);
+        }
+        return this->m_bufferRecv;
+    }
+
+    void TlmChanLocklessImplTester::checkBuff(FwChanIdType id, U32 val) {
+        Fw::SerializeStatus stat;
+        bool packetFound = false;
+
+        // Search for channel ID
+        for (NATIVE_UINT_TYPE packet = 0; packet < this->m_numBuffs; packet++) {
+            this->m_rcvdBuffer[packet].resetDeser();
+            // first piece should be tlm packet descriptor
+            FwPacketDescriptorType desc;
+            stat = this->m_rcvdBuffer[packet].deserialize(desc);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+            ASSERT_EQ(desc,(FwPacketDescriptorType)Fw::ComPacket::FW_PACKET_TELEM);
+            // next piece should be channel ID
+            FwChanIdType sentId;
+            stat = this->m_rcvdBuffer[packet].deserialize(sentId);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+
+            if (sentId != id) {
+                continue;
+            }
+            packetFound = true;
+            // next piece is time tag
+            Fw::Time recTimeTag(TB_NONE,0,0);
+            stat = this->m_rcvdBuffer[packet].deserialize(recTimeTag);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+            // next piece is channel value
+            U32 readVal;
+            stat = this->m_rcvdBuffer[packet].deserialize(readVal);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+            ASSERT_EQ(readVal, val);
+            // packet should be empty
+            ASSERT_EQ(this->m_rcvdBuffer[packet].getBuffLeft(),(NATIVE_UINT_TYPE)0);
+        }
+
+        ASSERT_TRUE(packetFound);
+    }
+
+    void TlmChanLocklessImplTester::sendBuff(FwChanIdType id, U32 val) {
+
+        Fw::TlmBuffer buff;
+        Fw::TlmBuffer readBack;
+        Fw::SerializeStatus stat;
+        Fw::Time timeTag;
+        U32 retestVal;
+
+        // create telemetry item
+        buff.resetSer();
+        stat = buff.serialize(val);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+
+        this->invoke_to_TlmRecv(0,id,timeTag,buff);
+
+        // Read back value
+        this->invoke_to_TlmGet(0,id,timeTag,readBack);
+        retestVal = 0;
+        readBack.deserialize(retestVal);
+        ASSERT_EQ(retestVal, val);
+    }
+
+    void TlmChanLocklessImplTester::runNominalChannel(void) {
+
+        // each entry should start on its own cache line
+        ASSERT_EQ(0u,sizeof(TlmChanLocklessImpl::TlmEntry) % TLMCHAN_LOCKLESS_CACHE_LINE);
+        for (NATIVE_UINT_TYPE entry = 0; entry < TLMCHAN_LOCKLESS_TABLE_SIZE; entry++) {
+            ASSERT_EQ(0u,reinterpret_cast<POINTER_CAST>(&this->m_impl.m_entries[entry]) % TLMCHAN_LOCKLESS_CACHE_LINE);
+        }
+
+        this->clearBuffs();
+        // send first buffer
+        this->sendBuff(27,10);
+        this->doRun(true);
+        this->checkBuff(27,10);
+
+        // no update, so nothing sent
+        this->clearBuffs();
+        ASSERT_FALSE(this->doRun(false));
+
+        // do an update to make sure it gets updated and returned correctly
+        this->clearBuffs();
+        this->sendBuff(27,20);
+        this->doRun(true);
+        this->checkBuff(27,20);
+    }
+
+    void TlmChanLocklessImplTester::runMultiChannel(void) {
+
+        FwChanIdType IDs[] = {
+                0x1000,0x1001,0x1002,0x1003,0x1004,0x1005,0x1100,0x1101,0x1102,0x1103,0x300,0x301,0x400,0x401,0x402,0x100,0x101,0x102,0x103,0x104,0x105
+        };
+
+        // reserve half the channels up front, the rest claim on write
+        this->m_impl.setChannelList(IDs,FW_NUM_ARRAY_ELEMENTS(IDs)/2);
+
+        this->clearBuffs();
+        // send all updates
+        for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+            this->sendBuff(IDs[n],n);
+        }
+
+        // do a run, and all the packets should be sent
+        this->doRun(true);
+        ASSERT_EQ(this->m_numBuffs,FW_NUM_ARRAY_ELEMENTS(IDs));
+
+        // verify packets
+        for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+            this->checkBuff(IDs[n],n);
+        }
+    }
+
+    void TlmChanLocklessImplTester::runOffNominal(void) {
+
+        // Ask for a packet that isn't written yet
+        Fw::TlmBuffer buff;
+        Fw::SerializeStatus stat;
+        Fw::Time timeTag;
+        U32 val = 10;
+
+        // create telemetry item and put dummy data in to make sure it gets erased
+        buff.resetSer();
+        stat = buff.serialize(val);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+
+        // Read back value
+        this->invoke_to_TlmGet(0,10,timeTag,buff);
+        ASSERT_EQ((NATIVE_UINT_TYPE)0,buff.getBuffLength());
+    }
+
+    void TlmChanLocklessImplTester::writerTask(void* ptr) {
+        TlmChanLocklessImplTester* tester = static_cast<TlmChanLocklessImplTester*>(ptr);
+        Fw::TlmBuffer buff;
+        Fw::Time timeTag;
+        // write a value and its complement so a torn read can be detected
+        for (U32 n = 1; n <= CONCURRENT_WRITES; n++) {
+            buff.resetSer();
+            buff.serialize(n);
+            buff.serialize(~n);
+            tester->invoke_to_TlmRecv(0,CONCURRENT_ID,timeTag,buff);
+        }
+    }
+
+    void TlmChanLocklessImplTester::runConcurrentReadWrite(void) {
+
+        Os::Task writer;
+        Fw::EightyCharString name("TlmWriter");
+        ASSERT_EQ(Os::Task::TASK_OK,writer.start(name,0,100,10*1024,writerTask,this));
+
+        // read while the writer is running; every read must be consistent
+        U32 last = 0;
+        while (last < CONCURRENT_WRITES) {
+            Fw::TlmBuffer buff;
+            Fw::Time timeTag;
+            this->invoke_to_TlmGet(0,CONCURRENT_ID,timeTag,buff);
+            if (buff.getBuffLength() == 0) {
+                continue;
+            }
+            U32 val, comp;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(val));
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(comp));
+            ASSERT_EQ(val,~comp);
+            // values never go backwards
+            ASSERT_GE(val,last);
+            last = val;
+        }
+
+        ASSERT_EQ(Os::Task::TASK_OK,writer.join(NULL));
+    }
+
+    void TlmChanLocklessImplTester::clearBuffs(void) {
+        this->m_numBuffs = 0;
+        for (NATIVE_INT_TYPE n = 0; n < TLMCHAN_LOCKLESS_TABLE_SIZE; n++) {
+            this->m_rcvdBuffer[n].resetSer();
+        }
+    }
+
+    void TlmChanLocklessImplTester ::
+      from_pingOut_handler(
+          const NATIVE_INT_TYPE portNum,
+          U32 key
+      )
+    {
+      this->pushFromPortEntry_pingOut(key);
+    }
+} /* namespace Svc */
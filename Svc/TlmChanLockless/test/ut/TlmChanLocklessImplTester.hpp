@@ -0,0 +1,54 @@
+/*
+ * TlmChanLocklessImplTester.hpp
+ *
+ */
+
+#ifndef TLMCHANLOCKLESS_TEST_UT_TLMCHANLOCKLESSIMPLTESTER_HPP_
+#define TLMCHANLOCKLESS_TEST_UT_TLMCHANLOCKLESSIMPLTESTER_HPP_
+
+#include <GTestBase.hpp>
+#include <Svc/TlmChanLockless/TlmChanLocklessImpl.hpp>
+
+namespace Svc {
+
+    class TlmChanLocklessImplTester: public TlmChanLocklessGTestBase {
+        public:
+            TlmChanLocklessImplTester(Svc::TlmChanLocklessImpl& inst);
+            virtual ~TlmChanLocklessImplTester();
+
+            void init(NATIVE_INT_TYPE instance = 0);
+
+            void runNominalChannel(void);
+            void runMultiChannel(void);
+            void runOffNominal(void);
+            void runConcurrentReadWrite(void);
+
+        private:
+            Svc::TlmChanLocklessImpl& m_impl;
+
+            void from_PktSend_handler(NATIVE_INT_TYPE portNum, Fw::ComBuffer &data, U32 context);
+
+            // helper
+            void sendBuff(FwChanIdType id, U32 val);
+            bool doRun(bool check);
+            void checkBuff(FwChanIdType id, U32 val);
+            static void writerTask(void* ptr);
+
+            // Keep a history
+            NATIVE_UINT_TYPE m_numBuffs;
+            Fw::ComBuffer m_rcvdBuffer[TLMCHAN_LOCKLESS_TABLE_SIZE];
+            bool m_bufferRecv;
+            void clearBuffs(void);
+
+            //! Handler for from_pingOut
+            //!
+            void from_pingOut_handler(
+                const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                U32 key /*!< Value to return to pinger*/
+            );
+
+    };
+
+} /* namespace Svc */
+
+#endif /* TLMCHANLOCKLESS_TEST_UT_TLMCHANLOCKLESSIMPLTESTER_HPP_ */
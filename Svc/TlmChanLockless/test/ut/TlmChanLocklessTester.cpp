@@ -0,0 +1,75 @@
+/*
+ * TlmChanLocklessTester.cpp
+ *
+ */
+
+#include <Svc/TlmChanLockless/test/ut/TlmChanLocklessImplTester.hpp>
+#include <Svc/TlmChanLockless/TlmChanLocklessImpl.hpp>
+#include <Fw/Obj/SimpleObjRegistry.hpp>
+#include <gtest/gtest.h>
+
+#if FW_OBJECT_REGISTRATION == 1
+static Fw::SimpleObjRegistry simpleReg;
+#endif
+
+void connectPorts(Svc::TlmChanLocklessImpl& impl, Svc::TlmChanLocklessImplTester& tester) {
+
+    // connect ports
+    tester.connect_to_TlmRecv(0,impl.get_TlmRecv_InputPort(0));
+    tester.connect_to_TlmGet(0,impl.get_TlmGet_InputPort(0));
+    tester.connect_to_Run(0,impl.get_Run_InputPort(0));
+    impl.set_PktSend_OutputPort(0,tester.get_from_PktSend(0));
+}
+
+
+TEST(TlmChanLocklessTest,NominalChannelTest) {
+
+    Svc::TlmChanLocklessImpl impl("TlmChanLocklessImpl");
+    impl.init(10,0);
+    Svc::TlmChanLocklessImplTester tester(impl);
+    tester.init();
+    connectPorts(impl,tester);
+
+    tester.runNominalChannel();
+}
+
+TEST(TlmChanLocklessTest,MultiChannelTest) {
+
+    Svc::TlmChanLocklessImpl impl("TlmChanLocklessImpl");
+    impl.init(10,0);
+    Svc::TlmChanLocklessImplTester tester(impl);
+    tester.init();
+    connectPorts(impl,tester);
+
+    tester.runMultiChannel();
+}
+
+TEST(TlmChanLocklessTest,OffNominal) {
+
+    Svc::TlmChanLocklessImpl impl("TlmChanLocklessImpl");
+    impl.init(10,0);
+    Svc::TlmChanLocklessImplTester tester(impl);
+    tester.init();
+    connectPorts(impl,tester);
+
+    tester.runOffNominal();
+}
+
+TEST(TlmChanLocklessTest,ConcurrentReadWrite) {
+
+    Svc::TlmChanLocklessImpl impl("TlmChanLocklessImpl");
+    impl.init(10,0);
+    Svc::TlmChanLocklessImplTester tester(impl);
+    tester.init();
+    connectPorts(impl,tester);
+
+    tester.runConcurrentReadWrite();
+}
+
+#ifndef TGT_OS_TYPE_VXWORKS
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
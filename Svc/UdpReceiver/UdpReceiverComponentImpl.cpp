@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <arpa/inet.h>
 #include <Fw/Types/EightyCharString.hpp>
 
@@ -133,13 +134,49 @@ namespace Svc {
       }
   }
 
+#ifdef TGT_OS_TYPE_LINUX
+  Os::Reactor::ReactorStatus UdpReceiverComponentImpl::registerWithReactor(Os::Reactor& reactor) {
+      return reactor.add(this->m_fd, this);
+  }
+
+  void UdpReceiverComponentImpl::readable(void) {
+
+      // receive every waiting packet, up to a batch, straight into the receive buffers
+      struct mmsghdr msgs[UDP_RECEIVER_BATCH_SIZE];
+      struct iovec iov[UDP_RECEIVER_BATCH_SIZE];
+      memset(msgs, 0, sizeof(msgs));
+      for (NATIVE_UINT_TYPE i = 0; i < UDP_RECEIVER_BATCH_SIZE; i++) {
+          iov[i].iov_base = this->m_recvBuffs[i].getBuffAddr();
+          iov[i].iov_len = this->m_recvBuffs[i].getBuffCapacity();
+          msgs[i].msg_hdr.msg_iov = &iov[i];
+          msgs[i].msg_hdr.msg_iovlen = 1;
+      }
+      NATIVE_INT_TYPE count = recvmmsg(
+              this->m_fd,
+              msgs,
+              UDP_RECEIVER_BATCH_SIZE,
+              MSG_DONTWAIT,
+              0);
+      if (-1 == count) {
+          if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK) {
+              Fw::LogStringArg arg(strerror(errno));
+              this->log_WARNING_HI_UR_RecvError(arg);
+          }
+          return;
+      }
+      for (NATIVE_INT_TYPE i = 0; i < count; i++) {
+          this->processPacket(this->m_recvBuffs[i], msgs[i].msg_len);
+      }
+  }
+#endif
+
   void UdpReceiverComponentImpl::doRecv(void) {
 
       // wait for data from the socket
       NATIVE_INT_TYPE psize = recvfrom(
               this->m_fd,
-              this->m_recvBuff.getBuffAddr(),
-              this->m_recvBuff.getBuffCapacity(),
+              this->m_recvBuffs[0].getBuffAddr(),
+              this->m_recvBuffs[0].getBuffCapacity(),
               MSG_WAITALL,
               0,
               0);
@@ -150,13 +187,18 @@ namespace Svc {
           }
           return;
       }
+      this->processPacket(this->m_recvBuffs[0], psize);
+  }
+
+  void UdpReceiverComponentImpl::processPacket(UdpSerialBuffer& recvBuff, NATIVE_INT_TYPE psize) {
+
       // reset buffer for deserialization
-      Fw::SerializeStatus stat = this->m_recvBuff.setBuffLen(psize);
+      Fw::SerializeStatus stat = recvBuff.setBuffLen(psize);
       FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, stat);
 
       // get sequence number
       U8 seqNum;
-      stat = this->m_recvBuff.deserialize(seqNum);
+      stat = recvBuff.deserialize(seqNum);
       // check for deserialization error or port number too high
       if (stat != Fw::FW_SERIALIZE_OK) {
           this->log_WARNING_HI_UR_DecodeError(DECODE_SEQ,stat);
@@ -184,7 +226,7 @@ namespace Svc {
 
       // get port number
       U8 portNum;
-      stat = this->m_recvBuff.deserialize(portNum);
+      stat = recvBuff.deserialize(portNum);
       // check for deserialization error or port number too high
       if (stat != Fw::FW_SERIALIZE_OK or portNum > this->getNum_PortsOut_OutputPorts()) {
           this->log_WARNING_HI_UR_DecodeError(DECODE_PORT,stat);
@@ -193,7 +235,7 @@ namespace Svc {
       }
       // get buffer for port
 
-      stat = this->m_recvBuff.deserialize(this->m_portBuff);
+      stat = recvBuff.deserialize(this->m_portBuff);
       if (stat != Fw::FW_SERIALIZE_OK) {
           this->log_WARNING_HI_UR_DecodeError(DECODE_BUFFER,stat);
           this->m_decodeErrors++;
@@ -15,11 +15,15 @@
 
 #include "Svc/UdpReceiver/UdpReceiverComponentAc.hpp"
 #include "UdpReceiverComponentImplCfg.hpp"
+#include <Os/Reactor.hpp>
 
 namespace Svc {
 
   class UdpReceiverComponentImpl :
     public UdpReceiverComponentBase
+#ifdef TGT_OS_TYPE_LINUX
+    ,public Os::Reactor::Handler
+#endif
   {
 
     public:
@@ -56,6 +60,16 @@ namespace Svc {
               NATIVE_UINT_TYPE affinity /*!< cpu affinity */
       );
 
+#ifdef TGT_OS_TYPE_LINUX
+      //! receive from a shared reactor task instead of a worker thread
+      Os::Reactor::ReactorStatus registerWithReactor(
+              Os::Reactor& reactor /*!< reactor to receive from */
+      );
+
+      //! called by the reactor when packets are waiting
+      void readable(void);
+#endif
+
 
     PRIVATE:
 
@@ -119,7 +133,9 @@ namespace Svc {
           // Should be the max of all the input ports serialized sizes...
           U8 m_buff[UDP_RECEIVER_MSG_SIZE];
 
-      } m_recvBuff;
+      } m_recvBuffs[UDP_RECEIVER_BATCH_SIZE]; //!< receive buffers. doRecv uses only the first.
+
+      void processPacket(UdpSerialBuffer& recvBuff, NATIVE_INT_TYPE psize); //!< decodes a received packet
 
       UdpSerialBuffer m_portBuff; //!< working buffer for decoding packets
 
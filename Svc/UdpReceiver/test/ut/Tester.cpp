@@ -18,6 +18,7 @@
 #include <unistd.h>
 #include <sys/socket.h>
 #include <arpa/inet.h>
+#include <Os/Reactor.hpp>
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 10
@@ -79,6 +80,43 @@ namespace Svc {
 
   }
 
+#ifdef TGT_OS_TYPE_LINUX
+  void Tester::reactorTest(const char* port) {
+
+      this->component.open(port);
+
+      Os::Reactor reactor;
+      ASSERT_EQ(Os::Reactor::REACTOR_OK,reactor.create());
+      ASSERT_EQ(Os::Reactor::REACTOR_OK,this->component.registerWithReactor(reactor));
+
+      // send more packets than one batch holds
+
+      const NATIVE_UINT_TYPE packets = UDP_RECEIVER_BATCH_SIZE + 4;
+      for (NATIVE_UINT_TYPE packet = 0; packet < packets; packet++) {
+          this->sendPacket(100 + packet,"127.0.0.1",port,packet,2);
+      }
+
+      // the first wakeup takes a full batch, the second the rest
+
+      this->m_recvCount = 0;
+      ASSERT_EQ(Os::Reactor::REACTOR_OK,reactor.poll(1000));
+      EXPECT_EQ(UDP_RECEIVER_BATCH_SIZE,this->m_recvCount);
+      ASSERT_EQ(Os::Reactor::REACTOR_OK,reactor.poll(1000));
+      EXPECT_EQ(packets,this->m_recvCount);
+      EXPECT_EQ(100 + packets - 1,this->m_sentVal);
+      EXPECT_EQ(2,this->m_sentPort);
+      EXPECT_EQ(0U,this->component.m_packetsDropped);
+      EXPECT_EQ(packets,this->component.m_packetsReceived);
+
+      // nothing left
+
+      ASSERT_EQ(Os::Reactor::REACTOR_OK,reactor.poll(0));
+      EXPECT_EQ(packets,this->m_recvCount);
+
+      ASSERT_EQ(Os::Reactor::REACTOR_OK,reactor.remove(this->component.m_fd));
+  }
+#endif
+
 
   // ----------------------------------------------------------------------
   // Handlers for serial from ports
@@ -91,6 +129,7 @@ namespace Svc {
     )
   {
       this->m_sentPort = portNum;
+      this->m_recvCount++;
       EXPECT_EQ(Fw::FW_SERIALIZE_OK,Buffer.deserialize(this->m_sentVal));
 
   }
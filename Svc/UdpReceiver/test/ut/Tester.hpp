@@ -50,6 +50,11 @@ namespace Svc {
       //!
       void recvTest(const char* port);
 
+#ifdef TGT_OS_TYPE_LINUX
+      //! Receive a burst of packets from a reactor
+      void reactorTest(const char* port);
+#endif
+
     private:
 
       // ----------------------------------------------------------------------
@@ -93,6 +98,7 @@ namespace Svc {
       // stored port call arguments
       U32 m_sentVal;
       NATIVE_INT_TYPE m_sentPort;
+      NATIVE_UINT_TYPE m_recvCount; //!< number of port calls received
 
       void textLogIn(
                 const FwEventIdType id, //!< The event ID
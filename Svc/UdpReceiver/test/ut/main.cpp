@@ -19,6 +19,17 @@ TEST(Nominal,RecvPacket) {
 
 }
 
+#ifdef TGT_OS_TYPE_LINUX
+TEST(Nominal,ReactorBurst) {
+
+    COMMENT("Receive a burst of packets from a reactor");
+
+    Svc::Tester tester;
+    tester.reactorTest("50001");
+
+}
+#endif
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -7,6 +7,12 @@
 //!
 //! #include <Utils/Hash/openssl/SHA256.hpp>
 //!
+//! The CRC32 implementation can also be configured here. To compute
+//! the CRC one byte at a time with lib_crc instead of with the
+//! slice-by-8 tables, define:
+//!
+//! #define HASH_CRC32_SLICE_BY_8 0
+//!
 #include <Utils/Hash/libcrc/CRC32.hpp>
 
 #endif
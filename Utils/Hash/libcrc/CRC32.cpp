@@ -11,9 +11,56 @@
 // ====================================================================== 
 
 #include <Utils/Hash/Hash.hpp>
+#if HASH_CRC32_SLICE_BY_8
+#include <Utils/Hash/libcrc/CRC32Tables.hpp>
+#endif
 
 namespace Utils {
 
+    namespace {
+
+        //! Fold a block of data into a running CRC32 value
+        U32 updateCrc(U32 crc, const U8* data, NATIVE_UINT_TYPE len)
+        {
+#if HASH_CRC32_SLICE_BY_8
+            // eight bytes at a time. Words are assembled from bytes so the
+            // result doesn't depend on alignment or byte order.
+            while (len >= 8) {
+                U32 one = crc ^ (static_cast<U32>(data[0]) |
+                                 (static_cast<U32>(data[1]) << 8) |
+                                 (static_cast<U32>(data[2]) << 16) |
+                                 (static_cast<U32>(data[3]) << 24));
+                U32 two = static_cast<U32>(data[4]) |
+                          (static_cast<U32>(data[5]) << 8) |
+                          (static_cast<U32>(data[6]) << 16) |
+                          (static_cast<U32>(data[7]) << 24);
+                crc = crc32Tables[7][one & 0xFF] ^
+                      crc32Tables[6][(one >> 8) & 0xFF] ^
+                      crc32Tables[5][(one >> 16) & 0xFF] ^
+                      crc32Tables[4][one >> 24] ^
+                      crc32Tables[3][two & 0xFF] ^
+                      crc32Tables[2][(two >> 8) & 0xFF] ^
+                      crc32Tables[1][(two >> 16) & 0xFF] ^
+                      crc32Tables[0][two >> 24];
+                data += 8;
+                len -= 8;
+            }
+            // remaining bytes
+            while (len > 0) {
+                crc = (crc >> 8) ^ crc32Tables[0][(crc ^ *data) & 0xFF];
+                data++;
+                len--;
+            }
+#else
+            for (NATIVE_UINT_TYPE index = 0; index < len; index++) {
+                crc = update_crc_32(crc, static_cast<char>(data[index]));
+            }
+#endif
+            return crc;
+        }
+
+    }
+
     Hash :: 
         Hash()
     {
@@ -31,11 +78,8 @@ namespace Utils {
         HASH_HANDLE_TYPE local_hash_handle;
         local_hash_handle = 0xffffffffL;
         FW_ASSERT(data);
-        char c;
-        for(int index = 0; index < len; index++) {
-            c = ((char*)data)[index];
-            local_hash_handle = update_crc_32(local_hash_handle, c); 
-        }
+        FW_ASSERT(len >= 0, len);
+        local_hash_handle = updateCrc(local_hash_handle, static_cast<const U8*>(data), len);
         HashBuffer bufferOut;
         // For CRC32 we need to return the one's compliment of the result:
         Fw::SerializeStatus status = bufferOut.serialize(~(local_hash_handle));
@@ -53,11 +97,8 @@ namespace Utils {
         update(const void *const data, NATIVE_INT_TYPE len)
     {
         FW_ASSERT(data);
-        char c;
-        for(int index = 0; index < len; index++) {
-            c = ((char*)data)[index];
-            this->hash_handle = update_crc_32(this->hash_handle, c);
-        }
+        FW_ASSERT(len >= 0, len);
+        this->hash_handle = updateCrc(this->hash_handle, static_cast<const U8*>(data), len);
     }
     
     void Hash :: 
@@ -6,6 +6,14 @@ extern "C" {
     #include <Utils/Hash/libcrc/lib_crc.h>
 }
 
+//! Select how the CRC is computed. When set to 1, eight bytes are folded
+//! into the CRC per step using the slice-by-8 tables in CRC32Tables.hpp.
+//! When set to 0, the CRC is computed one byte at a time with lib_crc.
+//! Both produce the same value.
+#ifndef HASH_CRC32_SLICE_BY_8
+#define HASH_CRC32_SLICE_BY_8 1
+#endif
+
 //! Define the hash handle type for this 
 //! implementation. This is required.
 #ifndef HASH_HANDLE_TYPE
@@ -19,6 +19,7 @@
 #endif
 
 #include <stdio.h>
+#include <string.h>
 
 
 namespace Types {
@@ -40,15 +41,8 @@ NATIVE_UINT_TYPE CircularBuffer :: get_remaining_size(bool serialization) {
 }
 
 U8* CircularBuffer :: increment(U8* const pointer, NATIVE_UINT_TYPE amount) {
-    U8* ret = pointer;
-    //TODO: need O(1) implementation here
-    for (NATIVE_UINT_TYPE i = 0; i < amount; i++) {
-        ret = ret + 1;
-        if (ret >= (m_store + m_size)) {
-            ret = m_store;
-        }
-    }
-    return ret;
+    const NATIVE_UINT_TYPE index = static_cast<NATIVE_UINT_TYPE>(pointer - m_store);
+    return m_store + ((index + (amount % m_size)) % m_size);
 }
 
 Fw::SerializeStatus CircularBuffer :: serialize(const U8* const buffer, const NATIVE_UINT_TYPE size) {
@@ -59,15 +53,15 @@ Fw::SerializeStatus CircularBuffer :: serialize(const U8* const buffer, const NA
     if (size > get_remaining_size(true)) {
         return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
     }
-    // Copy in all the supplied data
-    for (U32 i = 0; i < size; i++) {
-        *m_tail = buffer[i];
-        // Wrap-around increment of tail
-        m_tail = increment(m_tail);
-        FW_ASSERT(m_tail != m_head,
-                reinterpret_cast<POINTER_CAST>(m_tail),
-                reinterpret_cast<POINTER_CAST>(m_head));
-    }
+    // Copy in all the supplied data, up to the end of the store then wrapping to the start
+    const NATIVE_UINT_TYPE to_end = static_cast<NATIVE_UINT_TYPE>((m_store + m_size) - m_tail);
+    const NATIVE_UINT_TYPE first_size = (size < to_end) ? size : to_end;
+    memcpy(m_tail, buffer, first_size);
+    memcpy(m_store, buffer + first_size, size - first_size);
+    m_tail = increment(m_tail, size);
+    FW_ASSERT(size == 0 || m_tail != m_head,
+            reinterpret_cast<POINTER_CAST>(m_tail),
+            reinterpret_cast<POINTER_CAST>(m_head));
     ASSERT_CONSISTENT(m_store, m_size, m_head);
     ASSERT_CONSISTENT(m_store, m_size, m_tail);
     return Fw::FW_SERIALIZE_OK;
@@ -120,16 +114,36 @@ Fw::SerializeStatus CircularBuffer :: peek(U8* buffer, NATIVE_UINT_TYPE size, NA
     if ((size + offset) > get_remaining_size(false)) {
         return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
     }
-    U8* peeker = m_head;
-    peeker = increment(peeker, offset);
-    // Deserialize all the bytes from network format
-    for (NATIVE_UINT_TYPE i = 0; i < size; i++) {
-        *buffer = *peeker;
-        peeker = increment(peeker);
-        buffer = buffer + 1;
+    const U8* first = NULL;
+    const U8* second = NULL;
+    NATIVE_UINT_TYPE first_size = 0;
+    NATIVE_UINT_TYPE second_size = 0;
+    Fw::SerializeStatus status = peek_spans(size, offset, first, first_size, second, second_size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    // Copy out each contiguous span
+    memcpy(buffer, first, first_size);
+    if (second_size > 0) {
+        memcpy(buffer + first_size, second, second_size);
     }
+    return Fw::FW_SERIALIZE_OK;
+}
+
+Fw::SerializeStatus CircularBuffer :: peek_spans(NATIVE_UINT_TYPE size, NATIVE_UINT_TYPE offset,
+                                                 const U8*& first, NATIVE_UINT_TYPE& first_size,
+                                                 const U8*& second, NATIVE_UINT_TYPE& second_size) {
+    // Check that the head and tail pointers are consistent
     ASSERT_CONSISTENT(m_store, m_size, m_head);
     ASSERT_CONSISTENT(m_store, m_size, m_tail);
+    // Check there is sufficient data
+    if ((size + offset) > get_remaining_size(false)) {
+        return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+    }
+    U8* start = increment(m_head, offset);
+    const NATIVE_UINT_TYPE to_end = static_cast<NATIVE_UINT_TYPE>((m_store + m_size) - start);
+    first = start;
+    first_size = (size < to_end) ? size : to_end;
+    second_size = size - first_size;
+    second = (second_size > 0) ? m_store : NULL;
     return Fw::FW_SERIALIZE_OK;
 }
 
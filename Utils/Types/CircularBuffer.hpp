@@ -71,6 +71,21 @@ class CircularBuffer {
          */
         Fw::SerializeStatus peek(U8* buffer, NATIVE_UINT_TYPE size, NATIVE_UINT_TYPE offset = 0);
 
+        /**
+         * Expose data in place without copying and without moving the head pointer. Data that wraps
+         * around the end of the data store is returned as two contiguous spans, otherwise the
+         * second span is empty (NULL and zero size). Spans are valid until the next rotate.
+         * \param NATIVE_UINT_TYPE size: number of bytes to expose
+         * \param NATIVE_UINT_TYPE offset: offset from the head pointer
+         * \param const U8*& first: start of the first span
+         * \param NATIVE_UINT_TYPE& first_size: size of the first span
+         * \param const U8*& second: start of the second span, at the start of the data store
+         * \param NATIVE_UINT_TYPE& second_size: size of the second span
+         */
+        Fw::SerializeStatus peek_spans(NATIVE_UINT_TYPE size, NATIVE_UINT_TYPE offset,
+                                       const U8*& first, NATIVE_UINT_TYPE& first_size,
+                                       const U8*& second, NATIVE_UINT_TYPE& second_size);
+
         /**
          * Rotate the head pointer effectively erasing data from the circular buffer and making
          * space. Cannot rotate more than the available space.
@@ -78,7 +78,7 @@ namespace Types {
         else if (state.getPeekType() == 2) {
             return peek_available >= sizeof(U32) + state.getPeekOffset();
         }
-        else if (state.getPeekType() == 3) {
+        else if (state.getPeekType() == 3 || state.getPeekType() == 4) {
             return peek_available >= state.getRandomSize() + state.getPeekOffset();
         }
         return false;
@@ -122,6 +122,27 @@ namespace Types {
                 ASSERT_EQ(buffer[i], peek_buffer[i]);
             }
         }
+        else if (state.getPeekType() == 4) {
+            const U8* first = NULL;
+            const U8* second = NULL;
+            NATIVE_UINT_TYPE first_size = 0;
+            NATIVE_UINT_TYPE second_size = 0;
+            ASSERT_TRUE(state.peek(buffer, state.getRandomSize(), state.getPeekOffset()));
+            ASSERT_EQ(state.getTestBuffer().peek_spans(state.getRandomSize(), state.getPeekOffset(),
+                                                       first, first_size, second, second_size),
+                      Fw::FW_SERIALIZE_OK);
+            // Spans cover the data exactly, splitting only on wrap-around
+            ASSERT_EQ(first_size + second_size, state.getRandomSize());
+            if (second_size > 0) {
+                ASSERT_TRUE(second != NULL);
+            }
+            for (NATIVE_UINT_TYPE i = 0; i < first_size; i++) {
+                ASSERT_EQ(buffer[i], first[i]);
+            }
+            for (NATIVE_UINT_TYPE i = 0; i < second_size; i++) {
+                ASSERT_EQ(buffer[first_size + i], second[i]);
+            }
+        }
         else {
             ASSERT_TRUE(false); // Fail the test, bad type
         }
@@ -143,7 +164,7 @@ namespace Types {
         else if (state.getPeekType() == 2) {
             return peek_available < sizeof(U32) + state.getPeekOffset();
         }
-        else if (state.getPeekType() == 3) {
+        else if (state.getPeekType() == 3 || state.getPeekType() == 4) {
             return peek_available < state.getRandomSize() + state.getPeekOffset();
         }
         return false;
@@ -168,6 +189,15 @@ namespace Types {
             ASSERT_EQ(state.getTestBuffer().peek(peek_buffer, state.getRandomSize(), state.getPeekOffset()),
                       Fw::FW_DESERIALIZE_BUFFER_EMPTY);
         }
+        else if (state.getPeekType() == 4) {
+            const U8* first = NULL;
+            const U8* second = NULL;
+            NATIVE_UINT_TYPE first_size = 0;
+            NATIVE_UINT_TYPE second_size = 0;
+            ASSERT_EQ(state.getTestBuffer().peek_spans(state.getRandomSize(), state.getPeekOffset(),
+                                                       first, first_size, second, second_size),
+                      Fw::FW_DESERIALIZE_BUFFER_EMPTY);
+        }
         else {
             ASSERT_TRUE(false); // Fail the test, bad type
         }
@@ -31,7 +31,7 @@ namespace MockTypes {
             /**
              * Sets the random settings
              * @param random: random size
-             * @param peek_type: peek type (0-3)
+             * @param peek_type: peek type (0-4)
              * @param peek_offset: offset size
              */
             void setRandom(NATIVE_UINT_TYPE random, NATIVE_UINT_TYPE peek_type, NATIVE_UINT_TYPE peek_offset);
@@ -125,6 +125,8 @@ TEST(CircularBufferTests, BasicPeekTest) {
     peekOk.apply(state);
     state.setRandom(sizeof(buffer), 3, 6);
     peekOk.apply(state);
+    state.setRandom(sizeof(buffer), 4, 6);
+    peekOk.apply(state);
 }
 
 /**
@@ -143,6 +145,8 @@ TEST(CircularBufferTests, BasicPeekBadTest) {
     peekBad.apply(state);
     state.setRandom(1024, 3, 6);
     peekBad.apply(state);
+    state.setRandom(1024, 4, 6);
+    peekBad.apply(state);
 }
 
 /**
@@ -0,0 +1,140 @@
+// ====================================================================== 
+// \title  HashTester.cpp
+// \brief  cpp file for Hash test harness implementation class
+//
+// \copyright
+//
+// Copyright (C) 2009-2020 California Institute of Technology.
+//
+// ALL RIGHTS RESERVED. United States Government Sponsorship
+// acknowledged.
+// ====================================================================== 
+
+#include "HashTester.hpp"
+#include <Os/IntervalTimer.hpp>
+#include <stdio.h>
+#include <stdlib.h>
+
+extern "C" {
+  #include <Utils/Hash/libcrc/lib_crc.h>
+}
+
+namespace Utils {
+
+  // ----------------------------------------------------------------------
+  // Construction and destruction 
+  // ----------------------------------------------------------------------
+
+  HashTester ::
+    HashTester(void)
+  {
+    for (NATIVE_UINT_TYPE i = 0; i < DATA_SIZE; i++) {
+      this->m_data[i] = static_cast<U8>(rand());
+    }
+  }
+
+  HashTester ::
+    ~HashTester(void) 
+  {
+    
+  }
+
+  // ----------------------------------------------------------------------
+  // Tests 
+  // ----------------------------------------------------------------------
+
+  void HashTester ::
+    testCrc32Reference(void) 
+  {
+    // standard CRC32 check value
+    const char* check = "123456789";
+    HashBuffer buffer;
+    Hash::hash(check, 9, buffer);
+    U32 value = 0;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.deserialize(value));
+    ASSERT_EQ(0xCBF43926, value);
+
+    // incremental computation gives the same value
+    Hash hash;
+    hash.update(check, 4);
+    hash.update(check + 4, 5);
+    hash.final(value);
+    ASSERT_EQ(0xCBF43926, value);
+  }
+
+  void HashTester ::
+    testCrc32Lengths(void) 
+  {
+    // check every length and alignment around the eight byte step
+    for (NATIVE_UINT_TYPE offset = 0; offset < 8; offset++) {
+      for (NATIVE_UINT_TYPE len = 0; len < 100; len++) {
+        Hash hash;
+        hash.update(&this->m_data[offset], len);
+        U32 value = 0;
+        hash.final(value);
+        ASSERT_EQ(referenceCrc32(&this->m_data[offset], len), value);
+      }
+    }
+
+    // updates split at odd boundaries
+    Hash hash;
+    NATIVE_UINT_TYPE sent = 0;
+    NATIVE_UINT_TYPE chunk = 1;
+    while (sent < 4096) {
+      hash.update(&this->m_data[sent], chunk);
+      sent += chunk;
+      chunk = (chunk * 7 + 3) % 61;
+    }
+    U32 value = 0;
+    hash.final(value);
+    ASSERT_EQ(referenceCrc32(this->m_data, sent), value);
+  }
+
+  void HashTester ::
+    testCrc32Performance(void) 
+  {
+    const NATIVE_UINT_TYPE iterations = 64;
+    Os::IntervalTimer timer;
+
+    // byte-wise lib_crc
+    U32 reference = 0;
+    timer.start();
+    for (NATIVE_UINT_TYPE i = 0; i < iterations; i++) {
+      reference = referenceCrc32(this->m_data, DATA_SIZE);
+    }
+    timer.stop();
+    U32 referenceUsec = timer.getDiffUsec();
+
+    // configured implementation
+    U32 value = 0;
+    timer.start();
+    for (NATIVE_UINT_TYPE i = 0; i < iterations; i++) {
+      Hash hash;
+      hash.update(this->m_data, DATA_SIZE);
+      hash.final(value);
+    }
+    timer.stop();
+    U32 hashUsec = timer.getDiffUsec();
+
+    ASSERT_EQ(reference, value);
+
+    const F64 megabytes = static_cast<F64>(iterations) * DATA_SIZE / (1024.0 * 1024.0);
+    printf("lib_crc: %0.1f MB/s\n", megabytes * 1000000.0 / (referenceUsec + 1));
+    printf("Hash:    %0.1f MB/s\n", megabytes * 1000000.0 / (hashUsec + 1));
+  }
+
+  // ----------------------------------------------------------------------
+  // Helper methods 
+  // ----------------------------------------------------------------------
+
+  U32 HashTester ::
+    referenceCrc32(const U8* data, NATIVE_UINT_TYPE len)
+  {
+    U32 crc = 0xFFFFFFFF;
+    for (NATIVE_UINT_TYPE i = 0; i < len; i++) {
+      crc = update_crc_32(crc, static_cast<char>(data[i]));
+    }
+    return ~crc;
+  }
+
+} // end namespace Utils
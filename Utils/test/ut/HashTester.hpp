@@ -0,0 +1,75 @@
+// ====================================================================== 
+// \title  Util/test/ut/HashTester.hpp
+// \brief  hpp file for Hash test harness implementation class
+//
+// \copyright
+//
+// Copyright (C) 2009-2020 California Institute of Technology.
+//
+// ALL RIGHTS RESERVED. United States Government Sponsorship
+// acknowledged.
+// ====================================================================== 
+
+#ifndef HASHTESTER_HPP
+#define HASHTESTER_HPP
+
+#include "Utils/Hash/Hash.hpp"
+#include <Fw/Types/BasicTypes.hpp>
+#include "gtest/gtest.h"
+
+namespace Utils {
+
+  class HashTester
+  {
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+    public:
+
+      //! Construct object HashTester
+      //!
+      HashTester(void);
+
+      //! Destroy object HashTester
+      //!
+      ~HashTester(void);
+
+    public:
+
+      // ---------------------------------------------------------------------- 
+      // Tests
+      // ---------------------------------------------------------------------- 
+
+      void testCrc32Reference(void);
+      void testCrc32Lengths(void);
+      void testCrc32Performance(void);
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Helper methods
+      // ----------------------------------------------------------------------
+
+      //! Compute the CRC32 of a buffer one byte at a time with lib_crc
+      //!
+      static U32 referenceCrc32(const U8* data, NATIVE_UINT_TYPE len);
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Variables
+      // ----------------------------------------------------------------------
+
+      enum {
+        DATA_SIZE = 256*1024 //!< size of the benchmark buffer
+      };
+
+      U8 m_data[DATA_SIZE];
+
+  };
+
+} // end namespace Utils
+
+#endif
@@ -5,6 +5,7 @@
 #include "LockGuardTester.hpp"
 #include "RateLimiterTester.hpp"
 #include "TokenBucketTester.hpp"
+#include "HashTester.hpp"
 
 TEST(LockGuardTest, TestLocking) {
     Utils::LockGuardTester tester;
@@ -41,6 +42,21 @@ TEST(TokenBucketTest, TestInitialSettings) {
     tester.testInitialSettings();
 }
 
+TEST(HashTest, TestCrc32Reference) {
+    Utils::HashTester tester;
+    tester.testCrc32Reference();
+}
+
+TEST(HashTest, TestCrc32Lengths) {
+    Utils::HashTester tester;
+    tester.testCrc32Lengths();
+}
+
+TEST(HashTest, TestCrc32Performance) {
+    Utils::HashTester tester;
+    tester.testCrc32Performance();
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -46,6 +46,40 @@ option(CMAKE_DEBUG_OUTPUT "Generate F prime's debug output while running CMake"
 ####
 option(SKIP_TOOLS_CHECK "Skip the tools check for older clients." OFF)
 
+####
+# `FPRIME_OS_QUEUE:`
+#
+# Selects the Os::Queue implementation used on POSIX platforms. Each value names the Os subdirectory holding the
+# `Queue.cpp` backend. Os/test/ut/OsQueueBenchmark.cpp compares the backends.
+#
+# **Values:**
+# - Pthreads: (default) in-process queue using a pthread mutex and condition variables
+# - Posix: POSIX message queues (mq_send/mq_receive)
+# - Linux: in-process queue using futexes. Linux only.
+# - Mpsc: lock-free multi-producer, single-consumer queue (Os/MpscQueue.hpp). Senders never take a lock, but only
+#   one thread may receive from a queue, as in active components. Priorities are clamped onto 4 lanes. Linux only.
+#
+# e.g. `-DFPRIME_OS_QUEUE=Linux`
+####
+set(FPRIME_OS_QUEUE "Pthreads" CACHE STRING "Os::Queue implementation: Pthreads, Posix, Linux or Mpsc")
+
+####
+# `FPRIME_AC_ZERO_COPY_PORTS:`
+#
+# Changes how autocoded components pass the arguments of async input ports through their queues. When every argument
+# of a port is a pointer, an enum, a built-in type or an `Fw::Buffer`, the port call is copied into the queue as a
+# fixed layout message struct instead of being serialized argument by argument. Other ports are unchanged. A single
+# module may also enable this with `ZeroCopyAsyncPorts=True` in the `[component]` section of an `ac.ini` file.
+# Autocoders/Python/test/async_port_benchmark compares the two.
+#
+# **Values:**
+# - ON: fixed layout messages for async ports that allow them
+# - OFF: (default) serialize the arguments of all async ports
+#
+# e.g. `-DFPRIME_AC_ZERO_COPY_PORTS=ON`
+####
+option(FPRIME_AC_ZERO_COPY_PORTS "Pass async port arguments as fixed layout messages" OFF)
+
 # Set build type, when it hasn't been set
 if(NOT CMAKE_BUILD_TYPE) 
     set(CMAKE_BUILD_TYPE RELEASE)
@@ -79,8 +79,16 @@ function(acwrap AC_TYPE AC_FINAL_SOURCE AC_FINAL_HEADER AI_XML XML_FILE_DEPS MOD
 
   if(${AC_TYPE} STREQUAL "topologyapp")
     set(GEN_ARGS "--build_root" "--connect_only" "--xml_topology_dict")
+    # Topology dictionary generation also produces the perfect hash id tables
+    string(REGEX REPLACE "Ai.xml$" "IdTablesAc.hpp" ID_TABLES_HEADER "${AI_XML}")
+    get_filename_component(EXTRA_NAMES ${ID_TABLES_HEADER} NAME)
+    list(APPEND OUTPUT_PRODUCTS "${CMAKE_CURRENT_BINARY_DIR}/${EXTRA_NAMES}")
   else()
     set(GEN_ARGS "--build_root")
+    set(EXTRA_NAMES "")
+  endif()
+  if(${AC_TYPE} STREQUAL "component" AND FPRIME_AC_ZERO_COPY_PORTS)
+    list(APPEND GEN_ARGS "--zero_copy_ports")
   endif()
   # There are two places that files may appear. In-source and out-of-source. In-source generation must happen
   # due to limitations in the autocoder, and thus the files must be moved after generation in the secondary
@@ -100,8 +108,8 @@ function(acwrap AC_TYPE AC_FINAL_SOURCE AC_FINAL_HEADER AI_XML XML_FILE_DEPS MOD
       FPRIME_AC_CONSTANTS_FILE="${FPRIME_AC_CONSTANTS_FILE}"
       PYTHON_AUTOCODER_DIR=${PYTHON_AUTOCODER_DIR}
       ${FPRIME_FRAMEWORK_PATH}/Autocoders/Python/bin/codegen.py ${GEN_ARGS} ${AI_XML}
-      COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR} ${CMAKE_COMMAND} -E copy ${CPP_NAME} ${HPP_NAME} ${CMAKE_CURRENT_BINARY_DIR}
-      COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR} ${CMAKE_COMMAND} -E remove ${CPP_NAME} ${HPP_NAME}
+      COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR} ${CMAKE_COMMAND} -E copy ${CPP_NAME} ${HPP_NAME} ${EXTRA_NAMES} ${CMAKE_CURRENT_BINARY_DIR}
+      COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR} ${CMAKE_COMMAND} -E remove ${CPP_NAME} ${HPP_NAME} ${EXTRA_NAMES}
       DEPENDS ${AI_XML} ${XML_FILE_DEPS} ${FPRIME_AC_CONSTANTS_FILE} ${MOD_DEPS}
   )
   set(AC_OUTPUTS ${OUTPUT_PRODUCTS} PARENT_SCOPE)
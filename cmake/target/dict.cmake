@@ -18,10 +18,12 @@ function(dictgen MODULE_NAME AI_XML DEPS)
   string(REGEX REPLACE "Ai.xml" "ID.csv" ID_CSV_XML "${AI_XML}")
   string(REGEX REPLACE "Ai.xml" "Ai_IDTableLog.txt" ID_LOG_XML "${AI_XML}")
   string(REGEX REPLACE "Ai.xml" "Ac" AC_BASE "${AI_XML}")
+  string(REGEX REPLACE "Ai.xml" "IdTablesAc.hpp" ID_TABLES "${AI_XML}")
   string(REPLACE ";" ":" FPRIME_BUILD_LOCATIONS_SEP "${FPRIME_BUILD_LOCATIONS}")
   get_filename_component(DICT_XML_NAME ${DICT_XML} NAME)
   get_filename_component(ID_CSV_XML_NAME ${ID_CSV_XML} NAME)
   get_filename_component(ID_LOG_XML_NAME ${ID_LOG_XML} NAME)
+  get_filename_component(ID_TABLES_NAME ${ID_TABLES} NAME)
   set(DICT_ROOT "${FPRIME_INSTALL_DEST}/${PLATFORM}/dict")
   set(DICTIONARY_OUTPUT_FILE "${DICT_ROOT}/${DICT_XML_NAME}")
 
@@ -37,7 +39,7 @@ function(dictgen MODULE_NAME AI_XML DEPS)
       COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR} ${CMAKE_COMMAND} -E copy_directory commands "${DICT_ROOT}/commands"
       COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR} ${CMAKE_COMMAND} -E copy_directory channels "${DICT_ROOT}/channels"
       COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR} ${CMAKE_COMMAND} -E copy_directory events "${DICT_ROOT}/events"
-      COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR} ${CMAKE_COMMAND} -E remove ${DICT_XML_NAME} ${ID_CSV_XML_NAME} ${ID_LOG_XML_NAME} ${AC_BASE}.cpp ${AC_BASE}.hpp
+      COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR} ${CMAKE_COMMAND} -E remove ${DICT_XML_NAME} ${ID_CSV_XML_NAME} ${ID_LOG_XML_NAME} ${AC_BASE}.cpp ${AC_BASE}.hpp ${ID_TABLES_NAME}
       # Workaround for older versions of cmake (~v3.10) that can only delete a single directory with "remove_directory" command.
       # When bumping cmake versions combine all deletions into a single "cmake -E rm -rf" command.
       COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR} ${CMAKE_COMMAND} -E remove_directory commands
@@ -23,7 +23,8 @@ enum {
 
 
 enum {
-    TELEM_ID_FILTER_SIZE = 25, //!< Size of telemetry ID filter
+    TELEM_ID_FILTER_SIZE = 25, //!< Size of telemetry ID filter for events not in the id table
+    ACTIVE_LOGGER_ID_TABLE_SLOTS = 4096, //!< Maximum slots in the event id table. Each slot takes one bit.
 };
 
 #endif /* ACTIVELOGGER_ACTIVELOGGERIMPLCFG_HPP_ */
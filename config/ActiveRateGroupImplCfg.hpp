@@ -20,6 +20,13 @@ namespace Svc {
     enum {
         //! Number of overruns allowed before overrun event is throttled
         ACTIVE_RATE_GROUP_OVERRUN_THROTTLE = 5,
+        //! Number of budget overruns by a member allowed before its budget event is throttled
+        ACTIVE_RATE_GROUP_BUDGET_THROTTLE = 5,
+        //! Number of bins in the execution time histogram of each member
+        ACTIVE_RATE_GROUP_HISTOGRAM_BINS = 8,
+        //! Upper limit in microseconds of the first histogram bin.
+        //! Each bin after it is twice as wide as the one before, and the last bin is open ended.
+        ACTIVE_RATE_GROUP_HISTOGRAM_BASE = 100,
     };
 
 }
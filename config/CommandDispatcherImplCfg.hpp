@@ -13,8 +13,14 @@
 enum {
     CMD_DISPATCHER_DISPATCH_TABLE_SIZE = 100, // !< The size of the table holding opcodes to dispatch
     CMD_DISPATCHER_SEQUENCER_TABLE_SIZE = 25, // !< The size of the table holding commands in progress
+    CMD_DISPATCHER_OPCODE_HASH_SLOTS = 128, // !< Number of hash slots indexing the opcode table
 };
 
+// The opcode hash slots should be at least the dispatch table size so that
+// each slot chains to one opcode on average. Commands in progress are indexed
+// by sequence number modulo CMD_DISPATCHER_SEQUENCER_TABLE_SIZE, so no separate
+// size is needed for them.
+
 
 
 #endif /* CMDDISPATCHER_COMMANDDISPATCHERIMPLCFG_HPP_ */
@@ -12,6 +12,7 @@ namespace Svc {
     // If this is set to true, the run handler will look to
     // see if a packet is ready. If it is false, the next packet
     // will be sent as soon as the previous is complete.
+    // Setting it to true is the same as FileDownlink::setWindow(1, 1).
     static const bool FILEDOWNLINK_PACKETS_BY_RUN = false;
     // If this is set to true, if a file is not found the command will fail.
     // If it is false, the command will still pass.
@@ -21,6 +22,13 @@ namespace Svc {
     // Size of the internal file downlink buffer. This must now be static as
     // file down maintains its own internal buffer.
     static const U32 FILEDOWNLINK_INTERNAL_BUFFER_SIZE = FW_COM_BUFFER_MAX_SIZE-sizeof(FwPacketDescriptorType);
+    // Largest number of file packet buffers that may be in flight at once.
+    // File down keeps one internal buffer of the size above for each of
+    // them, plus one for the cancel packet.
+    static const U32 FILEDOWNLINK_MAX_WINDOW = 8;
+    // Bytes read from the file at a time. Data packets are cut from this
+    // read ahead instead of costing a seek and a read each.
+    static const U32 FILEDOWNLINK_READ_AHEAD_SIZE = 4096;
 }
 
 #endif /* SVC_FILEDOWNLINK_FILEDOWNLINKCFG_HPP_ */
@@ -0,0 +1,25 @@
+/*
+ * FileUplinkCfg.hpp:
+ *
+ * Configuration settings for file uplink component.
+ */
+
+#ifndef SVC_FILEUPLINK_FILEUPLINKCFG_HPP_
+#define SVC_FILEUPLINK_FILEUPLINKCFG_HPP_
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Svc {
+    // Number of files that may be in progress at once when reassembling.
+    // Each keeps a range map and a write buffer of the sizes below.
+    static const U32 FILEUPLINK_MAX_TRANSFERS = 4;
+    // Number of separate received byte ranges tracked for each file. A
+    // data packet that would need more is dropped, and reported missing.
+    static const U32 FILEUPLINK_MAX_RANGES = 64;
+    // Bytes of contiguous data packets gathered before they are written.
+    static const U32 FILEUPLINK_WRITE_BUFFER_SIZE = 4096;
+    // Largest number of missing ranges reported when an end packet finds
+    // a file incomplete.
+    static const U32 FILEUPLINK_MAX_REPORTED_RANGES = 8;
+}
+
+#endif /* SVC_FILEUPLINK_FILEUPLINKCFG_HPP_ */
@@ -13,7 +13,8 @@ namespace {
 
     enum {
         PRMDB_NUM_DB_ENTRIES = 25, // !< Number of entries in the parameter database
-        PRMDB_ENTRY_DELIMETER = 0xA5 // !< Byte value that should precede each parameter in file; sanity check against file integrity. Should match ground system.
+        PRMDB_ENTRY_DELIMETER = 0xA5, // !< Byte value that should precede each parameter in file; sanity check against file integrity. Should match ground system.
+        PRMDB_NUM_HASH_SLOTS = 32 // !< Number of hash slots indexing the database by parameter ID. Should be at least PRMDB_NUM_DB_ENTRIES.
     };
 
 }
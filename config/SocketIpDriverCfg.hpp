@@ -25,7 +25,10 @@ enum SocketIpCfg {
     MAX_SEND_ITERATIONS = 0xFFFF,     // Maximum send iterations
     MAX_RECV_BUFFER_SIZE = 2048,      // Maximum and allocation size of the send buffer. TODO: use buffer manager
     PRE_CONNECTION_RETRY_INTERVAL_MS = 1000, // Interval between connection retries before main recv thread starts
-    MAX_HOSTNAME_SIZE = 256 // Maximum stored hostname
+    MAX_HOSTNAME_SIZE = 256, // Maximum stored hostname
+    SOCKET_BATCH_BYTES = 0,           // Bytes of sends to accumulate before flushing them together. 0 - send each buffer immediately
+    SOCKET_BATCH_WINDOW_MICROSECONDS = 10000, // A send flushes the batch if the oldest has waited this long. Only checked on send; schedIn always flushes
+    SOCKET_BATCH_MAX_MESSAGES = 64    // Maximum number of sends accumulated into one flush
 };
 
 
@@ -47,8 +47,11 @@ namespace {
         TLMCHAN_HASH_MOD_VALUE = 99,    // !< The modulo value of the hashing function.
                                         // Should be set to a little below the ID gaps to spread the entries around
 
-        TLMCHAN_HASH_BUCKETS = 50       // !< Buckets assignable to a hash slot.
+        TLMCHAN_HASH_BUCKETS = 50,      // !< Buckets assignable to a hash slot.
                                         // Buckets must be >= number of telemetry channels in system
+
+        TLMCHAN_MAX_PACKETS = 10,       // !< Maximum number of packet definitions in packetized mode
+        TLMCHAN_MAX_PACKET_ENTRIES = 50 // !< Maximum number of channel entries summed over all packet definitions
     };
 
 
@@ -0,0 +1,29 @@
+/**
+ * \file
+ * \brief Configuration file for lockless Telemetry Channel component
+ *
+ * \copyright
+ * Copyright 2009-2015, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ * <br /><br />
+ */
+
+#ifndef TLMCHANLOCKLESSIMPLCFG_HPP_
+#define TLMCHANLOCKLESSIMPLCFG_HPP_
+
+// The table is open-addressed with linear probing. The channel ID is
+// multiplied by a large odd constant and masked to the table size to select
+// the first slot. Keep the table at least twice the number of telemetry
+// channels in the system so that probe sequences stay short.
+
+namespace {
+
+    enum {
+        TLMCHAN_LOCKLESS_TABLE_SIZE = 128,  // !< Number of slots in the table. Must be a power of two.
+        TLMCHAN_LOCKLESS_CACHE_LINE = 64    // !< Entries are aligned to this size. Each entry grows to the next multiple of it.
+    };
+
+}
+
+#endif /* TLMCHANLOCKLESSIMPLCFG_HPP_ */
@@ -10,6 +10,7 @@
 
 namespace Svc {
     const static NATIVE_UINT_TYPE UDP_RECEIVER_MSG_SIZE = 256;
+    const static NATIVE_UINT_TYPE UDP_RECEIVER_BATCH_SIZE = 16; // datagrams received per call when run from an Os::Reactor
 }
 
 #endif /* SVC_UDPRECEIVER_UDPRECEIVERCOMPONENTIMPLCFG_HPP_ */